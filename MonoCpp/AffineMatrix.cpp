@@ -0,0 +1,63 @@
+#include "Structs.h"
+
+namespace Xna {
+
+	AffineMatrix AffineMatrix::CreateFromTRS(Vector3 const& translation, Quaternion const& rotation, Vector3 const& scale) {
+		double num9 = rotation.X * rotation.X;
+		double num8 = rotation.Y * rotation.Y;
+		double num7 = rotation.Z * rotation.Z;
+		double num6 = rotation.X * rotation.Y;
+		double num5 = rotation.Z * rotation.W;
+		double num4 = rotation.Z * rotation.X;
+		double num3 = rotation.Y * rotation.W;
+		double num2 = rotation.Y * rotation.Z;
+		double num = rotation.X * rotation.W;
+
+		// The rows of Matrix::CreateFromQuaternion scaled by the scale, then translated.
+		return AffineMatrix(
+			scale.X * (1.0 - (2.0 * (num8 + num7))),
+			scale.X * (2.0 * (num6 + num5)),
+			scale.X * (2.0 * (num4 - num3)),
+			scale.Y * (2.0 * (num6 - num5)),
+			scale.Y * (1.0 - (2.0 * (num7 + num9))),
+			scale.Y * (2.0 * (num2 + num)),
+			scale.Z * (2.0 * (num4 + num3)),
+			scale.Z * (2.0 * (num2 - num)),
+			scale.Z * (1.0 - (2.0 * (num8 + num9))),
+			translation.X,
+			translation.Y,
+			translation.Z);
+	}
+
+	AffineMatrix AffineMatrix::Invert(AffineMatrix const& matrix) {
+		// Inverse of the 3x3 part from its cofactors, then the translation moved back through it.
+		double c11 = (matrix.M22 * matrix.M33) - (matrix.M23 * matrix.M32);
+		double c12 = (matrix.M23 * matrix.M31) - (matrix.M21 * matrix.M33);
+		double c13 = (matrix.M21 * matrix.M32) - (matrix.M22 * matrix.M31);
+		double invDet = 1.0 / ((matrix.M11 * c11) + (matrix.M12 * c12) + (matrix.M13 * c13));
+
+		AffineMatrix result;
+		result.M11 = c11 * invDet;
+		result.M21 = c12 * invDet;
+		result.M31 = c13 * invDet;
+		result.M12 = ((matrix.M13 * matrix.M32) - (matrix.M12 * matrix.M33)) * invDet;
+		result.M22 = ((matrix.M11 * matrix.M33) - (matrix.M13 * matrix.M31)) * invDet;
+		result.M32 = ((matrix.M12 * matrix.M31) - (matrix.M11 * matrix.M32)) * invDet;
+		result.M13 = ((matrix.M12 * matrix.M23) - (matrix.M13 * matrix.M22)) * invDet;
+		result.M23 = ((matrix.M13 * matrix.M21) - (matrix.M11 * matrix.M23)) * invDet;
+		result.M33 = ((matrix.M11 * matrix.M22) - (matrix.M12 * matrix.M21)) * invDet;
+
+		result.M41 = -((matrix.M41 * result.M11) + (matrix.M42 * result.M21) + (matrix.M43 * result.M31));
+		result.M42 = -((matrix.M41 * result.M12) + (matrix.M42 * result.M22) + (matrix.M43 * result.M32));
+		result.M43 = -((matrix.M41 * result.M13) + (matrix.M42 * result.M23) + (matrix.M43 * result.M33));
+
+		return result;
+	}
+
+	void AffineMatrix::Transform(std::vector<Vector3> const& sourceArray, AffineMatrix const& matrix, std::vector<Vector3>& destinationArray) {
+		destinationArray.resize(sourceArray.size());
+
+		for (size_t i = 0; i < sourceArray.size(); ++i)
+			destinationArray[i] = Transform(sourceArray[i], matrix);
+	}
+}
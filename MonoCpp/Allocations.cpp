@@ -0,0 +1,77 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "Allocations.h"
+
+#ifdef MONOCPP_COUNT_ALLOCATIONS
+
+static std::atomic<u64> allocationCount{ 0 };
+
+static void* allocate(std::size_t size) {
+	++allocationCount;
+	void* p = std::malloc(size == 0 ? 1 : size);
+
+	if (p == nullptr)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+static void* allocate(std::size_t size, std::align_val_t alignment) {
+	++allocationCount;
+	const std::size_t align = static_cast<std::size_t>(alignment);
+	// aligned_alloc wants a size that is a multiple of the alignment.
+	const std::size_t rounded = (size + align - 1) / align * align;
+#ifdef _WIN32
+	void* p = _aligned_malloc(rounded == 0 ? align : rounded, align);
+#else
+	void* p = std::aligned_alloc(align, rounded == 0 ? align : rounded);
+#endif
+
+	if (p == nullptr)
+		throw std::bad_alloc();
+
+	return p;
+}
+
+static void release(void* p, std::align_val_t) noexcept {
+#ifdef _WIN32
+	_aligned_free(p);
+#else
+	std::free(p);
+#endif
+}
+
+void* operator new(std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return allocate(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return allocate(size, alignment); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+void operator delete(void* p, std::align_val_t alignment) noexcept { release(p, alignment); }
+void operator delete[](void* p, std::align_val_t alignment) noexcept { release(p, alignment); }
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept { release(p, alignment); }
+void operator delete[](void* p, std::size_t, std::align_val_t alignment) noexcept { release(p, alignment); }
+
+#endif
+
+namespace Xna {
+
+	bool Allocations::IsCounting() {
+#ifdef MONOCPP_COUNT_ALLOCATIONS
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	u64 Allocations::Count() {
+#ifdef MONOCPP_COUNT_ALLOCATIONS
+		return allocationCount.load();
+#else
+		return 0;
+#endif
+	}
+}
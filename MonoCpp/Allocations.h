@@ -0,0 +1,19 @@
+#ifndef ALLOCATIONS_H
+#define ALLOCATIONS_H
+
+#include "CSharp.h"
+
+namespace Xna {
+
+	// Counts the allocations made through the global operator new, to check that a frame loop
+	// does not allocate. Counting replaces operator new and is only compiled in when
+	// MONOCPP_COUNT_ALLOCATIONS is defined; otherwise Count always returns 0.
+	struct Allocations {
+		// Gets whether allocations are being counted.
+		static bool IsCounting();
+		// Returns the number of allocations since the start of the program.
+		static u64 Count();
+	};
+}
+
+#endif
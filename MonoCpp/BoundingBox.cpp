@@ -1,16 +1,19 @@
 #include <cmath>
+#include <limits>
 #include <numeric>
 #include "Space3d.h"
+#include "Streams.h"
+#include "Parallel.h"
 
 namespace Xna {
 
 	const Vector3 BoundingBox::MaxVector3 = Vector3(std::numeric_limits<double>::max());
-	const Vector3 BoundingBox::MinVector3 = Vector3(std::numeric_limits<double>::min());
+	const Vector3 BoundingBox::MinVector3 = Vector3(std::numeric_limits<double>::lowest());
 
 	// Constructors
 
 	BoundingBox::BoundingBox(): Min(0), Max(0) {};
-	BoundingBox::BoundingBox(Vector3 min, Vector3 max):	Min(0), Max(0) {}
+	BoundingBox::BoundingBox(Vector3 min, Vector3 max):	Min(min), Max(max) {}
 
 	// Operators
 
@@ -25,6 +28,34 @@ namespace Xna {
 
 	// Static
 
+	// Finds the minimum and maximum of values[begin, end).
+	// Four independent lanes let the compiler keep the comparisons in vector registers.
+	static void boundRange(const double* values, size_t begin, size_t end, double& min, double& max) {
+		double lo[4] = { min, min, min, min };
+		double hi[4] = { max, max, max, max };
+		size_t i = begin;
+
+		for (; i + 4 <= end; i += 4) {
+			for (size_t j = 0; j < 4; ++j) {
+				lo[j] = values[i + j] < lo[j] ? values[i + j] : lo[j];
+				hi[j] = values[i + j] > hi[j] ? values[i + j] : hi[j];
+			}
+		}
+
+		for (; i < end; ++i) {
+			lo[0] = values[i] < lo[0] ? values[i] : lo[0];
+			hi[0] = values[i] > hi[0] ? values[i] : hi[0];
+		}
+
+		for (size_t j = 1; j < 4; ++j) {
+			lo[0] = lo[j] < lo[0] ? lo[j] : lo[0];
+			hi[0] = hi[j] > hi[0] ? hi[j] : hi[0];
+		}
+
+		min = lo[0];
+		max = hi[0];
+	}
+
 	BoundingBox BoundingBox::CreateFromPoints(std::vector<Vector3> const& points, i32 index, i32 count)	 {
 
 		if (points.size() == 0) {
@@ -35,21 +66,66 @@ namespace Xna {
 			count = static_cast<i32>(points.size());
 		}
 
-		Vector3 minVec = MaxVector3;
-		Vector3 maxVec = MinVector3;
+		return CreateFromPoints(points.data() + index, count > index ? static_cast<size_t>(count - index) : 0);
+	}
+
+	BoundingBox BoundingBox::CreateFromPoints(Vector3 const* points, size_t count) {
+
+		if (count == 0) {
+			return BoundingBox();
+		}
+
+		std::vector<BoundingBox> chunks(Parallel::ChunkCount(count, Parallel::DefaultChunkSize));
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+			Vector3 minVec = MaxVector3;
+			Vector3 maxVec = MinVector3;
 
-		for (i32 i = index; i < count; i++) {
+			for (size_t i = begin; i < end; i++) {
+				minVec.X = (minVec.X < points[i].X) ? minVec.X : points[i].X;
+				minVec.Y = (minVec.Y < points[i].Y) ? minVec.Y : points[i].Y;
+				minVec.Z = (minVec.Z < points[i].Z) ? minVec.Z : points[i].Z;
 
-			minVec.X = (minVec.X < points[i].X) ? minVec.X : points[i].X;
-			minVec.Y = (minVec.Y < points[i].Y) ? minVec.Y : points[i].Y;
-			minVec.Z = (minVec.Z < points[i].Z) ? minVec.Z : points[i].Z;
+				maxVec.X = (maxVec.X > points[i].X) ? maxVec.X : points[i].X;
+				maxVec.Y = (maxVec.Y > points[i].Y) ? maxVec.Y : points[i].Y;
+				maxVec.Z = (maxVec.Z > points[i].Z) ? maxVec.Z : points[i].Z;
+			}
+
+			chunks[chunk] = BoundingBox(minVec, maxVec);
+		});
+
+		BoundingBox result = chunks[0];
+
+		for (size_t i = 1; i < chunks.size(); ++i)
+			result = CreateMerged(result, chunks[i]);
+
+		return result;
+	}
+
+	BoundingBox BoundingBox::CreateFromPoints(Vector3Stream const& points) {
 
-			maxVec.X = (maxVec.X > points[i].X) ? maxVec.X : points[i].X;
-			maxVec.Y = (maxVec.Y > points[i].Y) ? maxVec.Y : points[i].Y;
-			maxVec.Z = (maxVec.Z > points[i].Z) ? maxVec.Z : points[i].Z;
+		const size_t count = points.Count();
+
+		if (count == 0) {
+			return BoundingBox();
 		}
 
-		return BoundingBox(minVec, maxVec);
+		std::vector<BoundingBox> chunks(Parallel::ChunkCount(count, Parallel::DefaultChunkSize));
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+			BoundingBox box(MaxVector3, MinVector3);
+			boundRange(points.X.data(), begin, end, box.Min.X, box.Max.X);
+			boundRange(points.Y.data(), begin, end, box.Min.Y, box.Max.Y);
+			boundRange(points.Z.data(), begin, end, box.Min.Z, box.Max.Z);
+			chunks[chunk] = box;
+		});
+
+		BoundingBox result = chunks[0];
+
+		for (size_t i = 1; i < chunks.size(); ++i)
+			result = CreateMerged(result, chunks[i]);
+
+		return result;
 	}
 
 	BoundingBox BoundingBox::CreateFromSphere(BoundingSphere const& sphere) {	
@@ -58,6 +134,14 @@ namespace Xna {
 		return BoundingBox(sphere.Center - corner, sphere.Center + corner);
 	}
 
+	BoundingBox BoundingBox::CreateSwept(BoundingBox const& box, Vector3 const& motion) {
+		return CreateMerged(box, BoundingBox(box.Min + motion, box.Max + motion));
+	}
+
+	BoundingBox BoundingBox::CreateSwept(BoundingSphere const& sphere, Vector3 const& motion) {
+		return CreateSwept(CreateFromSphere(sphere), motion);
+	}
+
 	BoundingBox BoundingBox::CreateMerged(BoundingBox const& original, BoundingBox const& additional) {
 
 		BoundingBox result;
@@ -101,8 +185,9 @@ namespace Xna {
 	ContainmentType BoundingBox::Contains(BoundingFrustum const& frustum) const {
 		i32 i;
 		ContainmentType contained;
-		auto corners = frustum.GetCorners();
-		auto cornersSize = corners.size();
+		Vector3 corners[BoundingFrustum::CornerCount];
+		frustum.GetCorners(corners);
+		auto cornersSize = BoundingFrustum::CornerCount;
 
 		for (i = 0; i < cornersSize; i++) {
 			contained = Contains(corners[i]);
@@ -248,7 +333,27 @@ namespace Xna {
 		};
 	}
 
+	std::pmr::vector<Vector3> BoundingBox::GetCorners(std::pmr::memory_resource* resource) const {
+		return std::pmr::vector<Vector3>({
+			Vector3(Min.X, Max.Y, Max.Z),
+				Vector3(Max.X, Max.Y, Max.Z),
+				Vector3(Max.X, Min.Y, Max.Z),
+				Vector3(Min.X, Min.Y, Max.Z),
+				Vector3(Min.X, Max.Y, Min.Z),
+				Vector3(Max.X, Max.Y, Min.Z),
+				Vector3(Max.X, Min.Y, Min.Z),
+				Vector3(Min.X, Min.Y, Min.Z)
+		}, resource);
+	}
+
 	void BoundingBox::GetCorners(std::vector<Vector3>& corners) const {
+		if (corners.size() < CornerCount)
+			corners.resize(CornerCount);
+
+		GetCorners(corners.data());
+	}
+
+	void BoundingBox::GetCorners(Vector3* corners) const {
 		corners[0].X = Min.X;
 		corners[0].Y = Max.Y;
 		corners[0].Z = Max.Z;
@@ -371,6 +476,48 @@ namespace Xna {
 		return ray.Intersects((*this));
 	}
 
+	double BoundingBox::Sweep(Vector3 const& motion, BoundingBox const& box) const {
+
+		if (Intersects(box))
+			return 0;
+
+		const double length = motion.Length();
+
+		if (length == 0)
+			return MathHelper::NaN;
+
+		// The center of this box touches the other one grown by this one's half size.
+		const Vector3 half = (Max - Min) * 0.5;
+		const BoundingBox grown(box.Min - half, box.Max + half);
+		const double distance = Ray(Min + half, motion / length).Intersects(grown);
+
+		return distance <= length ? distance / length : MathHelper::NaN;
+	}
+
+	size_t BoundingBox::Sweep(std::vector<BoundingBox> const& boxes, std::vector<Vector3> const& motions,
+		std::vector<std::pair<u32, u32>> const& pairs, std::vector<double>& result) {
+
+		const size_t count = pairs.size();
+		result.resize(count);
+		std::vector<size_t> hits(Parallel::ChunkCount(count, Parallel::DefaultChunkSize), 0);
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+			size_t found = 0;
+
+			for (size_t i = begin; i < end; ++i) {
+				const u32 a = pairs[i].first;
+				const u32 b = pairs[i].second;
+
+				result[i] = boxes[a].Sweep(motions[a] - motions[b], boxes[b]);
+				found += std::isnan(result[i]) ? 0 : 1;
+			}
+
+			hits[chunk] = found;
+		});
+
+		return std::accumulate(hits.begin(), hits.end(), size_t(0));
+	}
+
 	void BoundingBox::Deconstruct(Vector3 &min, Vector3 &max) const
 	{
 		min = Min;
@@ -1,18 +1,80 @@
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include <numeric>
 
 #include "Space3d.h"
+#include "MathHelper.h"
 
 namespace Xna {
 
+	// The three planes (near or far, left or right, top or bottom) that meet at each corner.
+	static constexpr i32 CornerPlanes[BoundingFrustum::CornerCount][3] = {
+		{ 0, 2, 4 }, { 0, 3, 4 }, { 0, 3, 5 }, { 0, 2, 5 },
+		{ 1, 2, 4 }, { 1, 3, 4 }, { 1, 3, 5 }, { 1, 2, 5 }
+	};
+
+	// The corners at both ends of each edge: the near face, the far face, then the four sides.
+	static constexpr i32 EdgeCorners[12][2] = {
+		{ 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },
+		{ 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },
+		{ 0, 4 }, { 1, 5 }, { 2, 6 }, { 3, 7 }
+	};
+
+	// How far outside a plane a point may lie and still count as on it, to absorb rounding in the projection.
+	static constexpr double PlaneTolerance = 1e-9;
+
+	// Returns a mask with the bits of the corners that lie on any of the planes of the mask.
+	static byte cornersOf(byte planes) {
+		byte corners = 0;
+
+		for (i32 i = 0; i < BoundingFrustum::CornerCount; ++i) {
+			const i32* p = CornerPlanes[i];
+
+			if ((planes & ((1 << p[0]) | (1 << p[1]) | (1 << p[2]))) != 0)
+				corners |= static_cast<byte>(1 << i);
+		}
+
+		return corners;
+	}
+
+	// Returns a mask with the bits of the planes extracted from the matrix columns that differ between both matrices.
+	static byte changedPlanes(Matrix const& a, Matrix const& b) {
+		const bool c1 = a.M11 != b.M11 || a.M21 != b.M21 || a.M31 != b.M31 || a.M41 != b.M41;
+		const bool c2 = a.M12 != b.M12 || a.M22 != b.M22 || a.M32 != b.M32 || a.M42 != b.M42;
+		const bool c3 = a.M13 != b.M13 || a.M23 != b.M23 || a.M33 != b.M33 || a.M43 != b.M43;
+		const bool c4 = a.M14 != b.M14 || a.M24 != b.M24 || a.M34 != b.M34 || a.M44 != b.M44;
+
+		byte planes = 0;
+		// Near uses column 3, far column 3 and 4, left and right columns 1 and 4, top and bottom columns 2 and 4.
+		if (c3) planes |= 1 << 0;
+		if (c3 || c4) planes |= 1 << 1;
+		if (c1 || c4) planes |= (1 << 2) | (1 << 3);
+		if (c2 || c4) planes |= (1 << 4) | (1 << 5);
+
+		return planes;
+	}
+
+	// Returns the inverse of a rotation and translation: the rotation transposed, then the translation rotated back and negated.
+	static Matrix invertRigid(Matrix const& motion) {
+		const Vector3 t = motion.Translation();
+
+		return Matrix(
+			motion.M11, motion.M21, motion.M31, 0,
+			motion.M12, motion.M22, motion.M32, 0,
+			motion.M13, motion.M23, motion.M33, 0,
+			-(t.X * motion.M11 + t.Y * motion.M12 + t.Z * motion.M13),
+			-(t.X * motion.M21 + t.Y * motion.M22 + t.Z * motion.M23),
+			-(t.X * motion.M31 + t.Y * motion.M32 + t.Z * motion.M33), 1);
+	}
+
 	BoundingFrustum::BoundingFrustum(): 
 		_corners(CornerCount), _planes(PlaneCount) {};
 
 	BoundingFrustum::BoundingFrustum(Matrix value): 
 		_matrix(value), _corners(CornerCount), _planes(PlaneCount) {
-		CreatePlanes();
-		CreateCorners();
+		CreatePlanes(AllPlanes);
+		CreateCorners(AllCorners);
 	};
 
 	// Operators	
@@ -32,9 +94,41 @@ namespace Xna {
 	}
 
 	void BoundingFrustum::Matrix_(Matrix value) {
+		const byte planes = changedPlanes(_matrix, value);
 		_matrix = value;
-		CreatePlanes();
-		CreateCorners();
+
+		if (planes == 0)
+			return;
+
+		CreatePlanes(planes);
+		CreateCorners(cornersOf(planes));
+	}
+
+	void BoundingFrustum::Transform(Matrix const& motion) {
+		const Vector3 translation = motion.Translation();
+
+		for (i32 i = 0; i < PlaneCount; ++i) {
+			Plane& p = _planes[i];
+			p.Normal = Vector3::TransformNormal(p.Normal, motion);
+			p.D -= Vector3::Dot(p.Normal, translation);
+		}
+
+		for (i32 i = 0; i < CornerCount; ++i)
+			_corners[i] = Vector3::Transform(_corners[i], motion);
+
+		_matrix = invertRigid(motion) * _matrix;
+	}
+
+	void BoundingFrustum::Translate(Vector3 const& translation) {
+		for (i32 i = 0; i < PlaneCount; ++i) {
+			Plane& p = _planes[i];
+			p.D -= Vector3::Dot(p.Normal, translation);
+		}
+
+		for (i32 i = 0; i < CornerCount; ++i)
+			_corners[i] = _corners[i] + translation;
+
+		_matrix = Matrix::CreateTranslation(-translation) * _matrix;
 	}
 
 	Plane BoundingFrustum::Near() const {
@@ -142,9 +236,19 @@ namespace Xna {
 		return std::vector<Vector3>(_corners);
 	}
 
-	void BoundingFrustum::GetCorners(std::vector<Vector3>& corners) {		
+	std::pmr::vector<Vector3> BoundingFrustum::GetCorners(std::pmr::memory_resource* resource) const {
 
-		std::copy(_corners.begin(), _corners.end(), std::back_inserter(corners));
+		return std::pmr::vector<Vector3>(_corners.begin(), _corners.end(), resource);
+	}
+
+	void BoundingFrustum::GetCorners(std::vector<Vector3>& corners) const {
+
+		corners.assign(_corners.begin(), _corners.end());
+	}
+
+	void BoundingFrustum::GetCorners(Vector3* corners) const {
+
+		std::copy(_corners.begin(), _corners.end(), corners);
 	}
 
 	bool BoundingFrustum::Intersects(BoundingBox const& box) const {
@@ -155,8 +259,53 @@ namespace Xna {
 		return Contains(frustum) != ContainmentType::Disjoint;
 	}
 
-	bool BoundingFrustum::Intersects(BoundingSphere const& sphere) const {
-		return Contains(sphere) != ContainmentType::Disjoint;
+	bool BoundingFrustum::Intersects(BoundingSphere const& sphere, CullingMode mode) const {
+
+		double distances[PlaneCount];
+		bool outside = false;
+
+		for (i32 i = 0; i < PlaneCount; ++i) {
+			distances[i] = _planes[i].DotCoordinate(sphere.Center);
+
+			if (distances[i] > sphere.Radius)
+				return false;
+
+			outside |= distances[i] > 0;
+		}
+
+		if (!outside || mode == CullingMode::Conservative)
+			return true;
+
+		// The center is outside, so the closest point of the frustum lies on its surface:
+		// inside a face, on an edge or at a corner.
+		for (i32 i = 0; i < PlaneCount; ++i) {
+			if (distances[i] <= 0)
+				continue;
+
+			const Vector3 projection = sphere.Center - _planes[i].Normal * distances[i];
+			bool onFace = true;
+
+			for (i32 j = 0; j < PlaneCount && onFace; ++j)
+				onFace = j == i || _planes[j].DotCoordinate(projection) <= PlaneTolerance;
+
+			if (onFace)
+				return true;
+		}
+
+		const double radiusSquared = sphere.Radius * sphere.Radius;
+
+		for (i32 i = 0; i < 12; ++i) {
+			const Vector3& a = _corners[EdgeCorners[i][0]];
+			const Vector3 edge = _corners[EdgeCorners[i][1]] - a;
+			const double lengthSquared = edge.LengthSquared();
+			double t = lengthSquared > 0 ? Vector3::Dot(sphere.Center - a, edge) / lengthSquared : 0.0;
+			t = t < 0 ? 0 : (t > 1 ? 1 : t);
+
+			if (Vector3::DistanceSquared(sphere.Center, a + edge * t) <= radiusSquared)
+				return true;
+		}
+
+		return false;
 	}
 
 	PlaneIntersectionType BoundingFrustum::Intersects(Plane const& plane) const {
@@ -174,24 +323,33 @@ namespace Xna {
 
 	double BoundingFrustum::Intersects(Ray const& ray) const {
 
-		constexpr double nan = std::numeric_limits<double>::quiet_NaN();
-		ContainmentType ctype = Contains(ray.Position);
+		double enter = 0;
+		double exit = std::numeric_limits<double>::max();
 
-		switch (ctype)
-		{
-			case ContainmentType::Disjoint:
-				return nan;
-			case ContainmentType::Contains:
-				return 0.0;
-			case ContainmentType::Intersects:
-				//TODO: NotImplementedException
-				return nan;
-			default:
-				//TODO: ArgumentOutOfRangeException;
-				return nan;
+		// Clips the ray against each plane in turn, stopping as soon as nothing is left.
+		for (i32 i = 0; i < PlaneCount; ++i) {
+			const double distance = _planes[i].DotCoordinate(ray.Position);
+			const double speed = Vector3::Dot(_planes[i].Normal, ray.Direction);
+
+			if (speed == 0) {
+				if (distance > 0)
+					return MathHelper::NaN;
+
+				continue;
+			}
+
+			const double t = -distance / speed;
+
+			if (speed < 0)
+				enter = t > enter ? t : enter;
+			else
+				exit = t < exit ? t : exit;
+
+			if (enter > exit)
+				return MathHelper::NaN;
 		}
 
-		return nan;
+		return enter;
 	}
 
 	bool BoundingFrustum::Equals(BoundingFrustum const& other) {		
@@ -243,33 +401,34 @@ namespace Xna {
 		p.D *= factor;
 	}
 
-	void BoundingFrustum::CreateCorners() {
-
-		_corners[0] = IntersectionPoint(_planes[0], _planes[2], _planes[4]);
-		_corners[1] = IntersectionPoint(_planes[0], _planes[3], _planes[4]);
-		_corners[2] = IntersectionPoint(_planes[0], _planes[3], _planes[5]);
-		_corners[3] = IntersectionPoint(_planes[0], _planes[2], _planes[5]);
-		_corners[4] = IntersectionPoint(_planes[1], _planes[2], _planes[4]);
-		_corners[5] = IntersectionPoint(_planes[1], _planes[3], _planes[4]);
-		_corners[6] = IntersectionPoint(_planes[1], _planes[3], _planes[5]);
-		_corners[7] = IntersectionPoint(_planes[1], _planes[2], _planes[5]);
+	void BoundingFrustum::CreateCorners(byte corners) {
 
+		for (i32 i = 0; i < CornerCount; ++i) {
+			if ((corners & (1 << i)) != 0) {
+				const i32* p = CornerPlanes[i];
+				_corners[i] = IntersectionPoint(_planes[p[0]], _planes[p[1]], _planes[p[2]]);
+			}
+		}
 	}
 
-	void BoundingFrustum::CreatePlanes() {
-
-		_planes[0] = Plane(-_matrix.M13, -_matrix.M23, -_matrix.M33, -_matrix.M43);
-		_planes[1] = Plane(_matrix.M13 - _matrix.M14, _matrix.M23 - _matrix.M24, _matrix.M33 - _matrix.M34, _matrix.M43 - _matrix.M44);
-		_planes[2] = Plane(-_matrix.M14 - _matrix.M11, -_matrix.M24 - _matrix.M21, -_matrix.M34 - _matrix.M31, -_matrix.M44 - _matrix.M41);
-		_planes[3] = Plane(_matrix.M11 - _matrix.M14, _matrix.M21 - _matrix.M24, _matrix.M31 - _matrix.M34, _matrix.M41 - _matrix.M44);
-		_planes[4] = Plane(_matrix.M12 - _matrix.M14, _matrix.M22 - _matrix.M24, _matrix.M32 - _matrix.M34, _matrix.M42 - _matrix.M44);
-		_planes[5] = Plane(-_matrix.M14 - _matrix.M12, -_matrix.M24 - _matrix.M22, -_matrix.M34 - _matrix.M32, -_matrix.M44 - _matrix.M42);
-
-		NormalizePlane(_planes[0]);
-		NormalizePlane(_planes[1]);
-		NormalizePlane(_planes[2]);
-		NormalizePlane(_planes[3]);
-		NormalizePlane(_planes[4]);
-		NormalizePlane(_planes[5]);
+	void BoundingFrustum::CreatePlanes(byte planes) {
+
+		if (planes & (1 << 0))
+			_planes[0] = Plane(-_matrix.M13, -_matrix.M23, -_matrix.M33, -_matrix.M43);
+		if (planes & (1 << 1))
+			_planes[1] = Plane(_matrix.M13 - _matrix.M14, _matrix.M23 - _matrix.M24, _matrix.M33 - _matrix.M34, _matrix.M43 - _matrix.M44);
+		if (planes & (1 << 2))
+			_planes[2] = Plane(-_matrix.M14 - _matrix.M11, -_matrix.M24 - _matrix.M21, -_matrix.M34 - _matrix.M31, -_matrix.M44 - _matrix.M41);
+		if (planes & (1 << 3))
+			_planes[3] = Plane(_matrix.M11 - _matrix.M14, _matrix.M21 - _matrix.M24, _matrix.M31 - _matrix.M34, _matrix.M41 - _matrix.M44);
+		if (planes & (1 << 4))
+			_planes[4] = Plane(_matrix.M12 - _matrix.M14, _matrix.M22 - _matrix.M24, _matrix.M32 - _matrix.M34, _matrix.M42 - _matrix.M44);
+		if (planes & (1 << 5))
+			_planes[5] = Plane(-_matrix.M14 - _matrix.M12, -_matrix.M24 - _matrix.M22, -_matrix.M34 - _matrix.M32, -_matrix.M44 - _matrix.M42);
+
+		for (i32 i = 0; i < PlaneCount; ++i) {
+			if (planes & (1 << i))
+				NormalizePlane(_planes[i]);
+		}
 	}
 }
\ No newline at end of file
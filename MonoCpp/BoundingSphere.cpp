@@ -1,93 +1,146 @@
 #include <numeric>
 #include <cmath>
+#include <limits>
 
 #include "Space3d.h"
+#include "Streams.h"
+#include "Parallel.h"
 
 namespace Xna {
 
-	BoundingSphere::BoundingSphere() : Center(0), Radius(0) {}
-	BoundingSphere::BoundingSphere(Vector3 center, double radius):
-		Center(center), Radius(radius){}
-
-	// Operators
-
-    bool operator == (BoundingSphere a, BoundingSphere b) {
-        return a.Equals(b);
-    }
-
-    bool operator != (BoundingSphere a, BoundingSphere b) {
-        return !a.Equals(b);
+    // Directions along which extreme points are searched: the three axes for
+    // BoundingSphereFit::Fast, plus the four cube diagonals for BoundingSphereFit::Tight.
+    static constexpr size_t MaxDirections = 7;
+
+    // Projects the point on a direction, with the (unnormalized) directions written out so no multiplication is needed.
+    static inline double project(Vector3 const& pt, size_t direction) {
+        switch (direction) {
+        case 0: return pt.X;
+        case 1: return pt.Y;
+        case 2: return pt.Z;
+        case 3: return pt.X + pt.Y + pt.Z;
+        case 4: return pt.X + pt.Y - pt.Z;
+        case 5: return pt.X - pt.Y + pt.Z;
+        default: return pt.X - pt.Y - pt.Z;
+        }
     }
 
-	// Static
-	BoundingSphere BoundingSphere::CreateFromFrustum(BoundingFrustum const& frustum) {
-		return CreateFromPoints(frustum.GetCorners());
-	}
+    // The lowest and highest projected point found along each direction.
+    struct Extremes {
+        double Min[MaxDirections];
+        double Max[MaxDirections];
+        Vector3 MinPoint[MaxDirections];
+        Vector3 MaxPoint[MaxDirections];
+
+        Extremes() {
+            for (size_t i = 0; i < MaxDirections; ++i) {
+                Min[i] = std::numeric_limits<double>::max();
+                Max[i] = std::numeric_limits<double>::lowest();
+            }
+        }
 
-	BoundingSphere BoundingSphere::CreateFromPoints(std::vector<Vector3> const& points)  {
+        // Keeps the first point on ties so the result does not depend on how the input was split.
+        template <size_t directions>
+        void Add(Vector3 const& pt) {
+            for (size_t i = 0; i < directions; ++i) {
+                const double d = project(pt, i);
+
+                if (d < Min[i]) {
+                    Min[i] = d;
+                    MinPoint[i] = pt;
+                }
+                if (d > Max[i]) {
+                    Max[i] = d;
+                    MaxPoint[i] = pt;
+                }
+            }
+        }
 
-        Vector3 minx = Vector3(std::numeric_limits<double>::max());
-
-        Vector3 maxx = -minx;
-        Vector3 miny = minx;
-        Vector3 maxy = -minx;
-        Vector3 minz = minx;
-        Vector3 maxz = -minx;
-
-        // Find the most extreme points along the principle axis.
-        i32 numPoints = 0;
-
-        for (Vector3 const& pt : points) {
-
-            ++numPoints;
-
-            if (pt.X < minx.X)
-                minx = pt;
-            if (pt.X > maxx.X)
-                maxx = pt;
-            if (pt.Y < miny.Y)
-                miny = pt;
-            if (pt.Y > maxy.Y)
-                maxy = pt;
-            if (pt.Z < minz.Z)
-                minz = pt;
-            if (pt.Z > maxz.Z)
-                maxz = pt;
+        void Merge(Extremes const& other, size_t directions) {
+            for (size_t i = 0; i < directions; ++i) {
+                if (other.Min[i] < Min[i]) {
+                    Min[i] = other.Min[i];
+                    MinPoint[i] = other.MinPoint[i];
+                }
+                if (other.Max[i] > Max[i]) {
+                    Max[i] = other.Max[i];
+                    MaxPoint[i] = other.MaxPoint[i];
+                }
+            }
         }
+    };
 
-        if (numPoints == 0) {
-            //throw std::invalid_argument("You should have at least one point in points.");
-            return BoundingSphere();
-        }            
+    static bool encloses(BoundingSphere const& sphere, Vector3 const& pt) {
+        const double sqRadius = sphere.Radius * sphere.Radius;
+        return Vector3::DistanceSquared(pt, sphere.Center) <= sqRadius + sqRadius * 1e-12;
+    }
 
-        double sqDistX = Vector3::DistanceSquared(maxx, minx);
-        double sqDistY = Vector3::DistanceSquared(maxy, miny);
-        double sqDistZ = Vector3::DistanceSquared(maxz, minz);
+    // Smallest sphere with every support point on its surface, for 1 to 4 points.
+    // Degenerate (collinear or coplanar) supports fall back to a sphere through fewer points.
+    static BoundingSphere supportSphere(Vector3 const* support, size_t count) {
+        switch (count) {
+        case 0:
+            return BoundingSphere(Vector3::Zero(), -1);
+        case 1:
+            return BoundingSphere(support[0], 0);
+        case 2: {
+            Vector3 center = (support[0] + support[1]) * 0.5;
+            return BoundingSphere(center, Vector3::Distance(support[0], center));
+        }
+        case 3: {
+            Vector3 a = support[1] - support[0];
+            Vector3 b = support[2] - support[0];
+            Vector3 axb = Vector3::Cross(a, b);
+            double denominator = 2 * axb.LengthSquared();
 
-        // Pick the pair of most distant points.
-        Vector3 min = minx;
-        Vector3 max = maxx;
+            if (denominator <= std::numeric_limits<double>::epsilon() * a.LengthSquared() * b.LengthSquared())
+                return supportSphere(support, 2);
 
-        if (sqDistY > sqDistX && sqDistY > sqDistZ) {
-            max = maxy;
-            min = miny;
+            Vector3 offset = (b.LengthSquared() * Vector3::Cross(axb, a) + a.LengthSquared() * Vector3::Cross(b, axb)) / denominator;
+            return BoundingSphere(support[0] + offset, offset.Length());
         }
-
-        if (sqDistZ > sqDistX && sqDistZ > sqDistY) {
-            max = maxz;
-            min = minz;
+        default: {
+            Vector3 a = support[1] - support[0];
+            Vector3 b = support[2] - support[0];
+            Vector3 c = support[3] - support[0];
+            double denominator = 2 * Vector3::Dot(a, Vector3::Cross(b, c));
+
+            if (std::abs(denominator) <= std::numeric_limits<double>::epsilon() * a.Length() * b.Length() * c.Length())
+                return supportSphere(support, 3);
+
+            Vector3 offset = (c.LengthSquared() * Vector3::Cross(a, b)
+                + b.LengthSquared() * Vector3::Cross(c, a)
+                + a.LengthSquared() * Vector3::Cross(b, c)) / denominator;
+            return BoundingSphere(support[0] + offset, offset.Length());
         }
+        }
+    }
+
+    // Welzl's minimum enclosing sphere of a handful of points, with support holding the points that must lie on the surface.
+    static BoundingSphere minimumSphere(Vector3 const* points, size_t count, Vector3* support, size_t supportCount) {
+        if (count == 0 || supportCount == 4)
+            return supportSphere(support, supportCount);
 
-        Vector3 center = (min + max) * 0.5f;
-        double radius = Vector3::Distance(max, center);
+        BoundingSphere sphere = minimumSphere(points, count - 1, support, supportCount);
 
-        // Test every point and expand the sphere.
-        // The current bounding sphere is just a good approximation and may not enclose all points.            
-        // From: Mathematics for 3D Game Programming and Computer Graphics, Eric Lengyel, Third Edition.
-        // Page 218
+        if (sphere.Radius >= 0 && encloses(sphere, points[count - 1]))
+            return sphere;
+
+        support[supportCount] = points[count - 1];
+        return minimumSphere(points, count - 1, support, supportCount + 1);
+    }
+
+    // Grows the sphere to enclose every point of [begin, end).
+    // From: Mathematics for 3D Game Programming and Computer Graphics, Eric Lengyel, Third Edition.
+    // Page 218
+    template <typename Points>
+    static BoundingSphere growSphere(BoundingSphere sphere, Points const& points, size_t begin, size_t end) {
+        Vector3 center = sphere.Center;
+        double radius = sphere.Radius;
         double sqRadius = radius * radius;
 
-        for (Vector3 const& pt : points) {
+        for (size_t i = begin; i < end; ++i) {
+            Vector3 pt = points(i);
             Vector3 diff = (pt - center);
             double sqDist = diff.LengthSquared();
             if (sqDist > sqRadius)
@@ -99,11 +152,154 @@ namespace Xna {
                 radius = Vector3::Distance(pt, center);
                 sqRadius = radius * radius;
             }
-        }       
+        }
 
         return BoundingSphere(center, radius);
+    }
+
+    template <typename Points>
+    static BoundingSphere createFromPoints(Points const& points, size_t count, BoundingSphereFit fit) {
+
+        if (count == 0) {
+            return BoundingSphere();
+        }
+
+        const size_t directions = fit == BoundingSphereFit::Tight ? MaxDirections : 3;
+        std::vector<Extremes> extremes(Parallel::ChunkCount(count, Parallel::DefaultChunkSize));
+
+        // Find the most extreme points along each direction.
+        Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            if (directions == MaxDirections) {
+                for (size_t i = begin; i < end; ++i)
+                    extremes[chunk].Add<MaxDirections>(points(i));
+            }
+            else {
+                for (size_t i = begin; i < end; ++i)
+                    extremes[chunk].Add<3>(points(i));
+            }
+        });
+
+        for (size_t i = 1; i < extremes.size(); ++i)
+            extremes[0].Merge(extremes[i], directions);
+
+        BoundingSphere sphere;
+
+        if (fit == BoundingSphereFit::Tight) {
+            Vector3 candidates[2 * MaxDirections];
+            Vector3 support[4];
+
+            for (size_t i = 0; i < MaxDirections; ++i) {
+                candidates[2 * i] = extremes[0].MinPoint[i];
+                candidates[2 * i + 1] = extremes[0].MaxPoint[i];
+            }
+
+            sphere = minimumSphere(candidates, 2 * MaxDirections, support, 0);
+        }
+        else {
+            // Pick the pair of most distant points.
+            double sqDist = -1;
+            size_t axis = 0;
+
+            for (size_t i = 0; i < directions; ++i) {
+                double d = Vector3::DistanceSquared(extremes[0].MaxPoint[i], extremes[0].MinPoint[i]);
+                if (d > sqDist) {
+                    sqDist = d;
+                    axis = i;
+                }
+            }
+
+            Vector3 center = (extremes[0].MinPoint[axis] + extremes[0].MaxPoint[axis]) * 0.5;
+            sphere = BoundingSphere(center, Vector3::Distance(extremes[0].MaxPoint[axis], center));
+        }
+
+        // The current bounding sphere is just a good approximation and may not enclose all points.
+        // Each chunk grows its own copy and the copies are merged, which encloses every point.
+        std::vector<BoundingSphere> grown(extremes.size());
+
+        Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            grown[chunk] = growSphere(sphere, points, begin, end);
+        });
+
+        BoundingSphere result = grown[0];
+
+        for (size_t i = 1; i < grown.size(); ++i)
+            result = BoundingSphere::CreateMerged(result, grown[i]);
+
+        return result;
+    }
+
+    static double axisOf(Vector3 const& value, i32 axis) {
+        return axis == 0 ? value.X : (axis == 1 ? value.Y : value.Z);
+    }
+
+    static void setAxis(Vector3& value, i32 axis, double component) {
+        (axis == 0 ? value.X : (axis == 1 ? value.Y : value.Z)) = component;
+    }
+
+    // Returns the distance along a ray with a unit direction, starting outside the capsule of radius around
+    // the edge from start to end along axis, at which it reaches the capsule, or NaN if it misses it.
+    static double rayEdge(Ray const& ray, Vector3 const& start, Vector3 const& end, i32 axis, double radius) {
+        const i32 u = (axis + 1) % 3;
+        const i32 v = (axis + 2) % 3;
+        const double du = axisOf(ray.Position, u) - axisOf(start, u);
+        const double dv = axisOf(ray.Position, v) - axisOf(start, v);
+        const double su = axisOf(ray.Direction, u);
+        const double sv = axisOf(ray.Direction, v);
+
+        // The side of the capsule is a cylinder around the axis, a circle in the other two.
+        const double a = su * su + sv * sv;
+        const double b = du * su + dv * sv;
+        const double c = du * du + dv * dv - radius * radius;
+
+        if (a > 0 && c > 0 && b * b - a * c >= 0) {
+            const double t = (-b - std::sqrt(b * b - a * c)) / a;
+            const double h = axisOf(ray.Position, axis) + axisOf(ray.Direction, axis) * t;
+
+            if (t >= 0 && h >= axisOf(start, axis) && h <= axisOf(end, axis))
+                return t;
+        }
+
+        // Otherwise the ray can only reach the rounded ends.
+        const double first = ray.Intersects(BoundingSphere(start, radius));
+        const double second = ray.Intersects(BoundingSphere(end, radius));
+
+        return std::isnan(first) || second < first ? second : first;
+    }
+
+	BoundingSphere::BoundingSphere() : Center(0), Radius(0) {}
+	BoundingSphere::BoundingSphere(Vector3 center, double radius):
+		Center(center), Radius(radius){}
+
+	// Operators
+
+    bool operator == (BoundingSphere a, BoundingSphere b) {
+        return a.Equals(b);
+    }
+
+    bool operator != (BoundingSphere a, BoundingSphere b) {
+        return !a.Equals(b);
+    }
+
+	// Static
+	BoundingSphere BoundingSphere::CreateFromFrustum(BoundingFrustum const& frustum) {
+		Vector3 corners[BoundingFrustum::CornerCount];
+		frustum.GetCorners(corners);
+
+		return CreateFromPoints(corners, BoundingFrustum::CornerCount);
 	}
 
+	BoundingSphere BoundingSphere::CreateFromPoints(std::vector<Vector3> const& points)  {
+        return CreateFromPoints(points.data(), points.size());
+	}
+
+    BoundingSphere BoundingSphere::CreateFromPoints(Vector3 const* points, size_t count, BoundingSphereFit fit) {
+        return createFromPoints([points](size_t i) { return points[i]; }, count, fit);
+    }
+
+    BoundingSphere BoundingSphere::CreateFromPoints(Vector3Stream const& points, BoundingSphereFit fit) {
+        return createFromPoints([&points](size_t i) { return points.Get(i); }, points.Count(), fit);
+    }
+
     BoundingSphere BoundingSphere::CreateMerged(BoundingSphere const& original, BoundingSphere const& additional) {       
         
         Vector3 ocenterToaCenter = Vector3::Subtract(additional.Center, original.Center);
@@ -150,7 +346,10 @@ namespace Xna {
     ContainmentType BoundingSphere::Contains(BoundingBox const& box) const {
         //check if all corner is in sphere
         bool inside = true;
-        for(Vector3 const& corner : box.GetCorners()) {
+        Vector3 corners[BoundingBox::CornerCount];
+        box.GetCorners(corners);
+
+        for(Vector3 const& corner : corners) {
             if (Contains(corner) == ContainmentType::Disjoint) {
                 inside = false;
                 break;
@@ -192,7 +391,8 @@ namespace Xna {
 
     ContainmentType BoundingSphere::Contains(BoundingFrustum const& frustum) const {
         bool inside = true;
-        auto corners = frustum.GetCorners();
+        Vector3 corners[BoundingFrustum::CornerCount];
+        frustum.GetCorners(corners);
 
         for(Vector3 const& corner : corners) {
             if (Contains(corner) == ContainmentType::Disjoint) {
@@ -267,6 +467,10 @@ namespace Xna {
         return result;
     }
 
+    bool BoundingSphere::Intersects(BoundingFrustum const& frustum, CullingMode mode) const {
+        return frustum.Intersects((*this), mode);
+    }
+
     PlaneIntersectionType BoundingSphere::Intersects(Plane const& plane) const {
         PlaneIntersectionType result;
 
@@ -299,6 +503,188 @@ namespace Xna {
         return sphere;
     }
 
+    size_t BoundingSphere::Intersects(std::vector<BoundingSphere> const& spheres, BoundingFrustum const& frustum, std::vector<byte>& result,
+        CullingMode mode) {
+
+        constexpr i32 planeCount = BoundingFrustum::PlaneCount;
+        const Plane planes[planeCount] = { frustum.Near(), frustum.Far(), frustum.Left(), frustum.Right(), frustum.Top(), frustum.Bottom() };
+        double nx[planeCount], ny[planeCount], nz[planeCount], d[planeCount];
+
+        for (i32 p = 0; p < planeCount; ++p) {
+            nx[p] = planes[p].Normal.X;
+            ny[p] = planes[p].Normal.Y;
+            nz[p] = planes[p].Normal.Z;
+            d[p] = planes[p].D;
+        }
+
+        const size_t count = spheres.size();
+        result.resize(count);
+        std::vector<size_t> hits(Parallel::ChunkCount(count, Parallel::DefaultChunkSize), 0);
+
+        Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            size_t found = 0;
+
+            for (size_t i = begin; i < end; ++i) {
+                const Vector3& c = spheres[i].Center;
+                double farthest = -std::numeric_limits<double>::max();
+
+                // All six planes, without branches; the largest distance decides.
+                for (i32 p = 0; p < planeCount; ++p) {
+                    const double distance = nx[p] * c.X + ny[p] * c.Y + nz[p] * c.Z + d[p];
+                    farthest = distance > farthest ? distance : farthest;
+                }
+
+                bool hit = farthest <= spheres[i].Radius;
+
+                // Only spheres whose center is outside can be near an edge or corner without touching the frustum.
+                if (hit && farthest > 0 && mode == CullingMode::Exact)
+                    hit = frustum.Intersects(spheres[i], CullingMode::Exact);
+
+                result[i] = hit ? 1 : 0;
+                found += hit ? 1 : 0;
+            }
+
+            hits[chunk] = found;
+        });
+
+        return std::accumulate(hits.begin(), hits.end(), size_t(0));
+    }
+
+    double BoundingSphere::Sweep(Vector3 const& motion, BoundingBox const& box) const {
+
+        if (box.Intersects((*this)))
+            return 0;
+
+        const double length = motion.Length();
+
+        if (length == 0)
+            return MathHelper::NaN;
+
+        // The center touches the box grown by the radius, with its edges and corners rounded.
+        // The slab test of the grown box finds the hit beside a face; beyond an edge or a corner it only
+        // tells which one, and the capsules around the edges that meet there give the hit.
+        const Ray ray(Center, motion / length);
+        const Vector3 grow(Radius);
+        double distance = ray.Intersects(BoundingBox(box.Min - grow, box.Max + grow));
+
+        if (!(distance <= length))
+            return MathHelper::NaN;
+
+        const Vector3 point = ray.Position + ray.Direction * distance;
+        Vector3 corner;
+        byte outside = 0;
+
+        for (i32 axis = 0; axis < 3; ++axis) {
+            const double value = axisOf(point, axis);
+            const double min = axisOf(box.Min, axis);
+            const double max = axisOf(box.Max, axis);
+
+            setAxis(corner, axis, value < min ? min : max);
+
+            if (value < min || value > max)
+                outside |= static_cast<byte>(1 << axis);
+        }
+
+        if (outside == 0 || (outside & (outside - 1)) == 0)
+            return distance / length;
+
+        distance = MathHelper::NaN;
+
+        // Beside an edge, the edge runs along the one axis inside the box; at a corner, the three edges meet.
+        for (i32 axis = 0; axis < 3; ++axis) {
+            if (outside != 7 && (outside & (1 << axis)) != 0)
+                continue;
+
+            Vector3 start = corner;
+            Vector3 end = corner;
+            setAxis(start, axis, axisOf(box.Min, axis));
+            setAxis(end, axis, axisOf(box.Max, axis));
+
+            const double edge = rayEdge(ray, start, end, axis, Radius);
+
+            if (std::isnan(distance) || edge < distance)
+                distance = edge;
+        }
+
+        return distance <= length ? distance / length : MathHelper::NaN;
+    }
+
+    double BoundingSphere::Sweep(Vector3 const& motion, BoundingSphere const& sphere) const {
+
+        if (Intersects(sphere))
+            return 0;
+
+        const double length = motion.Length();
+
+        if (length == 0)
+            return MathHelper::NaN;
+
+        const double distance = Ray(Center, motion / length).Intersects(BoundingSphere(sphere.Center, sphere.Radius + Radius));
+        return distance <= length ? distance / length : MathHelper::NaN;
+    }
+
+    double BoundingSphere::Sweep(Vector3 const& motion, Plane const& plane) const {
+
+        const double distance = plane.DotCoordinate(Center);
+
+        if (std::abs(distance) <= Radius)
+            return 0;
+
+        // The center must come within the radius of the plane from the side it starts on.
+        // Moving away or along the plane divides by zero or gives a negative time, which fails the range test.
+        const double speed = Vector3::Dot(plane.Normal, motion);
+        const double t = (distance > 0 ? distance - Radius : distance + Radius) / -speed;
+
+        return t >= 0 && t <= 1 ? t : MathHelper::NaN;
+    }
+
+    size_t BoundingSphere::Sweep(std::vector<BoundingSphere> const& spheres, std::vector<Vector3> const& motions, std::vector<BoundingBox> const& boxes,
+        std::vector<std::pair<u32, u32>> const& pairs, std::vector<double>& result) {
+
+        const size_t count = pairs.size();
+        result.resize(count);
+        std::vector<size_t> hits(Parallel::ChunkCount(count, Parallel::DefaultChunkSize), 0);
+
+        Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            size_t found = 0;
+
+            for (size_t i = begin; i < end; ++i) {
+                const u32 sphere = pairs[i].first;
+
+                result[i] = spheres[sphere].Sweep(motions[sphere], boxes[pairs[i].second]);
+                found += std::isnan(result[i]) ? 0 : 1;
+            }
+
+            hits[chunk] = found;
+        });
+
+        return std::accumulate(hits.begin(), hits.end(), size_t(0));
+    }
+
+    size_t BoundingSphere::Sweep(std::vector<BoundingSphere> const& spheres, std::vector<Vector3> const& motions,
+        std::vector<std::pair<u32, u32>> const& pairs, std::vector<double>& result) {
+
+        const size_t count = pairs.size();
+        result.resize(count);
+        std::vector<size_t> hits(Parallel::ChunkCount(count, Parallel::DefaultChunkSize), 0);
+
+        Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            size_t found = 0;
+
+            for (size_t i = begin; i < end; ++i) {
+                const u32 a = pairs[i].first;
+                const u32 b = pairs[i].second;
+
+                result[i] = spheres[a].Sweep(motions[a] - motions[b], spheres[b]);
+                found += std::isnan(result[i]) ? 0 : 1;
+            }
+
+            hits[chunk] = found;
+        });
+
+        return std::accumulate(hits.begin(), hits.end(), size_t(0));
+    }
+
     void BoundingSphere::Deconstruct(Vector3& center, double& radius) const{
         center = Center;
         radius = Radius;
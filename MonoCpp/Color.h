@@ -10,7 +10,7 @@ namespace Xna {
 
 	struct Color {		
 
-		Color(u32 packedValue);
+		constexpr Color(u32 packedValue);
 		Color(Vector4 color);
 		Color(Vector3 color);
 		Color(Color color, i32 alpha);
@@ -19,10 +19,10 @@ namespace Xna {
 		Color(double r, double g, double b, double alpha);
 		Color(i32 r, i32 g, i32 b);
 		Color(i32 r, i32 g, i32 b, i32 alpha);
-		Color(byte r, byte g, byte b, byte alpha);
+		constexpr Color(byte r, byte g, byte b, byte alpha);
 
-		friend bool operator ==(Color const& a, Color const& b);
-		friend bool operator !=(Color const& a, Color const& b);
+		friend constexpr bool operator ==(Color const& a, Color const& b);
+		friend constexpr bool operator !=(Color const& a, Color const& b);
 		friend Color operator *(Color const& value, double scale);
 		friend Color operator *(double scale, Color value);		
 
@@ -32,24 +32,24 @@ namespace Xna {
 		static Color FromNonPremultiplied(Vector4 const& vector);
 		static Color FromNonPremultiplied(i32 r, i32 g, i32 b, i32 a);
 
-		byte R() const;
+		constexpr byte R() const;
 		void R(byte value);
-		byte G() const;
+		constexpr byte G() const;
 		void G(byte value);
-		byte B() const;
+		constexpr byte B() const;
 		void B(byte value);
-		byte A() const;
+		constexpr byte A() const;
 		void A(byte value);
 
 		Vector3 ToVector3() const;
 		Vector4 ToVector4() const;
-		i32 PackedValue() const;
+		constexpr i32 PackedValue() const;
 		void PackedValue(i32 value);
 		void Deconstruct(byte& r, byte& g, byte& b) const;
 		void Deconstruct(byte& r, byte& g, byte& b, byte& a) const;
 		void Deconstruct(double& r, double& g, double& b) const;
 		void Deconstruct(double& r, double& g, double& b, double& a) const;
-		bool Equals(Color const& other) const;
+		constexpr bool Equals(Color const& other) const;
 
 		static const Color Transparent;
 		static const Color AliceBlue;
@@ -203,6 +203,191 @@ namespace Xna {
 		
 		void constructsRGBA(i32 r, i32 g, i32 b, i32 alpha);
 	};
+
+	constexpr Color::Color(u32 packedValue) : _packedValue(packedValue) {}
+
+	constexpr Color::Color(byte r, byte g, byte b, byte alpha) :
+		_packedValue(static_cast<u32>(alpha << 24)
+			| static_cast<u32>(b << 16)
+			| static_cast<u32>(g << 8)
+			| (r)) {}
+
+	constexpr bool operator ==(Color const& a, Color const& b) {
+		return a.Equals(b);
+	}
+
+	constexpr bool operator !=(Color const& a, Color const& b) {
+		return !a.Equals(b);
+	}
+
+	constexpr byte Color::R() const {
+		return static_cast<byte>(_packedValue);
+	}
+
+	constexpr byte Color::G() const {
+		return static_cast<byte>(_packedValue >> 8);
+	}
+
+	constexpr byte Color::B() const {
+		return static_cast<byte>(_packedValue >> 16);
+	}
+
+	constexpr byte Color::A() const {
+		return static_cast<byte>(_packedValue >> 24);
+	}
+
+	constexpr i32 Color::PackedValue() const {
+		return _packedValue;
+	}
+
+	constexpr bool Color::Equals(Color const& other) const {
+		return _packedValue == other._packedValue;
+	}
+
+	// Static const
+
+	inline constexpr Color Color::Transparent = Color(0);
+	inline constexpr Color Color::AliceBlue = Color(0xfffff8f0);
+	inline constexpr Color Color::AntiqueWhite = Color(0xffd7ebfa);
+	inline constexpr Color Color::Aqua = Color(0xffffff00);
+	inline constexpr Color Color::Aquamarine = Color(0xffd4ff7f);
+	inline constexpr Color Color::Azure = Color(0xfffffff0);
+	inline constexpr Color Color::Beige = Color(0xffdcf5f5);
+	inline constexpr Color Color::Bisque = Color(0xffc4e4ff);
+	inline constexpr Color Color::Black = Color(0xff000000);
+	inline constexpr Color Color::BlanchedAlmond = Color(0xffcdebff);
+	inline constexpr Color Color::Blue = Color(0xffff0000);
+	inline constexpr Color Color::BlueViolet = Color(0xffe22b8a);
+	inline constexpr Color Color::Brown = Color(0xff2a2aa5);
+	inline constexpr Color Color::BurlyWood = Color(0xff87b8de);
+	inline constexpr Color Color::CadetBlue = Color(0xffa09e5f);
+	inline constexpr Color Color::Chartreuse = Color(0xff00ff7f);
+	inline constexpr Color Color::Chocolate = Color(0xff1e69d2);
+	inline constexpr Color Color::Coral = Color(0xff507fff);
+	inline constexpr Color Color::CornflowerBlue = Color(0xffed9564);
+	inline constexpr Color Color::Cornsilk = Color(0xffdcf8ff);
+	inline constexpr Color Color::Crimson = Color(0xff3c14dc);
+	inline constexpr Color Color::Cyan = Color(0xffffff00);
+	inline constexpr Color Color::DarkBlue = Color(0xff8b0000);
+	inline constexpr Color Color::DarkCyan = Color(0xff8b8b00);
+	inline constexpr Color Color::DarkGoldenrod = Color(0xff0b86b8);
+	inline constexpr Color Color::DarkGray = Color(0xffa9a9a9);
+	inline constexpr Color Color::DarkGreen = Color(0xff006400);
+	inline constexpr Color Color::DarkKhaki = Color(0xff6bb7bd);
+	inline constexpr Color Color::DarkMagenta = Color(0xff8b008b);
+	inline constexpr Color Color::DarkOliveGreen = Color(0xff2f6b55);
+	inline constexpr Color Color::DarkOrange = Color(0xff008cff);
+	inline constexpr Color Color::DarkOrchid = Color(0xffcc3299);
+	inline constexpr Color Color::DarkRed = Color(0xff00008b);
+	inline constexpr Color Color::DarkSalmon = Color(0xff7a96e9);
+	inline constexpr Color Color::DarkSeaGreen = Color(0xff8bbc8f);
+	inline constexpr Color Color::DarkSlateBlue = Color(0xff8b3d48);
+	inline constexpr Color Color::DarkSlateGray = Color(0xff4f4f2f);
+	inline constexpr Color Color::DarkTurquoise = Color(0xffd1ce00);
+	inline constexpr Color Color::DarkViolet = Color(0xffd30094);
+	inline constexpr Color Color::DeepPink = Color(0xff9314ff);
+	inline constexpr Color Color::DeepSkyBlue = Color(0xffffbf00);
+	inline constexpr Color Color::DimGray = Color(0xff696969);
+	inline constexpr Color Color::DodgerBlue = Color(0xffff901e);
+	inline constexpr Color Color::Firebrick = Color(0xff2222b2);
+	inline constexpr Color Color::FloralWhite = Color(0xfff0faff);
+	inline constexpr Color Color::ForestGreen = Color(0xff228b22);
+	inline constexpr Color Color::Fuchsia = Color(0xffff00ff);
+	inline constexpr Color Color::Gainsboro = Color(0xffdcdcdc);
+	inline constexpr Color Color::GhostWhite = Color(0xfffff8f8);
+	inline constexpr Color Color::Gold = Color(0xff00d7ff);
+	inline constexpr Color Color::Goldenrod = Color(0xff20a5da);
+	inline constexpr Color Color::Gray = Color(0xff808080);
+	inline constexpr Color Color::Green = Color(0xff008000);
+	inline constexpr Color Color::GreenYellow = Color(0xff2fffad);
+	inline constexpr Color Color::Honeydew = Color(0xfff0fff0);
+	inline constexpr Color Color::HotPink = Color(0xffb469ff);
+	inline constexpr Color Color::IndianRed = Color(0xff5c5ccd);
+	inline constexpr Color Color::Indigo = Color(0xff82004b);
+	inline constexpr Color Color::Ivory = Color(0xfff0ffff);
+	inline constexpr Color Color::Khaki = Color(0xff8ce6f0);
+	inline constexpr Color Color::Lavender = Color(0xfffae6e6);
+	inline constexpr Color Color::LavenderBlush = Color(0xfff5f0ff);
+	inline constexpr Color Color::LawnGreen = Color(0xff00fc7c);
+	inline constexpr Color Color::LemonChiffon = Color(0xffcdfaff);
+	inline constexpr Color Color::LightBlue = Color(0xffe6d8ad);
+	inline constexpr Color Color::LightCoral = Color(0xff8080f0);
+	inline constexpr Color Color::LightCyan = Color(0xffffffe0);
+	inline constexpr Color Color::LightGoldenrodYellow = Color(0xffd2fafa);
+	inline constexpr Color Color::LightGray = Color(0xffd3d3d3);
+	inline constexpr Color Color::LightGreen = Color(0xff90ee90);
+	inline constexpr Color Color::LightPink = Color(0xffc1b6ff);
+	inline constexpr Color Color::LightSalmon = Color(0xff7aa0ff);
+	inline constexpr Color Color::LightSeaGreen = Color(0xffaab220);
+	inline constexpr Color Color::LightSkyBlue = Color(0xffface87);
+	inline constexpr Color Color::LightSlateGray = Color(0xff998877);
+	inline constexpr Color Color::LightSteelBlue = Color(0xffdec4b0);
+	inline constexpr Color Color::LightYellow = Color(0xffe0ffff);
+	inline constexpr Color Color::Lime = Color(0xff00ff00);
+	inline constexpr Color Color::LimeGreen = Color(0xff32cd32);
+	inline constexpr Color Color::Linen = Color(0xffe6f0fa);
+	inline constexpr Color Color::Magenta = Color(0xffff00ff);
+	inline constexpr Color Color::Maroon = Color(0xff000080);
+	inline constexpr Color Color::MediumAquamarine = Color(0xffaacd66);
+	inline constexpr Color Color::MediumBlue = Color(0xffcd0000);
+	inline constexpr Color Color::MediumOrchid = Color(0xffd355ba);
+	inline constexpr Color Color::MediumPurple = Color(0xffdb7093);
+	inline constexpr Color Color::MediumSeaGreen = Color(0xff71b33c);
+	inline constexpr Color Color::MediumSlateBlue = Color(0xffee687b);
+	inline constexpr Color Color::MediumSpringGreen = Color(0xff9afa00);
+	inline constexpr Color Color::MediumTurquoise = Color(0xffccd148);
+	inline constexpr Color Color::MediumVioletRed = Color(0xff8515c7);
+	inline constexpr Color Color::MidnightBlue = Color(0xff701919);
+	inline constexpr Color Color::MintCream = Color(0xfffafff5);
+	inline constexpr Color Color::MistyRose = Color(0xffe1e4ff);
+	inline constexpr Color Color::Moccasin = Color(0xffb5e4ff);
+	inline constexpr Color Color::MonoGameOrange = Color(0xff003ce7);
+	inline constexpr Color Color::NavajoWhite = Color(0xffaddeff);
+	inline constexpr Color Color::Navy = Color(0xff800000);
+	inline constexpr Color Color::OldLace = Color(0xffe6f5fd);
+	inline constexpr Color Color::Olive = Color(0xff008080);
+	inline constexpr Color Color::OliveDrab = Color(0xff238e6b);
+	inline constexpr Color Color::Orange = Color(0xff00a5ff);
+	inline constexpr Color Color::OrangeRed = Color(0xff0045ff);
+	inline constexpr Color Color::Orchid = Color(0xffd670da);
+	inline constexpr Color Color::PaleGoldenrod = Color(0xffaae8ee);
+	inline constexpr Color Color::PaleGreen = Color(0xff98fb98);
+	inline constexpr Color Color::PaleTurquoise = Color(0xffeeeeaf);
+	inline constexpr Color Color::PaleVioletRed = Color(0xff9370db);
+	inline constexpr Color Color::PapayaWhip = Color(0xffd5efff);
+	inline constexpr Color Color::PeachPuff = Color(0xffb9daff);
+	inline constexpr Color Color::Peru = Color(0xff3f85cd);
+	inline constexpr Color Color::Pink = Color(0xffcbc0ff);
+	inline constexpr Color Color::Plum = Color(0xffdda0dd);
+	inline constexpr Color Color::PowderBlue = Color(0xffe6e0b0);
+	inline constexpr Color Color::Purple = Color(0xff800080);
+	inline constexpr Color Color::Red = Color(0xff0000ff);
+	inline constexpr Color Color::RosyBrown = Color(0xff8f8fbc);
+	inline constexpr Color Color::RoyalBlue = Color(0xffe16941);
+	inline constexpr Color Color::SaddleBrown = Color(0xff13458b);
+	inline constexpr Color Color::Salmon = Color(0xff7280fa);
+	inline constexpr Color Color::SandyBrown = Color(0xff60a4f4);
+	inline constexpr Color Color::SeaGreen = Color(0xff578b2e);
+	inline constexpr Color Color::SeaShell = Color(0xffeef5ff);
+	inline constexpr Color Color::Sienna = Color(0xff2d52a0);
+	inline constexpr Color Color::Silver = Color(0xffc0c0c0);
+	inline constexpr Color Color::SkyBlue = Color(0xffebce87);
+	inline constexpr Color Color::SlateBlue = Color(0xffcd5a6a);
+	inline constexpr Color Color::SlateGray = Color(0xff908070);
+	inline constexpr Color Color::Snow = Color(0xfffafaff);
+	inline constexpr Color Color::SpringGreen = Color(0xff7fff00);
+	inline constexpr Color Color::SteelBlue = Color(0xffb48246);
+	inline constexpr Color Color::Tan = Color(0xff8cb4d2);
+	inline constexpr Color Color::Teal = Color(0xff808000);
+	inline constexpr Color Color::Thistle = Color(0xffd8bfd8);
+	inline constexpr Color Color::Tomato = Color(0xff4763ff);
+	inline constexpr Color Color::Turquoise = Color(0xffd0e040);
+	inline constexpr Color Color::Violet = Color(0xffee82ee);
+	inline constexpr Color Color::Wheat = Color(0xffb3def5);
+	inline constexpr Color Color::White = Color(std::numeric_limits<u32>::max());
+	inline constexpr Color Color::WhiteSmoke = Color(0xfff5f5f5);
+	inline constexpr Color Color::Yellow = Color(0xff00ffff);
+	inline constexpr Color Color::YellowGreen = Color(0xff32cd9a);
 }
 
 #endif
\ No newline at end of file
@@ -31,6 +31,10 @@ namespace Xna {
 		return _keys;
 	}
 
+	CurveKeyCollection const& Curve::Keys() const {
+		return _keys;
+	}
+
 	Curve Curve::Clone() const {
 		Curve curve;
 		curve._keys = _keys.Clone();
@@ -40,7 +44,11 @@ namespace Xna {
 		return curve;
 	}
 
-	double Curve::Evaluate(double position) {
+	std::shared_ptr<Curve const> Curve::Freeze() const {
+		return std::make_shared<Curve const>(Clone());
+	}
+
+	double Curve::Evaluate(double position) const {
         if (_keys.Count() == 0) {
             return 0.;
         }
@@ -49,8 +57,8 @@ namespace Xna {
             return _keys.Get(0).Value();
         }
 
-        CurveKey first = _keys.Get(0);
-        CurveKey last = _keys.Get(_keys.Count() - 1);
+        CurveKey const& first = _keys.Get(0);
+        CurveKey const& last = _keys.Get(_keys.Count() - 1);
         i32 cycle = GetNumberOfCycle(position);
         double virtualPos = 0.0;
 
@@ -192,7 +200,7 @@ namespace Xna {
     // Private
         // Members
 
-    i32 Curve::GetNumberOfCycle(double position) {
+    i32 Curve::GetNumberOfCycle(double position) const {
         double cycle = (position - _keys.Get(0).Position())
             / (_keys.Get(_keys.Count() - 1).Position() - _keys.Get(0).Position());
         
@@ -203,12 +211,10 @@ namespace Xna {
         return static_cast<i32>(cycle);
     }
 
-    double Curve::GetCurvePosition(double position) {
-        CurveKey prev = _keys.Get(0);
-        CurveKey next;
-
-        for (i32 i = 1; i < _keys.Count(); ++i) {
-            next = _keys.Get(i);
+    double Curve::GetCurvePosition(double position) const {
+        for (size_t i = 1; i < _keys.Count(); ++i) {
+            CurveKey const& prev = _keys.Get(i - 1);
+            CurveKey const& next = _keys.Get(i);
 
             if (next.Position() >= position)
             {
@@ -226,7 +232,6 @@ namespace Xna {
                 
                 return (2 * tss - 3 * ts + 1.) * prev.Value() + (tss - 2 * ts + t) * prev.TangentOut() + (3 * ts - 2 * tss) * next.Value() + (tss - ts) * next.TangentIn();
             }
-            prev = next;
         }
         
         return 0.;
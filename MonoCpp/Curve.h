@@ -1,6 +1,8 @@
 #ifndef CURVE_H
 #define CURVE_H
 
+#include <memory>
+#include <memory_resource>
 #include <vector>
 #include "CSharp.h"
 
@@ -122,10 +124,15 @@ namespace Xna {
 
 		//IEnumerator IEnumerable.GetEnumerator()		
 		CurveKey& Get(size_t index);
+		CurveKey const& Get(size_t index) const;
 		void Set(size_t index, CurveKey value);
 		void Add(CurveKey const& item);
 		void Clear();
 		CurveKeyCollection Clone() const;
+		// Copies the keys to another collection, reusing its storage.
+		void Clone(CurveKeyCollection& result) const;
+		// Copies the keys to an array allocated from the resource.
+		std::pmr::vector<CurveKey> Clone(std::pmr::memory_resource* resource) const;
 		bool Contains(CurveKey item);
 		void CopyTo(std::vector<CurveKey>& vec, i32 vecIndex) const;
 		//IEnumerator<CurveKey> GetEnumerator()
@@ -138,6 +145,8 @@ namespace Xna {
 		std::vector<CurveKey>::const_iterator End() const;
 	};
 	
+	// Evaluation only reads the keys, so a curve that is no longer modified can be evaluated
+	// from any number of threads at once. Freeze makes such a curve to share between them.
 	class Curve {
 
 		CurveLoopType _preLoop;
@@ -154,17 +163,21 @@ namespace Xna {
 		CurveLoopType PostLoop() const;
 		void PostLoop(CurveLoopType value);
 		CurveKeyCollection& Keys();
+		CurveKeyCollection const& Keys() const;
 
 		Curve Clone() const;
-		double Evaluate(double position);
+		// Returns an immutable copy of this curve, which can be shared and evaluated concurrently
+		// without copies or locks. Later changes to this curve do not affect it.
+		std::shared_ptr<Curve const> Freeze() const;
+		double Evaluate(double position) const;
 		void ComputeTangents(CurveTangent tangentType);
 		void ComputeTangents(CurveTangent tangentInType, CurveTangent tangentOutType);
 		void ComputeTangent(size_t keyIndex, CurveTangent tangentType);
 		void ComputeTangent(size_t keyIndex, CurveTangent tangentInType, CurveTangent tangentOutType);
 
 	private:
-		i32 GetNumberOfCycle(double position);
-		double GetCurvePosition(double position);
+		i32 GetNumberOfCycle(double position) const;
+		double GetCurvePosition(double position) const;
 	};
 }
 
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "Curve.h"
 
 namespace Xna {
@@ -16,6 +17,10 @@ namespace Xna {
 		return _keys[index];
 	}
 
+	CurveKey const& CurveKeyCollection::Get(size_t index) const {
+		return _keys[index];
+	}
+
 	void CurveKeyCollection::Set(size_t index, CurveKey value) {
 		if (index >= _keys.size())
 			return;
@@ -59,6 +64,14 @@ namespace Xna {
 		return CurveKeyCollection((*this));
 	}
 
+	void CurveKeyCollection::Clone(CurveKeyCollection& result) const {
+		result._keys.assign(_keys.begin(), _keys.end());
+	}
+
+	std::pmr::vector<CurveKey> CurveKeyCollection::Clone(std::pmr::memory_resource* resource) const {
+		return std::pmr::vector<CurveKey>(_keys.begin(), _keys.end(), resource);
+	}
+
 	bool CurveKeyCollection::Contains(CurveKey item) {
 		return std::find(_keys.begin(), _keys.end(), item) != _keys.end();
 		//return false;
@@ -0,0 +1,133 @@
+#include <utility>
+#include "DirtyRegion.h"
+
+namespace Xna {
+
+	// Past this share of the surface, one full present is cheaper than many partial ones.
+	static constexpr double FullAreaRatio = 0.75;
+
+	static i64 areaOf(Rectangle const& rectangle) {
+		return static_cast<i64>(rectangle.Width) * rectangle.Height;
+	}
+
+	static i64 areaOf(RectangleStream const& rectangles) {
+		i64 area = 0;
+
+		for (size_t i = 0; i < rectangles.Count(); ++i)
+			area += static_cast<i64>(rectangles.Width[i]) * rectangles.Height[i];
+
+		return area;
+	}
+
+	DirtyRegion::DirtyRegion(Rectangle const& bounds, size_t maxRectangles) :
+		_bounds(bounds), _maxRectangles(maxRectangles < 1 ? 1 : maxRectangles), _full(true), _merged(false), _fullSeconds(0) {
+		// Merging never yields more rectangles than it is given, so this is all either stream ever holds.
+		_areas.Reserve(areaCapacity());
+		_rectangles.Reserve(areaCapacity());
+	}
+
+	Rectangle DirtyRegion::Bounds() const {
+		return _bounds;
+	}
+
+	void DirtyRegion::Bounds(Rectangle const& value) {
+		_bounds = value;
+		InvalidateAll();
+	}
+
+	void DirtyRegion::Invalidate(Rectangle const& area) {
+		if (_full)
+			return;
+
+		const Rectangle clipped = Rectangle::Intersects(area, _bounds);
+
+		if (clipped.Width <= 0 || clipped.Height <= 0)
+			return;
+
+		_merged = false;
+
+		if (_areas.Count() == areaCapacity()) {
+			RectangleStream::Merge(_areas, _rectangles);
+			std::swap(_areas, _rectangles);
+
+			if (_areas.Count() > _maxRectangles) {
+				_full = true;
+				_areas.Resize(0);
+				return;
+			}
+		}
+
+		_areas.Add(clipped);
+	}
+
+	void DirtyRegion::InvalidateAll() {
+		_full = true;
+		_areas.Resize(0);
+		_merged = false;
+	}
+
+	bool DirtyRegion::IsDirty() {
+		return _full || _areas.Count() > 0;
+	}
+
+	bool DirtyRegion::IsFull() {
+		merge();
+		return _full;
+	}
+
+	RectangleStream const& DirtyRegion::Rectangles() {
+		merge();
+		return _rectangles;
+	}
+
+	i64 DirtyRegion::Area() {
+		merge();
+		return areaOf(_rectangles);
+	}
+
+	PresentStatistics DirtyRegion::Presented(double seconds) {
+		PresentStatistics statistics;
+		statistics.Full = IsFull();
+		statistics.Rectangles = _rectangles.Count();
+		statistics.Pixels = Area();
+		statistics.Seconds = seconds;
+		statistics.SavedSeconds = 0;
+
+		if (statistics.Full)
+			_fullSeconds = seconds;
+		else if (_fullSeconds > seconds)
+			statistics.SavedSeconds = _fullSeconds - seconds;
+
+		_full = false;
+		_areas.Resize(0);
+		_merged = false;
+
+		return statistics;
+	}
+
+	// Private
+
+	void DirtyRegion::merge() {
+		if (_merged)
+			return;
+
+		_merged = true;
+
+		if (!_full) {
+			RectangleStream::Merge(_areas, _rectangles);
+			_full = _rectangles.Count() > _maxRectangles || areaOf(_rectangles) >= areaOf(_bounds) * FullAreaRatio;
+		}
+
+		if (_full) {
+			_areas.Resize(0);
+			_rectangles.Resize(0);
+
+			if (_bounds.Width > 0 && _bounds.Height > 0)
+				_rectangles.Add(_bounds);
+		}
+	}
+
+	size_t DirtyRegion::areaCapacity() const {
+		return 2 * _maxRectangles;
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef DIRTYREGION_H
+#define DIRTYREGION_H
+
+#include "CSharp.h"
+#include "Structs.h"
+#include "Streams.h"
+
+namespace Xna {
+
+	// What presenting one frame cost, and an estimate of what a partial present saved.
+	struct PresentStatistics {
+		// Whether the whole surface was presented.
+		bool Full;
+		// The number of rectangles presented.
+		size_t Rectangles;
+		// The number of pixels presented.
+		i64 Pixels;
+		// The time the present took.
+		double Seconds;
+		// The time of the last full present minus this one, or 0 for a full present.
+		double SavedSeconds;
+	};
+
+	// Tracks the areas of a surface that changed since the last present and coalesces them
+	// into a few non-overlapping rectangles, so a mostly static screen only pushes what moved.
+	// When the areas are too many or cover most of the surface, the whole surface is presented instead.
+	struct DirtyRegion {
+
+		// bounds: the surface. maxRectangles: beyond this many coalesced rectangles, the whole surface is presented.
+		// The region starts fully invalid.
+		DirtyRegion(Rectangle const& bounds, size_t maxRectangles = 16);
+
+		Rectangle Bounds() const;
+		// Changes the surface and invalidates all of it.
+		void Bounds(Rectangle const& value);
+
+		// Marks an area as changed. Areas outside the surface are ignored.
+		void Invalidate(Rectangle const& area);
+		// Marks the whole surface as changed.
+		void InvalidateAll();
+		// Gets whether anything changed since the last present.
+		bool IsDirty();
+		// Gets whether the whole surface must be presented.
+		bool IsFull();
+
+		// The coalesced rectangles to present, or the bounds alone when the region is full.
+		RectangleStream const& Rectangles();
+		// The number of pixels covered by Rectangles.
+		i64 Area();
+
+		// Clears the region after a present that took the given time and returns its statistics.
+		// Full presents calibrate the cost partial presents are compared against.
+		PresentStatistics Presented(double seconds);
+
+	private:
+		Rectangle _bounds;
+		size_t _maxRectangles;
+		bool _full;
+		// Invalidated areas since the last present, clipped to the bounds.
+		// At areaCapacity() of them they are merged in place, so neither stream grows after construction.
+		RectangleStream _areas;
+		// _areas merged, valid while _merged is true.
+		RectangleStream _rectangles;
+		bool _merged;
+		double _fullSeconds;
+
+		void merge();
+		size_t areaCapacity() const;
+	};
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include "FrameArena.h"
+
+namespace Xna {
+
+	static constexpr size_t BlockAlignment = alignof(std::max_align_t);
+
+	FrameArena::FrameArena(size_t capacity, std::pmr::memory_resource* upstream) :
+		_upstream(upstream), _block(nullptr), _capacity(capacity), _offset(0), _used(0), _overflows(0) {
+
+		if (_capacity > 0)
+			_block = static_cast<byte*>(_upstream->allocate(_capacity, BlockAlignment));
+	}
+
+	FrameArena::~FrameArena() {
+		Reset();
+
+		if (_block != nullptr)
+			_upstream->deallocate(_block, _capacity, BlockAlignment);
+	}
+
+	void FrameArena::Reset() {
+		if (!_extra.empty()) {
+			for (Block const& block : _extra)
+				_upstream->deallocate(block.Data, block.Size, BlockAlignment);
+
+			_extra.clear();
+
+			// Grow to what the last frame needed, so the next one fits in a single block.
+			if (_block != nullptr)
+				_upstream->deallocate(_block, _capacity, BlockAlignment);
+
+			_capacity = _used * 2;
+			_block = static_cast<byte*>(_upstream->allocate(_capacity, BlockAlignment));
+		}
+
+		_offset = 0;
+		_used = 0;
+	}
+
+	size_t FrameArena::Used() const {
+		return _used;
+	}
+
+	size_t FrameArena::Capacity() const {
+		return _capacity;
+	}
+
+	size_t FrameArena::Overflows() const {
+		return _overflows;
+	}
+
+	void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+		const size_t base = reinterpret_cast<size_t>(_block);
+		const size_t aligned = ((base + _offset + alignment - 1) & ~(alignment - 1)) - base;
+
+		if (_block != nullptr && aligned + bytes <= _capacity) {
+			_used += aligned + bytes - _offset;
+			_offset = aligned + bytes;
+			return _block + aligned;
+		}
+
+		const size_t alignedSize = bytes + (alignment > BlockAlignment ? alignment : 0);
+		void* data = _upstream->allocate(alignedSize, BlockAlignment);
+		_extra.push_back(Block{ data, alignedSize });
+		_used += alignedSize;
+		++_overflows;
+
+		const size_t address = reinterpret_cast<size_t>(data);
+		return reinterpret_cast<void*>((address + alignment - 1) & ~(alignment - 1));
+	}
+
+	void FrameArena::do_deallocate(void*, size_t, size_t) {
+	}
+
+	bool FrameArena::do_is_equal(std::pmr::memory_resource const& other) const noexcept {
+		return this == &other;
+	}
+}
@@ -0,0 +1,55 @@
+#ifndef FRAMEARENA_H
+#define FRAMEARENA_H
+
+#include <memory_resource>
+#include <vector>
+#include "CSharp.h"
+
+namespace Xna {
+
+	// A linear allocator for memory that lives for one frame, for the std::pmr overloads of the engine.
+	// Allocations bump a pointer in one block and deallocations do nothing; Reset releases everything at once.
+	// A frame that outgrows the block takes extra blocks from the upstream resource, and the next Reset
+	// replaces them with one block large enough for that frame, so a steady frame loop stops allocating.
+	// Not thread-safe: use one arena per thread.
+	struct FrameArena : std::pmr::memory_resource {
+
+		// capacity: the initial size of the block in bytes.
+		FrameArena(size_t capacity = 1 << 20, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+		~FrameArena();
+
+		FrameArena(FrameArena const&) = delete;
+		FrameArena& operator =(FrameArena const&) = delete;
+
+		// Releases every allocation, to be called at the start of each frame.
+		void Reset();
+		// Returns the number of bytes allocated since the last Reset.
+		size_t Used() const;
+		// Returns the size of the block.
+		size_t Capacity() const;
+		// Returns how many times a frame outgrew the block and the upstream resource was used.
+		size_t Overflows() const;
+
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override;
+		void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+		bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override;
+
+	private:
+		struct Block {
+			void* Data;
+			size_t Size;
+		};
+
+		std::pmr::memory_resource* _upstream;
+		byte* _block;
+		size_t _capacity;
+		size_t _offset;
+		size_t _used;
+		size_t _overflows;
+		// Blocks taken from upstream when the frame outgrew _block.
+		std::vector<Block> _extra;
+	};
+}
+
+#endif
@@ -2,8 +2,6 @@
 
 namespace Xna {
 
-	static const std::vector<Keys> empty;
-
 	KeyboardState::KeyboardState() {}
 
 	KeyboardState::KeyboardState(std::vector<Keys>& keys, bool capsLock, bool numLock) {
@@ -52,82 +50,22 @@ namespace Xna {
 	}
 
 	std::vector<Keys> KeyboardState::GetPressedKeys() {
-		u32 count = CountBits(_keys0) + CountBits(_keys1)
-			+ CountBits(_keys2) + CountBits(_keys3)
-			+ CountBits(_keys4) + CountBits(_keys5)
-			+ CountBits(_keys6) + CountBits(_keys7);
-
-		if (count == 0) {
-			return empty;
-		}
-
-		std::vector<Keys> keys(count);
-
-		i32 index = 0;
-		if (_keys0 != 0)
-			index = AddKeysToArray(_keys0, 0 * 32, keys, index);
-
-		if (_keys1 != 0)
-			index = AddKeysToArray(_keys1, 1 * 32, keys, index);
-
-		if (_keys2 != 0)
-			index = AddKeysToArray(_keys2, 2 * 32, keys, index);
-
-		if (_keys3 != 0)
-			index = AddKeysToArray(_keys3, 3 * 32, keys, index);
-
-		if (_keys4 != 0)
-			index = AddKeysToArray(_keys4, 4 * 32, keys, index);
-
-		if (_keys5 != 0)
-			index = AddKeysToArray(_keys5, 5 * 32, keys, index);
-
-		if (_keys6 != 0)
-			index = AddKeysToArray(_keys6, 6 * 32, keys, index);
-
-		if (_keys7 != 0)
-			index = AddKeysToArray(_keys7, 7 * 32, keys, index);
+		std::vector<Keys> keys(GetPressedKeyCount());
+		AddPressedKeys(keys.data());
 
 		return keys;
 	}
 
-	void KeyboardState::GetPressedKeys(std::vector<Keys> keys) {
+	std::pmr::vector<Keys> KeyboardState::GetPressedKeys(std::pmr::memory_resource* resource) {
+		std::pmr::vector<Keys> keys(GetPressedKeyCount(), resource);
+		AddPressedKeys(keys.data());
 
-		u32 count = CountBits(_keys0) + CountBits(_keys1)
-			+ CountBits(_keys2) + CountBits(_keys3)
-			+ CountBits(_keys4) + CountBits(_keys5)
-			+ CountBits(_keys6) + CountBits(_keys7);
-
-		if (count > keys.size()) {
-			return;
-		}
-
-		i32 index = 0;
-		size_t size = keys.size();
-
-		if (_keys0 != 0 && index < size)
-			index = AddKeysToArray(_keys0, 0 * 32, keys, index);
-
-		if (_keys1 != 0 && index < size)
-			index = AddKeysToArray(_keys1, 1 * 32, keys, index);
-
-		if (_keys2 != 0 && index < size)
-			index = AddKeysToArray(_keys2, 2 * 32, keys, index);
-
-		if (_keys3 != 0 && index < size)
-			index = AddKeysToArray(_keys3, 3 * 32, keys, index);
-
-		if (_keys4 != 0 && index < size)
-			index = AddKeysToArray(_keys4, 4 * 32, keys, index);
-
-		if (_keys5 != 0 && index < size)
-			index = AddKeysToArray(_keys5, 5 * 32, keys, index);
-
-		if (_keys6 != 0 && index < size)
-			index = AddKeysToArray(_keys6, 6 * 32, keys, index);
+		return keys;
+	}
 
-		if (_keys7 != 0 && index < size)
-			index = AddKeysToArray(_keys7, 7 * 32, keys, index);
+	void KeyboardState::GetPressedKeys(std::vector<Keys>& keys) {
+		keys.resize(GetPressedKeyCount());
+		AddPressedKeys(keys.data());
 	}
 
 	void KeyboardState::InternalSetKey(Keys const& key) {
@@ -223,7 +161,7 @@ namespace Xna {
 		return ((v + (v >> 4) & 0xF0F0F0F) * 0x1010101) >> 24;
 	}
 
-	i32 KeyboardState::AddKeysToArray(u32 keys, i32 offset, std::vector<Keys>& pressedKeys, size_t index) {
+	i32 KeyboardState::AddKeysToArray(u32 keys, i32 offset, Keys* pressedKeys, size_t index) {
 		for (size_t i = 0; i < 32; i++)
 		{
 			if ((keys & (1 << i)) != 0) {
@@ -234,6 +172,34 @@ namespace Xna {
 		return static_cast<i32>(index);
 	}
 
+	void KeyboardState::AddPressedKeys(Keys* pressedKeys) {
+		i32 index = 0;
+
+		if (_keys0 != 0)
+			index = AddKeysToArray(_keys0, 0 * 32, pressedKeys, index);
+
+		if (_keys1 != 0)
+			index = AddKeysToArray(_keys1, 1 * 32, pressedKeys, index);
+
+		if (_keys2 != 0)
+			index = AddKeysToArray(_keys2, 2 * 32, pressedKeys, index);
+
+		if (_keys3 != 0)
+			index = AddKeysToArray(_keys3, 3 * 32, pressedKeys, index);
+
+		if (_keys4 != 0)
+			index = AddKeysToArray(_keys4, 4 * 32, pressedKeys, index);
+
+		if (_keys5 != 0)
+			index = AddKeysToArray(_keys5, 5 * 32, pressedKeys, index);
+
+		if (_keys6 != 0)
+			index = AddKeysToArray(_keys6, 6 * 32, pressedKeys, index);
+
+		if (_keys7 != 0)
+			index = AddKeysToArray(_keys7, 7 * 32, pressedKeys, index);
+	}
+
 	bool KeyboardState::InternalGetKey(Keys key) {
 		u32 mask = static_cast<u32>(1) << (static_cast<i32>(key) & 0x1f);
 
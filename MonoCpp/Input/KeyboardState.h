@@ -1,6 +1,7 @@
 #ifndef KEYBOARDSTATE_H
 #define KEYBOARDSTATE_H
 
+#include <memory_resource>
 #include <vector>
 #include "../CSharp.h"
 #include "Keys.h"
@@ -24,7 +25,11 @@ namespace Xna {
 		bool IsKeyUp(Keys key);
 		int GetPressedKeyCount();
 		std::vector<Keys> GetPressedKeys();
-		void GetPressedKeys(std::vector<Keys> keys);
+		// Returns the pressed keys, allocated from the resource.
+		std::pmr::vector<Keys> GetPressedKeys(std::pmr::memory_resource* resource);
+		// Fills the array with the pressed keys, resizing it to their count.
+		// Reusing the array across frames allocates only when more keys are pressed than before.
+		void GetPressedKeys(std::vector<Keys>& keys);
 
 		void InternalSetKey(Keys const& key);
 		void InternalClearKey(Keys const& key);
@@ -47,7 +52,8 @@ namespace Xna {
 		byte _modifiers;
 
 		static u32 CountBits(u32 v);
-		static i32 AddKeysToArray(u32 keys, i32 offset, std::vector<Keys>& pressedKeys, size_t index);
+		static i32 AddKeysToArray(u32 keys, i32 offset, Keys* pressedKeys, size_t index);
+		void AddPressedKeys(Keys* pressedKeys);
 
 		bool InternalGetKey(Keys key);
 	};
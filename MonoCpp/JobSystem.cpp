@@ -0,0 +1,252 @@
+#include "JobSystem.h"
+
+namespace Xna {
+
+	// The system and queue of the current thread, when it is a worker.
+	static thread_local JobSystem const* currentSystem = nullptr;
+	static thread_local size_t currentQueue = 0;
+
+	JobCounter::JobCounter() :
+		_count(0) {}
+
+	bool JobCounter::IsDone() const {
+		return _count.load() == 0;
+	}
+
+	JobSystem::JobSystem(size_t workers) :
+		_pending(0), _stopping(false) {
+
+		for (size_t i = 0; i <= workers; ++i)
+			_queues.push_back(std::make_unique<Queue>());
+
+		_workers.reserve(workers);
+
+		for (size_t i = 0; i < workers; ++i)
+			_workers.emplace_back(&JobSystem::work, this, i);
+	}
+
+	JobSystem::~JobSystem() {
+		_stopping = true;
+
+		{
+			std::lock_guard<std::mutex> lock(_sleepMutex);
+		}
+
+		_wake.notify_all();
+
+		for (std::thread& worker : _workers)
+			worker.join();
+	}
+
+	JobSystem& JobSystem::Shared() {
+		static JobSystem system(std::thread::hardware_concurrency() > 1 ? std::thread::hardware_concurrency() - 1 : 0);
+		return system;
+	}
+
+	size_t JobSystem::WorkerCount() const {
+		return _workers.size();
+	}
+
+	void JobSystem::Run(std::function<void()> job, JobCounter* counter) {
+		if (counter != nullptr)
+			++counter->_count;
+
+		push(Job{ std::move(job), counter });
+	}
+
+	void JobSystem::Run(std::function<void()> job, JobCounter& dependency, JobCounter* counter) {
+		if (counter != nullptr)
+			++counter->_count;
+
+		{
+			std::lock_guard<std::mutex> lock(dependency._mutex);
+
+			if (dependency._count.load() != 0) {
+				dependency._continuations.emplace_back(std::move(job), counter);
+				return;
+			}
+		}
+
+		push(Job{ std::move(job), counter });
+	}
+
+	void JobSystem::Wait(JobCounter& counter) {
+		while (true) {
+			// Checked under the counter's lock, so the counter can be destroyed once this returns.
+			{
+				std::lock_guard<std::mutex> lock(counter._mutex);
+
+				if (counter._count.load() == 0)
+					return;
+			}
+
+			if (runOne())
+				continue;
+
+			// Nothing to run, so the rest of the counted jobs run on other threads: sleep until one of them
+			// finishes the group or schedules more work.
+			std::unique_lock<std::mutex> lock(_sleepMutex);
+			_wake.wait(lock, [this, &counter]() { return counter._count.load() == 0 || _pending.load() > 0; });
+
+			// The wake-up of a scheduled job may have been meant for a worker, so pass it on when this thread leaves.
+			if (counter._count.load() == 0 && _pending.load() > 0)
+				_wake.notify_one();
+		}
+	}
+
+	size_t JobSystem::ChunkCount(size_t count, size_t minChunkSize) const {
+		const size_t most = (_workers.size() + 1) * ChunksPerThread;
+
+		if (minChunkSize == 0)
+			minChunkSize = 1;
+
+		const size_t chunks = count / minChunkSize;
+		return chunks < 1 ? 1 : (chunks < most ? chunks : most);
+	}
+
+	void JobSystem::For(size_t count, size_t minChunkSize, std::function<void(size_t, size_t, size_t)> const& body) {
+		const size_t chunks = ChunkCount(count, minChunkSize);
+
+		if (chunks == 1) {
+			body(0, 0, count);
+			return;
+		}
+
+		// Chunk jobs capture only the range and their index, small enough for std::function to store without allocating.
+		struct Range {
+			std::function<void(size_t, size_t, size_t)> const* Body;
+			size_t Count;
+			size_t Chunks;
+		};
+
+		const Range range{ &body, count, chunks };
+		JobCounter counter;
+
+		for (size_t i = 1; i < chunks; ++i)
+			Run([&range, i]() { (*range.Body)(i, range.Count * i / range.Chunks, range.Count * (i + 1) / range.Chunks); }, &counter);
+
+		body(0, 0, count / chunks);
+		Wait(counter);
+	}
+
+	// Private
+
+	void JobSystem::push(Job job) {
+		Queue& queue = *_queues[currentSystem == this ? currentQueue : _queues.size() - 1];
+
+		{
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+
+			if (queue.Count == queue.Jobs.size()) {
+				std::vector<Job> jobs(queue.Jobs.empty() ? 16 : queue.Jobs.size() * 2);
+
+				for (size_t i = 0; i < queue.Count; ++i)
+					jobs[i] = std::move(queue.Jobs[(queue.Head + i) % queue.Jobs.size()]);
+
+				queue.Jobs.swap(jobs);
+				queue.Head = 0;
+			}
+
+			queue.Jobs[(queue.Head + queue.Count) % queue.Jobs.size()] = std::move(job);
+			++queue.Count;
+		}
+
+		++_pending;
+
+		// Taking the lock orders this wake-up after a worker's check for pending jobs.
+		{
+			std::lock_guard<std::mutex> lock(_sleepMutex);
+		}
+
+		_wake.notify_one();
+	}
+
+	bool JobSystem::pop(size_t index, Job& job) {
+		Queue& queue = *_queues[index];
+		std::lock_guard<std::mutex> lock(queue.Mutex);
+
+		if (queue.Count == 0)
+			return false;
+
+		--queue.Count;
+		job = std::move(queue.Jobs[(queue.Head + queue.Count) % queue.Jobs.size()]);
+
+		return true;
+	}
+
+	bool JobSystem::steal(size_t thief, Job& job) {
+		const size_t count = _queues.size();
+
+		for (size_t i = 1; i < count; ++i) {
+			Queue& queue = *_queues[(thief + i) % count];
+			std::lock_guard<std::mutex> lock(queue.Mutex);
+
+			if (queue.Count == 0)
+				continue;
+
+			job = std::move(queue.Jobs[queue.Head]);
+			queue.Head = (queue.Head + 1) % queue.Jobs.size();
+			--queue.Count;
+
+			return true;
+		}
+
+		return false;
+	}
+
+	bool JobSystem::runOne() {
+		const size_t queue = currentSystem == this ? currentQueue : _queues.size() - 1;
+		Job job;
+
+		if (!pop(queue, job) && !steal(queue, job))
+			return false;
+
+		--_pending;
+		job.Work();
+		finish(job.Counter);
+
+		return true;
+	}
+
+	void JobSystem::finish(JobCounter* counter) {
+		if (counter == nullptr)
+			return;
+
+		std::vector<std::pair<std::function<void()>, JobCounter*>> continuations;
+
+		{
+			std::lock_guard<std::mutex> lock(counter->_mutex);
+
+			if (--counter->_count != 0)
+				return;
+
+			continuations.swap(counter->_continuations);
+		}
+
+		for (auto& continuation : continuations)
+			push(Job{ std::move(continuation.first), continuation.second });
+
+		// Taking the lock orders this wake-up after a waiting thread's check of the counter.
+		{
+			std::lock_guard<std::mutex> lock(_sleepMutex);
+		}
+
+		_wake.notify_all();
+	}
+
+	void JobSystem::work(size_t index) {
+		currentSystem = this;
+		currentQueue = index;
+
+		while (true) {
+			if (runOne())
+				continue;
+
+			std::unique_lock<std::mutex> lock(_sleepMutex);
+			_wake.wait(lock, [this]() { return _stopping.load() || _pending.load() > 0; });
+
+			if (_stopping.load() && _pending.load() == 0)
+				return;
+		}
+	}
+}
@@ -0,0 +1,106 @@
+#ifndef JOBSYSTEM_H
+#define JOBSYSTEM_H
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "CSharp.h"
+
+namespace Xna {
+
+	struct JobSystem;
+
+	// Counts the unfinished jobs of a group. Jobs can be made to wait for a counter to reach zero,
+	// which is how dependencies between groups are expressed.
+	// A counter must outlive its jobs and must not be reused while jobs still wait on it.
+	struct JobCounter {
+
+		JobCounter();
+
+		// Gets whether every job counted has finished.
+		bool IsDone() const;
+
+	private:
+		friend struct JobSystem;
+
+		std::atomic<i64> _count;
+		std::mutex _mutex;
+		// Jobs to schedule once the count reaches zero.
+		std::vector<std::pair<std::function<void()>, JobCounter*>> _continuations;
+	};
+
+	// A pool of worker threads, each with its own deque of jobs. A worker runs its newest job first
+	// and, when its deque is empty, steals the oldest job of another worker.
+	// Threads that wait for jobs run pending jobs meanwhile, so jobs may wait for other jobs.
+	struct JobSystem {
+
+		// workers: the number of worker threads, besides the threads that submit and wait.
+		// Zero runs every job on the waiting threads.
+		JobSystem(size_t workers);
+		~JobSystem();
+
+		JobSystem(JobSystem const&) = delete;
+		JobSystem& operator =(JobSystem const&) = delete;
+
+		// The system shared by the engine, with one worker per hardware thread besides the caller's.
+		// Created on first use and stopped at exit.
+		static JobSystem& Shared();
+
+		// Returns the number of worker threads.
+		size_t WorkerCount() const;
+
+		// Schedules a job. The counter, if any, counts it until it finishes.
+		void Run(std::function<void()> job, JobCounter* counter = nullptr);
+		// Schedules a job to start once dependency reaches zero.
+		void Run(std::function<void()> job, JobCounter& dependency, JobCounter* counter);
+		// Returns once the counter reaches zero, running jobs meanwhile. With no job left to run,
+		// sleeps until a job is scheduled or a counter reaches zero.
+		void Wait(JobCounter& counter);
+
+		// Returns the number of chunks For uses for count items. Every chunk has at least minChunkSize
+		// items and there are at most ChunksPerThread chunks per thread, counting the caller.
+		// Several chunks per thread let threads that finish early take work from slower ones.
+		size_t ChunkCount(size_t count, size_t minChunkSize) const;
+		// Calls body(chunk, begin, end) once per chunk of [0, count) and returns when all chunks are done.
+		// The first chunk runs on the calling thread.
+		void For(size_t count, size_t minChunkSize, std::function<void(size_t, size_t, size_t)> const& body);
+
+	private:
+		static constexpr size_t ChunksPerThread = 4;
+
+		struct Job {
+			std::function<void()> Work;
+			JobCounter* Counter;
+		};
+
+		// A double-ended queue in a ring buffer, which only allocates when it grows.
+		struct Queue {
+			std::mutex Mutex;
+			std::vector<Job> Jobs;
+			size_t Head = 0;
+			size_t Count = 0;
+		};
+
+		// One queue per worker, then one for the threads outside the pool.
+		std::vector<std::unique_ptr<Queue>> _queues;
+		std::vector<std::thread> _workers;
+		std::atomic<size_t> _pending;
+		std::atomic<bool> _stopping;
+		// Wakes workers when jobs are scheduled and waiting threads when counters reach zero.
+		std::mutex _sleepMutex;
+		std::condition_variable _wake;
+
+		void push(Job job);
+		bool pop(size_t queue, Job& job);
+		bool steal(size_t thief, Job& job);
+		bool runOne();
+		void finish(JobCounter* counter);
+		void work(size_t index);
+	};
+}
+
+#endif
@@ -0,0 +1,348 @@
+#include <cmath>
+#include <limits>
+#include "LineOfSight.h"
+#include "MathHelper.h"
+#include "Parallel.h"
+
+namespace Xna {
+
+	static i32 cellCount(double extent, double cellSize) {
+		const double count = std::ceil(extent / cellSize);
+		return count < 1 ? 1 : static_cast<i32>(count);
+	}
+
+	LineOfSight::LineOfSight(BoundingBox const& world, double cellSize, double quantum, size_t capacity) :
+		_origin(world.Min), _cellSize(cellSize > 0 ? cellSize : 1), _quantum(quantum > 0 ? quantum : 1), _capacity(capacity),
+		_version(0), _batch(0), _hits(0), _misses(0), _occluderCount(0) {
+
+		_cellsX = cellCount(world.Max.X - world.Min.X, _cellSize);
+		_cellsY = cellCount(world.Max.Y - world.Min.Y, _cellSize);
+		_cellsZ = cellCount(world.Max.Z - world.Min.Z, _cellSize);
+
+		const size_t cells = static_cast<size_t>(_cellsX) * _cellsY * _cellsZ;
+		_cellVersions.resize(cells, 0);
+		_cellOccluders.resize(cells);
+	}
+
+	u32 LineOfSight::AddOccluder(BoundingBox const& box) {
+		u32 id;
+
+		if (!_freeOccluders.empty()) {
+			id = _freeOccluders.back();
+			_freeOccluders.pop_back();
+		}
+		else {
+			id = static_cast<u32>(_occluders.size());
+			_occluders.push_back(Occluder());
+		}
+
+		_occluders[id].Box = box;
+		_occluders[id].Cells = cellsOf(box);
+		_occluders[id].Alive = true;
+		++_occluderCount;
+
+		link(id);
+		touch(_occluders[id].Cells);
+
+		return id;
+	}
+
+	void LineOfSight::MoveOccluder(u32 id, BoundingBox const& box) {
+		if (id >= _occluders.size() || !_occluders[id].Alive)
+			return;
+
+		touch(_occluders[id].Cells);
+		unlink(id);
+
+		_occluders[id].Box = box;
+		_occluders[id].Cells = cellsOf(box);
+
+		link(id);
+		touch(_occluders[id].Cells);
+	}
+
+	void LineOfSight::RemoveOccluder(u32 id) {
+		if (id >= _occluders.size() || !_occluders[id].Alive)
+			return;
+
+		touch(_occluders[id].Cells);
+		unlink(id);
+
+		_occluders[id].Alive = false;
+		_freeOccluders.push_back(id);
+		--_occluderCount;
+	}
+
+	size_t LineOfSight::OccluderCount() const {
+		return _occluderCount;
+	}
+
+	void LineOfSight::Invalidate(BoundingBox const& region) {
+		touch(cellsOf(region));
+	}
+
+	bool LineOfSight::Query(Vector3 const& from, Vector3 const& to) {
+		const Key key = keyOf(from, to);
+		auto found = _cache.find(key);
+
+		if (found != _cache.end() && isValid(found->second)) {
+			found->second.LastUsed = _batch;
+			++_hits;
+			return found->second.Visible;
+		}
+
+		const bool visible = trace(from, to);
+		_cache[key] = Entry{ from, to, _version, _batch, visible };
+		++_misses;
+
+		return visible;
+	}
+
+	void LineOfSight::Query(std::vector<SightQuery> const& queries, std::vector<byte>& result) {
+		++_batch;
+		result.resize(queries.size());
+		_pending.clear();
+
+		for (size_t i = 0; i < queries.size(); ++i) {
+			const Key key = keyOf(queries[i].From, queries[i].To);
+			auto found = _cache.find(key);
+
+			if (found != _cache.end() && isValid(found->second)) {
+				found->second.LastUsed = _batch;
+				result[i] = found->second.Visible ? 1 : 0;
+				continue;
+			}
+
+			_pending.push_back(Miss{ i, key });
+		}
+
+		_hits += queries.size() - _pending.size();
+		_misses += _pending.size();
+
+		// Tracing only reads the occluders, and each miss writes its own result.
+		Parallel::For(_pending.size(), TraceChunkSize, [&](size_t, size_t begin, size_t end) {
+			for (size_t m = begin; m < end; ++m) {
+				SightQuery const& query = queries[_pending[m].Query];
+				result[_pending[m].Query] = trace(query.From, query.To) ? 1 : 0;
+			}
+		});
+
+		for (Miss const& miss : _pending) {
+			SightQuery const& query = queries[miss.Query];
+			_cache[miss.Pair] = Entry{ query.From, query.To, _version, _batch, result[miss.Query] != 0 };
+		}
+
+		trim();
+	}
+
+	bool LineOfSight::Trace(Vector3 const& from, Vector3 const& to) const {
+		return trace(from, to);
+	}
+
+	size_t LineOfSight::CacheCount() const {
+		return _cache.size();
+	}
+
+	void LineOfSight::ClearCache() {
+		_cache.clear();
+	}
+
+	u64 LineOfSight::Hits() const {
+		return _hits;
+	}
+
+	u64 LineOfSight::Misses() const {
+		return _misses;
+	}
+
+	// Private
+
+	bool LineOfSight::Key::operator ==(Key const& other) const {
+		for (i32 i = 0; i < 6; ++i) {
+			if (Coordinates[i] != other.Coordinates[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	size_t LineOfSight::KeyHash::operator ()(Key const& key) const {
+		u64 hash = 14695981039346656037ull;
+
+		for (i32 i = 0; i < 6; ++i)
+			hash = (hash ^ static_cast<u32>(key.Coordinates[i])) * 1099511628211ull;
+
+		return static_cast<size_t>(hash ^ (hash >> 32));
+	}
+
+	i32 LineOfSight::cellOf(double value, double origin, i32 count) const {
+		const double cell = std::floor((value - origin) / _cellSize);
+
+		// Also sends NaN to the first cell.
+		if (!(cell >= 0))
+			return 0;
+
+		return cell >= count ? count - 1 : static_cast<i32>(cell);
+	}
+
+	LineOfSight::CellRange LineOfSight::cellsOf(BoundingBox const& box) const {
+		return CellRange{
+			cellOf(box.Min.X, _origin.X, _cellsX), cellOf(box.Min.Y, _origin.Y, _cellsY), cellOf(box.Min.Z, _origin.Z, _cellsZ),
+			cellOf(box.Max.X, _origin.X, _cellsX), cellOf(box.Max.Y, _origin.Y, _cellsY), cellOf(box.Max.Z, _origin.Z, _cellsZ) };
+	}
+
+	size_t LineOfSight::cellIndex(i32 x, i32 y, i32 z) const {
+		return (static_cast<size_t>(z) * _cellsY + y) * _cellsX + x;
+	}
+
+	void LineOfSight::touch(CellRange const& cells) {
+		++_version;
+
+		for (i32 z = cells.MinZ; z <= cells.MaxZ; ++z)
+			for (i32 y = cells.MinY; y <= cells.MaxY; ++y)
+				for (i32 x = cells.MinX; x <= cells.MaxX; ++x)
+					_cellVersions[cellIndex(x, y, z)] = _version;
+	}
+
+	void LineOfSight::link(u32 id) {
+		CellRange const& cells = _occluders[id].Cells;
+
+		for (i32 z = cells.MinZ; z <= cells.MaxZ; ++z)
+			for (i32 y = cells.MinY; y <= cells.MaxY; ++y)
+				for (i32 x = cells.MinX; x <= cells.MaxX; ++x)
+					_cellOccluders[cellIndex(x, y, z)].push_back(id);
+	}
+
+	void LineOfSight::unlink(u32 id) {
+		CellRange const& cells = _occluders[id].Cells;
+
+		for (i32 z = cells.MinZ; z <= cells.MaxZ; ++z) {
+			for (i32 y = cells.MinY; y <= cells.MaxY; ++y) {
+				for (i32 x = cells.MinX; x <= cells.MaxX; ++x) {
+					std::vector<u32>& list = _cellOccluders[cellIndex(x, y, z)];
+
+					for (size_t i = 0; i < list.size(); ++i) {
+						if (list[i] == id) {
+							list[i] = list.back();
+							list.pop_back();
+							break;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	LineOfSight::Key LineOfSight::keyOf(Vector3 const& from, Vector3 const& to) const {
+		const i32 a[3] = {
+			static_cast<i32>(std::llround(from.X / _quantum)),
+			static_cast<i32>(std::llround(from.Y / _quantum)),
+			static_cast<i32>(std::llround(from.Z / _quantum)) };
+		const i32 b[3] = {
+			static_cast<i32>(std::llround(to.X / _quantum)),
+			static_cast<i32>(std::llround(to.Y / _quantum)),
+			static_cast<i32>(std::llround(to.Z / _quantum)) };
+
+		// Sight is symmetric, so both orders of a pair share one key.
+		const bool swap = a[0] != b[0] ? a[0] > b[0] : (a[1] != b[1] ? a[1] > b[1] : a[2] > b[2]);
+		const i32* first = swap ? b : a;
+		const i32* second = swap ? a : b;
+
+		return Key{ { first[0], first[1], first[2], second[0], second[1], second[2] } };
+	}
+
+	template <typename Visit>
+	bool LineOfSight::walk(Vector3 const& from, Vector3 const& to, Visit&& visit) const {
+		const double start[3] = { from.X, from.Y, from.Z };
+		const double end[3] = { to.X, to.Y, to.Z };
+		const double origin[3] = { _origin.X, _origin.Y, _origin.Z };
+		const i32 counts[3] = { _cellsX, _cellsY, _cellsZ };
+		i32 cell[3];
+		i32 step[3];
+		i32 remaining[3];
+		// Per axis, the fraction of the segment at its next cell boundary and between two boundaries.
+		double next[3];
+		double across[3];
+
+		for (i32 a = 0; a < 3; ++a) {
+			// Points outside the world fall in the border cells, so the walk never steps past them.
+			cell[a] = cellOf(start[a], origin[a], counts[a]);
+			const i32 last = cellOf(end[a], origin[a], counts[a]);
+			step[a] = last > cell[a] ? 1 : -1;
+			remaining[a] = last > cell[a] ? last - cell[a] : cell[a] - last;
+
+			if (remaining[a] == 0) {
+				next[a] = std::numeric_limits<double>::infinity();
+				across[a] = 0;
+				continue;
+			}
+
+			const double delta = end[a] - start[a];
+			const double boundary = origin[a] + (step[a] > 0 ? cell[a] + 1 : cell[a]) * _cellSize;
+			next[a] = (boundary - start[a]) / delta;
+			across[a] = _cellSize / std::abs(delta);
+		}
+
+		// The steps are counted from the cells of both points, so rounding in the boundaries never
+		// ends the walk early or late.
+		for (;;) {
+			if (!visit(cell[0], cell[1], cell[2]))
+				return false;
+
+			const i32 a = next[0] < next[1] ? (next[0] < next[2] ? 0 : 2) : (next[1] < next[2] ? 1 : 2);
+
+			if (remaining[a] == 0)
+				return true;
+
+			cell[a] += step[a];
+			next[a] = --remaining[a] == 0 ? std::numeric_limits<double>::infinity() : next[a] + across[a];
+		}
+	}
+
+	bool LineOfSight::isValid(Entry const& entry) const {
+		return walk(entry.From, entry.To, [&](i32 x, i32 y, i32 z) {
+			return _cellVersions[cellIndex(x, y, z)] <= entry.Version;
+		});
+	}
+
+	bool LineOfSight::trace(Vector3 const& from, Vector3 const& to) const {
+		// The direction is the whole segment, so hits past t = 1 are beyond the target.
+		const Ray ray(from, to - from);
+		i32 previous[3] = { -1, -1, -1 };
+
+		return walk(from, to, [&](i32 x, i32 y, i32 z) {
+			for (u32 id : _cellOccluders[cellIndex(x, y, z)]) {
+				CellRange const& o = _occluders[id].Cells;
+
+				// An occluder spanning several cells is tested once, in the first cell of the walk it overlaps.
+				// The walk moves one way along each axis, so the cells it shares with an occluder follow each other.
+				if (previous[0] >= o.MinX && previous[0] <= o.MaxX
+					&& previous[1] >= o.MinY && previous[1] <= o.MaxY
+					&& previous[2] >= o.MinZ && previous[2] <= o.MaxZ)
+					continue;
+
+				const double t = ray.Intersects(_occluders[id].Box);
+
+				if (!MathHelper::IsNan(t) && t <= 1.0)
+					return false;
+			}
+
+			previous[0] = x;
+			previous[1] = y;
+			previous[2] = z;
+			return true;
+		});
+	}
+
+	void LineOfSight::trim() {
+		if (_cache.size() <= _capacity)
+			return;
+
+		for (auto i = _cache.begin(); i != _cache.end();) {
+			if (i->second.LastUsed < _batch)
+				i = _cache.erase(i);
+			else
+				++i;
+		}
+	}
+}
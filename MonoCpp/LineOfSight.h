@@ -0,0 +1,144 @@
+#ifndef LINEOFSIGHT_H
+#define LINEOFSIGHT_H
+
+#include <unordered_map>
+#include <vector>
+#include "CSharp.h"
+#include "Structs.h"
+#include "Space3d.h"
+
+namespace Xna {
+
+	// A line-of-sight check between two points.
+	struct SightQuery {
+		Vector3 From;
+		Vector3 To;
+	};
+
+	// Answers line-of-sight checks against box occluders and caches the answers.
+	// The answer for a pair is kept until an occluder changes in a cell the segment crosses:
+	// the world is divided into a grid of cells, each with the version at which it last changed,
+	// and a cached answer is valid while no cell along its segment is newer than the answer.
+	// Tracing and validating walk the same cells, found by stepping from one cell boundary
+	// the segment crosses to the next, so both cost the length of the segment in cells.
+	// Endpoints are quantized for the cache key, so points closer than the quantum may share an
+	// answer; the pair is unordered. Points outside the world share the grid's border cells.
+	struct LineOfSight {
+
+		// world: the area covered by the grid. cellSize: the edge of a grid cell.
+		// quantum: the step endpoints are rounded to for the cache. capacity: the number of
+		// cached pairs beyond which pairs not used by the last batch are dropped.
+		LineOfSight(BoundingBox const& world, double cellSize, double quantum, size_t capacity = 1 << 16);
+
+		// Adds an occluder and returns its id. Removed ids are reused by later adds.
+		u32 AddOccluder(BoundingBox const& box);
+		// Changes the bounds of an occluder.
+		void MoveOccluder(u32 id, BoundingBox const& box);
+		void RemoveOccluder(u32 id);
+		// Returns the number of occluders.
+		size_t OccluderCount() const;
+		// Drops the cached answers of every segment crossing a cell the region overlaps,
+		// for geometry that changed outside of this service.
+		void Invalidate(BoundingBox const& region);
+
+		// Gets whether the segment between the points is clear of every occluder.
+		bool Query(Vector3 const& from, Vector3 const& to);
+		// Answers a batch of checks, setting result[i] to 1 where the segment is clear and to 0 elsewhere.
+		// The checks missing from the cache are traced in parallel.
+		void Query(std::vector<SightQuery> const& queries, std::vector<byte>& result);
+		// Traces the segment without the cache.
+		bool Trace(Vector3 const& from, Vector3 const& to) const;
+
+		// Returns the number of cached pairs.
+		size_t CacheCount() const;
+		// Drops every cached answer.
+		void ClearCache();
+		// The numbers of checks answered from the cache and traced, since the cache was created.
+		u64 Hits() const;
+		u64 Misses() const;
+
+	private:
+		// Each trace walks many cells, so far fewer of them than Parallel::DefaultChunkSize cover the cost of a chunk.
+		static constexpr size_t TraceChunkSize = 32;
+
+		// A block of grid cells, bounds included.
+		struct CellRange {
+			i32 MinX;
+			i32 MinY;
+			i32 MinZ;
+			i32 MaxX;
+			i32 MaxY;
+			i32 MaxZ;
+		};
+
+		struct Occluder {
+			BoundingBox Box;
+			CellRange Cells;
+			bool Alive;
+		};
+
+		// Quantized endpoints, the lower one first.
+		struct Key {
+			i32 Coordinates[6];
+
+			bool operator ==(Key const& other) const;
+		};
+
+		struct KeyHash {
+			size_t operator ()(Key const& key) const;
+		};
+
+		struct Entry {
+			// The segment the answer was traced for.
+			Vector3 From;
+			Vector3 To;
+			// The version of the world the answer was traced at.
+			u64 Version;
+			u64 LastUsed;
+			bool Visible;
+		};
+
+		// A cache miss of the current batch.
+		struct Miss {
+			size_t Query;
+			Key Pair;
+		};
+
+		Vector3 _origin;
+		double _cellSize;
+		i32 _cellsX;
+		i32 _cellsY;
+		i32 _cellsZ;
+		double _quantum;
+		size_t _capacity;
+		u64 _version;
+		u64 _batch;
+		u64 _hits;
+		u64 _misses;
+		std::vector<Occluder> _occluders;
+		std::vector<u32> _freeOccluders;
+		size_t _occluderCount;
+		// Per cell, the version it last changed at and the occluders overlapping it.
+		std::vector<u64> _cellVersions;
+		std::vector<std::vector<u32>> _cellOccluders;
+		std::unordered_map<Key, Entry, KeyHash> _cache;
+		std::vector<Miss> _pending;
+
+		i32 cellOf(double value, double origin, i32 count) const;
+		CellRange cellsOf(BoundingBox const& box) const;
+		size_t cellIndex(i32 x, i32 y, i32 z) const;
+		void touch(CellRange const& cells);
+		void link(u32 id);
+		void unlink(u32 id);
+		Key keyOf(Vector3 const& from, Vector3 const& to) const;
+		// Calls visit(x, y, z) for each cell the segment crosses, in order from the first point,
+		// until visit returns false. Returns false if the walk was stopped.
+		template <typename Visit>
+		bool walk(Vector3 const& from, Vector3 const& to, Visit&& visit) const;
+		bool isValid(Entry const& entry) const;
+		bool trace(Vector3 const& from, Vector3 const& to) const;
+		void trim();
+	};
+}
+
+#endif
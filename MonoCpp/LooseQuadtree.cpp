@@ -0,0 +1,311 @@
+#include "Space2d.h"
+
+namespace Xna {
+
+	LooseQuadtree::LooseQuadtree(Rectangle const& world, i32 maxDepth) :
+		_world(world), _maxDepth(maxDepth < 0 ? 0 : maxDepth), _count(0) {
+		allocateNode(None);
+	}
+
+	u32 LooseQuadtree::Insert(Rectangle const& bounds) {
+		u32 id;
+
+		if (!_freeItems.empty()) {
+			id = _freeItems.back();
+			_freeItems.pop_back();
+		}
+		else {
+			id = static_cast<u32>(_items.size());
+			_items.push_back(Item());
+		}
+
+		_items[id].Bounds = bounds;
+		_items[id].Alive = true;
+		++_count;
+
+		link(id, nodeFor(bounds, true));
+
+		return id;
+	}
+
+	void LooseQuadtree::Move(u32 id, Rectangle const& bounds) {
+		if (!Contains(id))
+			return;
+
+		_items[id].Bounds = bounds;
+
+		if (nodeFor(bounds, false) == _items[id].Node)
+			return;
+
+		unlink(id);
+		link(id, nodeFor(bounds, true));
+	}
+
+	void LooseQuadtree::Remove(u32 id) {
+		if (!Contains(id))
+			return;
+
+		unlink(id);
+		_items[id].Alive = false;
+		_freeItems.push_back(id);
+		--_count;
+	}
+
+	bool LooseQuadtree::Contains(u32 id) const {
+		return id < _items.size() && _items[id].Alive;
+	}
+
+	Rectangle LooseQuadtree::Bounds(u32 id) const {
+		return Contains(id) ? _items[id].Bounds : Rectangle();
+	}
+
+	size_t LooseQuadtree::Count() const {
+		return _count;
+	}
+
+	void LooseQuadtree::Clear() {
+		_items.clear();
+		_freeItems.clear();
+		_nodes.clear();
+		_freeNodes.clear();
+		_count = 0;
+		allocateNode(None);
+	}
+
+	void LooseQuadtree::Query(Rectangle const& region, std::vector<u32>& result) const {
+		_stack.clear();
+		_stack.push_back(std::make_pair(0u, root()));
+
+		while (!_stack.empty()) {
+			const u32 node = _stack.back().first;
+			const Cell cell = _stack.back().second;
+			_stack.pop_back();
+
+			for (u32 i = _nodes[node].FirstItem; i != None; i = _items[i].Next) {
+				if (_items[i].Bounds.Intersects(region))
+					result.push_back(i);
+			}
+
+			for (i32 q = 0; q < 4; ++q) {
+				const u32 next = _nodes[node].Children[q];
+
+				if (next == None)
+					continue;
+
+				// The loose bounds hold every item of the subtree.
+				const Cell c = child(cell, q);
+				const double loose = c.Half * 2.0;
+
+				if (region.Left() < c.X + loose && c.X - loose < region.Right()
+					&& region.Top() < c.Y + loose && c.Y - loose < region.Bottom())
+					_stack.push_back(std::make_pair(next, c));
+			}
+		}
+	}
+
+	void LooseQuadtree::Query(Point const& point, std::vector<u32>& result) const {
+		_stack.clear();
+		_stack.push_back(std::make_pair(0u, root()));
+
+		while (!_stack.empty()) {
+			const u32 node = _stack.back().first;
+			const Cell cell = _stack.back().second;
+			_stack.pop_back();
+
+			for (u32 i = _nodes[node].FirstItem; i != None; i = _items[i].Next) {
+				if (_items[i].Bounds.Contains(point))
+					result.push_back(i);
+			}
+
+			for (i32 q = 0; q < 4; ++q) {
+				const u32 next = _nodes[node].Children[q];
+
+				if (next == None)
+					continue;
+
+				const Cell c = child(cell, q);
+				const double loose = c.Half * 2.0;
+
+				if (c.X - loose <= point.X && point.X <= c.X + loose
+					&& c.Y - loose <= point.Y && point.Y <= c.Y + loose)
+					_stack.push_back(std::make_pair(next, c));
+			}
+		}
+	}
+
+	void LooseQuadtree::Query(Vector2 const& point, std::vector<u32>& result) const {
+		Query(Point(static_cast<i32>(point.X), static_cast<i32>(point.Y)), result);
+	}
+
+	void LooseQuadtree::QueryPairs(std::vector<std::pair<u32, u32>>& result) const {
+		queryPairs(0, root(), result);
+	}
+
+	// Private
+
+	LooseQuadtree::Cell LooseQuadtree::root() const {
+		const double side = _world.Width > _world.Height ? _world.Width : _world.Height;
+		return Cell{ _world.X + _world.Width * 0.5, _world.Y + _world.Height * 0.5, side * 0.5 };
+	}
+
+	LooseQuadtree::Cell LooseQuadtree::child(Cell const& cell, i32 quadrant) {
+		const double half = cell.Half * 0.5;
+
+		return Cell{
+			(quadrant & 1) != 0 ? cell.X + half : cell.X - half,
+			(quadrant & 2) != 0 ? cell.Y + half : cell.Y - half,
+			half };
+	}
+
+	i32 LooseQuadtree::quadrantOf(Cell const& cell, double x, double y) {
+		return (x >= cell.X ? 1 : 0) | (y >= cell.Y ? 2 : 0);
+	}
+
+	u32 LooseQuadtree::allocateNode(u32 parent) {
+		u32 node;
+
+		if (!_freeNodes.empty()) {
+			node = _freeNodes.back();
+			_freeNodes.pop_back();
+		}
+		else {
+			node = static_cast<u32>(_nodes.size());
+			_nodes.push_back(Node());
+		}
+
+		Node& n = _nodes[node];
+		n.Parent = parent;
+		n.Children[0] = n.Children[1] = n.Children[2] = n.Children[3] = None;
+		n.FirstItem = None;
+		n.Count = 0;
+
+		return node;
+	}
+
+	u32 LooseQuadtree::nodeFor(Rectangle const& bounds, bool create) {
+		const double size = bounds.Width > bounds.Height ? bounds.Width : bounds.Height;
+		const double x = bounds.X + bounds.Width * 0.5;
+		const double y = bounds.Y + bounds.Height * 0.5;
+		Cell cell = root();
+
+		if (size > cell.Half * 2.0
+			|| x < cell.X - cell.Half || x > cell.X + cell.Half
+			|| y < cell.Y - cell.Half || y > cell.Y + cell.Half)
+			return 0;
+
+		u32 node = 0;
+
+		// A child's side is its parent's half side.
+		for (i32 depth = 0; depth < _maxDepth && size <= cell.Half; ++depth) {
+			const i32 q = quadrantOf(cell, x, y);
+			u32 next = _nodes[node].Children[q];
+
+			if (next == None) {
+				if (!create)
+					return None;
+
+				next = allocateNode(node);
+				_nodes[node].Children[q] = next;
+			}
+
+			node = next;
+			cell = child(cell, q);
+		}
+
+		return node;
+	}
+
+	void LooseQuadtree::link(u32 id, u32 node) {
+		Item& item = _items[id];
+		item.Node = node;
+		item.Prev = None;
+		item.Next = _nodes[node].FirstItem;
+
+		if (item.Next != None)
+			_items[item.Next].Prev = id;
+
+		_nodes[node].FirstItem = id;
+
+		for (u32 n = node; n != None; n = _nodes[n].Parent)
+			++_nodes[n].Count;
+	}
+
+	void LooseQuadtree::unlink(u32 id) {
+		Item& item = _items[id];
+
+		if (item.Prev != None)
+			_items[item.Prev].Next = item.Next;
+		else
+			_nodes[item.Node].FirstItem = item.Next;
+
+		if (item.Next != None)
+			_items[item.Next].Prev = item.Prev;
+
+		u32 n = item.Node;
+
+		while (n != None) {
+			const u32 parent = _nodes[n].Parent;
+
+			// Empty branches go back to the pool; their children were already released.
+			if (--_nodes[n].Count == 0 && parent != None) {
+				for (i32 q = 0; q < 4; ++q) {
+					if (_nodes[parent].Children[q] == n)
+						_nodes[parent].Children[q] = None;
+				}
+
+				_freeNodes.push_back(n);
+			}
+
+			n = parent;
+		}
+
+		item.Node = None;
+	}
+
+	void LooseQuadtree::queryPairs(u32 node, Cell const& cell, std::vector<std::pair<u32, u32>>& result) const {
+		for (u32 i = _nodes[node].FirstItem; i != None; i = _items[i].Next)
+			pairsOf(i, cell.Half, result);
+
+		for (i32 q = 0; q < 4; ++q) {
+			if (_nodes[node].Children[q] != None)
+				queryPairs(_nodes[node].Children[q], child(cell, q), result);
+		}
+	}
+
+	void LooseQuadtree::pairsOf(u32 id, double half, std::vector<std::pair<u32, u32>>& result) const {
+		// Loose bounds of siblings overlap, so an item is tested against the whole tree. Each pair
+		// is reported by its item in the larger cell, or by the lower id when both cells are the
+		// same size; halving is exact, so the half side tells the depth.
+		Rectangle const& bounds = _items[id].Bounds;
+
+		_stack.clear();
+		_stack.push_back(std::make_pair(0u, root()));
+
+		while (!_stack.empty()) {
+			const u32 node = _stack.back().first;
+			const Cell cell = _stack.back().second;
+			_stack.pop_back();
+
+			if (cell.Half <= half) {
+				for (u32 i = _nodes[node].FirstItem; i != None; i = _items[i].Next) {
+					if ((cell.Half < half || id < i) && bounds.Intersects(_items[i].Bounds))
+						result.push_back(std::make_pair(id < i ? id : i, id < i ? i : id));
+				}
+			}
+
+			for (i32 q = 0; q < 4; ++q) {
+				const u32 next = _nodes[node].Children[q];
+
+				if (next == None)
+					continue;
+
+				const Cell c = child(cell, q);
+				const double loose = c.Half * 2.0;
+
+				if (bounds.Left() < c.X + loose && c.X - loose < bounds.Right()
+					&& bounds.Top() < c.Y + loose && c.Y - loose < bounds.Bottom())
+					_stack.push_back(std::make_pair(next, c));
+			}
+		}
+	}
+}
@@ -1,8 +1,43 @@
 ﻿// main.cpp : Defines the entry point for the application.
 //
 
+#include <memory_resource>
 #include "Main.h"
 #include "SDL.h"
+#include "Allocations.h"
+#include "DirtyRegion.h"
+#include "FrameArena.h"
+#include "JobSystem.h"
+
+// Fills the dirty areas with the background, then draws the box over them.
+static void draw(SDL_Surface* surface, Xna::RectangleStream const& dirty, SDL_Rect const& box) {
+	const Uint32 background = SDL_MapRGB(surface->format, 0, 0, 0);
+	const Uint32 foreground = SDL_MapRGB(surface->format, 255, 255, 255);
+
+	for (size_t i = 0; i < dirty.Count(); ++i) {
+		SDL_Rect area{ dirty.X[i], dirty.Y[i], dirty.Width[i], dirty.Height[i] };
+		SDL_FillRect(surface, &area, background);
+	}
+
+	SDL_FillRect(surface, &box, foreground);
+}
+
+// Pushes the dirty areas to the window, or the whole surface when the region is full.
+static void present(SDL_Window* window, Xna::DirtyRegion& dirty, std::pmr::memory_resource* frame) {
+	if (dirty.IsFull()) {
+		SDL_UpdateWindowSurface(window);
+		return;
+	}
+
+	Xna::RectangleStream const& rectangles = dirty.Rectangles();
+	std::pmr::vector<SDL_Rect> rects(rectangles.Count(), frame);
+
+	for (size_t i = 0; i < rects.size(); ++i)
+		rects[i] = SDL_Rect{ rectangles.X[i], rectangles.Y[i], rectangles.Width[i], rectangles.Height[i] };
+
+	if (!rects.empty())
+		SDL_UpdateWindowSurfaceRects(window, rects.data(), static_cast<int>(rects.size()));
+}
 
 int main(int argc, char* argv[])
 {
@@ -15,12 +50,71 @@ int main(int argc, char* argv[])
 		480,
 		0);
 
-	SDL_Renderer* renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
-	SDL_SetRenderDrawColor(renderer, 0, 0, 0, SDL_ALPHA_OPAQUE);
-	SDL_RenderClear(renderer);
-	SDL_RenderPresent(renderer);
+	// Start the workers before the first frame rather than on first use.
+	Xna::JobSystem& jobs = Xna::JobSystem::Shared();
+
+	// The window surface allows partial presents, which the renderer does not.
+	SDL_Surface* surface = SDL_GetWindowSurface(window);
+	Xna::DirtyRegion dirty(Xna::Rectangle(0, 0, surface->w, surface->h));
+	SDL_Rect box{ 0, 224, 32, 32 };
+	// Memory that lives for one frame, released at the start of the next.
+	Xna::FrameArena frame;
+
+	const double frequency = static_cast<double>(SDL_GetPerformanceFrequency());
+	const Uint32 end = SDL_GetTicks() + 3000;
+	// Frames before the caches and pools reach their steady size, left out of the allocation count.
+	const int warmup = 30;
+	double saved = 0;
+	int frames = 0;
+	u64 allocations = 0;
+	bool running = true;
+
+	while (running && SDL_GetTicks() < end) {
+		frame.Reset();
+
+		if (frames == warmup)
+			allocations = Xna::Allocations::Count();
+
+		SDL_Event e;
+
+		while (SDL_PollEvent(&e)) {
+			if (e.type == SDL_QUIT)
+				running = false;
+			else if (e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_EXPOSED)
+				dirty.InvalidateAll();
+		}
+
+		// Update is a single job, which finishes before drawing. The demo moves one box, so there is
+		// no other update work to spread over the workers.
+		Xna::JobCounter update;
+
+		// Captures at most two references, which std::function stores without allocating.
+		jobs.Run([&dirty, &box]() {
+			// Only the box moves: its old and new places are all that changed.
+			dirty.Invalidate(Xna::Rectangle(box.x, box.y, box.w, box.h));
+			box.x = (box.x + 4) % (dirty.Bounds().Width - box.w);
+			dirty.Invalidate(Xna::Rectangle(box.x, box.y, box.w, box.h));
+		}, &update);
+
+		jobs.Wait(update);
+
+		draw(surface, dirty.Rectangles(), box);
+
+		const Uint64 start = SDL_GetPerformanceCounter();
+		present(window, dirty, &frame);
+		const Xna::PresentStatistics statistics = dirty.Presented((SDL_GetPerformanceCounter() - start) / frequency);
+
+		saved += statistics.SavedSeconds;
+		++frames;
+
+		SDL_Delay(16);
+	}
+
+	if (frames > 0)
+		std::cout << "Present time saved per frame: " << saved * 1000000.0 / frames << " us" << std::endl;
 
-	SDL_Delay(3000);
+	if (Xna::Allocations::IsCounting() && frames > warmup)
+		std::cout << "Heap allocations per frame: " << static_cast<double>(Xna::Allocations::Count() - allocations) / (frames - warmup) << std::endl;
 
 	SDL_DestroyWindow(window);
 	SDL_Quit();	
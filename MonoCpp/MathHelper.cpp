@@ -1,182 +1,236 @@
 #include <cmath>
+#include <limits>
 #include "MathHelper.h"
 
 namespace Xna {
 
-	double MathHelper::Barycentric(double value1, double value2, double value3, double amount1, double amount2) {
-		return value1 + (value2 - value1)
-			* amount1 + (value3 - value1)
-			* amount2;
+	//----- Fast approximation kernels
+
+	// Adding and subtracting 1.5 * 2^52 rounds a double to the nearest integer without a branch or a call.
+	static constexpr double RoundMagic = 6755399441055744.0;
+	static constexpr double TwoOverPi = 0.636619772367581343076;
+	// Pi / 2 split in two parts (Cody-Waite) so the range reduction stays exact for moderate angles.
+	static constexpr double PiOver2Hi = 1.57079632673412561417;
+	static constexpr double PiOver2Lo = 6.07710050650619224932e-11;
+
+	// Minimax coefficients for sin(r) = r + r^3 * P(r^2) and cos(r) = 1 - r^2 / 2 + r^4 * Q(r^2) on [-pi/4, pi/4].
+	static constexpr double SinC1 = -0.16666666644220018;
+	static constexpr double SinC2 = 0.00833332932909093;
+	static constexpr double SinC3 = -0.00019839261550208426;
+	static constexpr double SinC4 = 2.7173494353314504e-06;
+	static constexpr double CosC1 = 0.04166666662282907;
+	static constexpr double CosC2 = -0.0013888883753511174;
+	static constexpr double CosC3 = 2.4799520038033633e-05;
+	static constexpr double CosC4 = -2.721024032685151e-07;
+
+	// Minimax coefficients for atan(a) = a * R(a^2) on [0, 1].
+	static constexpr double AtanC0 = 0.9999999805601328;
+	static constexpr double AtanC1 = -0.33333180375913624;
+	static constexpr double AtanC2 = 0.19996436798423792;
+	static constexpr double AtanC3 = -0.142472225807284;
+	static constexpr double AtanC4 = 0.10878009576667987;
+	static constexpr double AtanC5 = -0.08213760948606004;
+	static constexpr double AtanC6 = 0.05502809144711864;
+	static constexpr double AtanC7 = -0.02849076884380609;
+	static constexpr double AtanC8 = 0.009567337323030212;
+	static constexpr double AtanC9 = -0.001509302681418696;
+
+	static inline void fastSinCos(double value, double& sin, double& cos) {
+		const double q = (value * TwoOverPi + RoundMagic) - RoundMagic;
+		const i64 quadrant = static_cast<i64>(q);
+		const double r = (value - q * PiOver2Hi) - q * PiOver2Lo;
+		const double r2 = r * r;
+
+		const double s = r + r * r2 * (SinC1 + r2 * (SinC2 + r2 * (SinC3 + r2 * SinC4)));
+		const double c = 1.0 - 0.5 * r2 + r2 * r2 * (CosC1 + r2 * (CosC2 + r2 * (CosC3 + r2 * CosC4)));
+
+		// Quadrants 1 and 3 swap sine and cosine, quadrants 1 and 2 negate the sine, 2 and 3 the cosine.
+		const bool swap = (quadrant & 1) != 0;
+		const double sinSign = (quadrant & 2) != 0 ? -1.0 : 1.0;
+		const double cosSign = ((quadrant + 1) & 2) != 0 ? -1.0 : 1.0;
+
+		sin = (swap ? c : s) * sinSign;
+		cos = (swap ? s : c) * cosSign;
+	}
+
+	// The square root is one hardware instruction on every target this builds for, and FastMathCheck
+	// measured it ahead of a bit-level estimate refined by Newton-Raphson steps, which also costs accuracy.
+	static inline double fastRsqrt(double value) {
+		return 1.0 / std::sqrt(value);
+	}
+
+	static inline double fastSqrt(double value) {
+		return std::sqrt(value);
 	}
 
-	double MathHelper::CatmullRom(double value1, double value2, double value3, double value4, double amount) {
-		double amountSquared = amount * amount;
-		double amountCubed = amountSquared * amount;
-
-		return (0.5 * (2.0 * value2 +
-			(value3 - value1) * amount +
-			(2.0 * value1 - 5.0 * value2 + 4.0 * value3 - value4) * amountSquared +
-			(3.0 * value2 - value1 - 3.0 * value3 + value4) * amountCubed));
-	}
+	static inline double fastAtan2(double y, double x) {
+		const double ax = std::abs(x);
+		const double ay = std::abs(y);
+		const double mx = ax > ay ? ax : ay;
+		const double mn = ax > ay ? ay : ax;
+		const double a = mx > 0.0 ? mn / mx : 0.0;
+		const double s = a * a;
 
-	double MathHelper::Clamp(double value, double min, double max) {
-		value = (value > max) ? max : value;
-		value = (value < min) ? min : value;
-		return value;
-	}
+		double r = a * (AtanC0 + s * (AtanC1 + s * (AtanC2 + s * (AtanC3 + s * (AtanC4
+			+ s * (AtanC5 + s * (AtanC6 + s * (AtanC7 + s * (AtanC8 + s * AtanC9)))))))));
 
-	i32 MathHelper::Clamp(i32 value, i32 min, i32 max) {
-		value = (value > max) ? max : value;
-		value = (value < min) ? min : value;
-		return value;
+		r = ay > ax ? MathHelper::PiOver2 - r : r;
+		// The signs rather than comparisons with 0, so signed zeros land on the same side as std::atan2.
+		r = std::signbit(x) ? MathHelper::Pi - r : r;
+		return std::signbit(y) ? -r : r;
 	}
 
-	double MathHelper::Distance(double value1, double value2) {
-		return abs(value1 - value2);
-	}
+	double MathHelper::WrapAngle(double angle) {
+		if ((angle > -Pi) && (angle <= Pi))
+			return angle;
 
-	double MathHelper::Hermite(double value1, double tangent1, double value2, double tangent2, double amount) {
-		double v1 = value1;
-		double v2 = value2;
-		double t1 = tangent1;
-		double t2 = tangent2;
-		double s = amount;
-		double result;
+		// % is not defined for doubles
+		//angle %= TwoPi;
+		angle = fmod(angle, TwoPi);
 
-		double sCubed = s * s * s;
-		double sSquared = s * s;
+		if (angle <= -Pi)
+			return angle + TwoPi;
 
-		if (amount == 0)
-			result = value1;
-		else if (amount == 1)
-			result = value2;
-		else
-			result = (2 * v1 - 2 * v2 + t2 + t1) * sCubed +
-			(3 * v2 - 3 * v1 - 2 * t1 - t2) * sSquared +
-			t1 * s +
-			v1;
+		if (angle > Pi)
+			return angle - TwoPi;
 
-		return result;
+		return angle;
 	}
 
-	double MathHelper::Lerp(double value1, double value2, double amount) {
-		return value1 + (value2 - value1) * amount;
+	double MathHelper::Sqrt(double value, MathPrecision precision) {
+		return precision == MathPrecision::Fast ? FastSqrt(value) : std::sqrt(value);
 	}
 
-	double MathHelper::LerpPrecise(double value1, double value2, double amount) {
-		return ((1 - amount) * value1) + (value2 * amount);
+	double MathHelper::Sin(double value, MathPrecision precision) {
+		return precision == MathPrecision::Fast ? FastSin(value) : std::sin(value);
 	}
 
-	double MathHelper::Max(double value1, double value2) {
-		return value1 > value2 ? value1 : value2;
+	double MathHelper::Cos(double value, MathPrecision precision) {
+		return precision == MathPrecision::Fast ? FastCos(value) : std::cos(value);
 	}
 
-	i32 MathHelper::Max(i32 value1, i32 value2) {
-		return value1 > value2 ? value1 : value2;
-	}
+	void MathHelper::SinCos(double value, double& sin, double& cos, MathPrecision precision) {
+		if (precision == MathPrecision::Fast) {
+			fastSinCos(value, sin, cos);
+			return;
+		}
 
-	double MathHelper::Min(double value1, double value2) {
-		return value1 < value2 ? value1 : value2;
+		sin = std::sin(value);
+		cos = std::cos(value);
 	}
 
-	i32 MathHelper::Min(i32 value1, i32 value2) {
-		return value1 < value2 ? value1 : value2;
+	double MathHelper::Atan2(double y, double x, MathPrecision precision) {
+		return precision == MathPrecision::Fast ? FastAtan2(y, x) : std::atan2(y, x);
 	}
 
-	double MathHelper::SmoothStep(double value1, double value2, double amount) {
-		double result = Clamp(amount, 0.0, 1.0);
-		result = Hermite(value1, 0, value2, 0, result);
+	double MathHelper::FastSin(double value) {
+		double sin, cos;
+		fastSinCos(value, sin, cos);
+		return sin;
+	}
 
-		return result;
+	double MathHelper::FastCos(double value) {
+		double sin, cos;
+		fastSinCos(value, sin, cos);
+		return cos;
 	}
 
-	double MathHelper::ToDegrees(double radians) {
-		return radians * RADIANS_TO_DEGREE;
+	void MathHelper::FastSinCos(double value, double& sin, double& cos) {
+		fastSinCos(value, sin, cos);
 	}
 
-	double MathHelper::ToRadians(double degrees) {
-		return degrees * DEGREE_TO_RADIANS;
+	double MathHelper::FastRsqrt(double value) {
+		return fastRsqrt(value);
 	}
 
-	double MathHelper::WrapAngle(double angle) {
-		if ((angle > -Pi) && (angle <= Pi))
-			return angle;
+	double MathHelper::FastSqrt(double value) {
+		return fastSqrt(value);
+	}
 
-		// % is not defined for doubles
-		//angle %= TwoPi;
-		angle = fmod(angle, TwoPi);
+	double MathHelper::FastAtan2(double y, double x) {
+		return fastAtan2(y, x);
+	}
 
-		if (angle <= -Pi)
-			return angle + TwoPi;
+	void MathHelper::FastSin(std::vector<double> const& values, std::vector<double>& result) {
+		const size_t count = values.size();
+		result.resize(count);
 
-		if (angle > Pi)
-			return angle - TwoPi;
+		const double* v = values.data();
+		double* r = result.data();
 
-		return angle;
+		for (size_t i = 0; i < count; ++i) {
+			double sin, cos;
+			fastSinCos(v[i], sin, cos);
+			r[i] = sin;
+		}
 	}
 
-	bool MathHelper::IsPowerOfTwo(i32 value) {
-		return (value > 0) && ((value & (value - 1)) == 0);
-	}	
+	void MathHelper::FastCos(std::vector<double> const& values, std::vector<double>& result) {
+		const size_t count = values.size();
+		result.resize(count);
 
-	double MathHelper::Sqrt(double value) {
-		return std::sqrt(value);
-	}
+		const double* v = values.data();
+		double* r = result.data();
 
-	double MathHelper::Pow(double x, double y) {
-		return std::pow(x, y);
+		for (size_t i = 0; i < count; ++i) {
+			double sin, cos;
+			fastSinCos(v[i], sin, cos);
+			r[i] = cos;
+		}
 	}
 
-	double MathHelper::Sin(double value) {
-		return std::sin(value);
-	}
+	void MathHelper::FastSinCos(std::vector<double> const& values, std::vector<double>& sin, std::vector<double>& cos) {
+		const size_t count = values.size();
+		sin.resize(count);
+		cos.resize(count);
 
-	double MathHelper::Cos(double value) {
-		return std::cos(value);
-	}
+		const double* v = values.data();
+		double* s = sin.data();
+		double* c = cos.data();
 
-	double MathHelper::Tan(double value) {
-		return std::tan(value);
+		for (size_t i = 0; i < count; ++i) {
+			double resultSin, resultCos;
+			fastSinCos(v[i], resultSin, resultCos);
+			s[i] = resultSin;
+			c[i] = resultCos;
+		}
 	}
 
-	double MathHelper::Asin(double value) {
-		return std::asin(value);
-	}
+	void MathHelper::FastRsqrt(std::vector<double> const& values, std::vector<double>& result) {
+		const size_t count = values.size();
+		result.resize(count);
 
-	double MathHelper::Acos(double value) {
-		return std::acos(value);
-	}
+		const double* v = values.data();
+		double* r = result.data();
 
-	double MathHelper::Atan(double value) {
-		return std::atan(value);
+		for (size_t i = 0; i < count; ++i) {
+			r[i] = fastRsqrt(v[i]);
+		}
 	}
 
-	double MathHelper::Round(double value) {
-		return std::round(value);
-	}
+	void MathHelper::FastSqrt(std::vector<double> const& values, std::vector<double>& result) {
+		const size_t count = values.size();
+		result.resize(count);
 
-	double MathHelper::Ceiling(double value) {
-		return std::ceil(value);
-	}
+		const double* v = values.data();
+		double* r = result.data();
 
-	double MathHelper::Floor(double value) {
-		return std::floor(value);
+		for (size_t i = 0; i < count; ++i) {
+			r[i] = fastSqrt(v[i]);
+		}
 	}
 
-	bool MathHelper::IsPositiveInfinity(double value) {
-		return isinf(value) && value > 0;
-	}
+	void MathHelper::FastAtan2(std::vector<double> const& y, std::vector<double> const& x, std::vector<double>& result) {
+		const size_t count = y.size() < x.size() ? y.size() : x.size();
+		result.resize(count);
 
-	bool MathHelper::IsNan(double d) {
-		return std::isnan(d);
-	}
-	
-	double MathHelper::Sign(double value) {
-		if (value < 0) {
-			return -1;
-		}			
+		const double* vy = y.data();
+		const double* vx = x.data();
+		double* r = result.data();
 
-		return value > 0 ? 1 : 0;			
+		for (size_t i = 0; i < count; ++i) {
+			r[i] = fastAtan2(vy[i], vx[i]);
+		}
 	}
 
 }
@@ -1,11 +1,22 @@
 #ifndef MATHHELPER_H
 #define MATHHELPER_H
 
+#include <cmath>
 #include <limits>
+#include <type_traits>
+#include <vector>
 #include "CSharp.h"
 
 namespace Xna {
 
+	// Selects between the full precision <cmath> functions and the fast polynomial approximations of MathHelper.
+	enum class MathPrecision {
+		// Uses the <cmath> functions.
+		Precise,
+		// Uses the MathHelper::Fast* approximations.
+		Fast
+	};
+
 	//Contains commonly used precalculated values and mathematical operations.
 	struct MathHelper {
 
@@ -25,40 +36,40 @@ namespace Xna {
 		static constexpr double Tau = TwoPi;				
 
 		//Returns the Cartesian coordinate for one axis of a point that is defined by a given triangle and two normalized barycentric (areal) coordinates.
-		static double Barycentric(double, double, double, double, double);
+		static constexpr double Barycentric(double, double, double, double, double);
 		// Performs a Catmull-Rom interpolation using the specified positions.
-		static double CatmullRom(double, double, double, double, double);
+		static constexpr double CatmullRom(double, double, double, double, double);
 		// Restricts a value to be within a specified range.
-		static double Clamp(double, double, double);
+		static constexpr double Clamp(double, double, double);
 		// Restricts a value to be within a specified range.
-		static i32 Clamp(i32, i32, i32);
+		static constexpr i32 Clamp(i32, i32, i32);
 		// Calculates the absolute value of the difference of two values.
 		static double Distance(double, double);
 		// Performs a Hermite spline interpolation.
-		static double Hermite(double, double, double, double, double);
+		static constexpr double Hermite(double, double, double, double, double);
 		// Linearly interpolates between two values.
-		static double Lerp(double, double, double);
+		static constexpr double Lerp(double, double, double);
 		// Linearly interpolates between two values.
 		// This method is a less efficient, more precise version of Lerp.
-		static double LerpPrecise(double, double, double);
+		static constexpr double LerpPrecise(double, double, double);
 		// Returns the greater of two values.
-		static double Max(double, double);
+		static constexpr double Max(double, double);
 		// Returns the greater of two values.
-		static i32 Max(i32, i32);
+		static constexpr i32 Max(i32, i32);
 		// Returns the lesser of two values.
-		static double Min(double, double);
+		static constexpr double Min(double, double);
 		// Returns the lesser of two values.
-		static i32 Min(i32, i32);
+		static constexpr i32 Min(i32, i32);
 		// Interpolates between two values using a cubic equation.
-		static double SmoothStep(double, double, double);
+		static constexpr double SmoothStep(double, double, double);
 		// Converts radians to degrees.
-		static double ToDegrees(double);
+		static constexpr double ToDegrees(double);
 		// Converts degrees to radians.
-		static double ToRadians(double);
+		static constexpr double ToRadians(double);
 		// Reduces a given angle to a value between pi and -pi.
 		static double WrapAngle(double); 
 		// Determines if value is powered by two.
-		static bool IsPowerOfTwo(i32);
+		static constexpr bool IsPowerOfTwo(i32);
 
 		//----- C#: MathF.cs methods
 
@@ -73,11 +84,61 @@ namespace Xna {
 		static double Round(double value);
 		static double Ceiling(double value);
 		static double Floor(double value);
+		static double Atan2(double y, double x);
+
+		//----- Precision selectable versions of the MathF.cs methods
+
+		static double Sqrt(double value, MathPrecision precision);
+		static double Sin(double value, MathPrecision precision);
+		static double Cos(double value, MathPrecision precision);
+		static void SinCos(double value, double& sin, double& cos, MathPrecision precision = MathPrecision::Precise);
+		static double Atan2(double y, double x, MathPrecision precision);
+
+		//----- Fast approximations
+		// Branch-free polynomial kernels. The array versions run the same kernels in plain loops
+		// that the compiler can vectorize; they resize result to the input count.
+		// Errors are the largest measured against <cmath> over 2e7 random inputs in the stated domains,
+		// in ulps of the exact double result and, in brackets, of the same result rounded to float.
+
+		// Sine with a minimax polynomial on [-pi/4, pi/4] after quadrant reduction.
+		// For |value| <= 1e5: 65148 ulp (0.00013 float ulp), max absolute error 5.3e-12. Accuracy degrades for larger angles.
+		static double FastSin(double value);
+		// Cosine with a minimax polynomial on [-pi/4, pi/4] after quadrant reduction.
+		// For |value| <= 1e5: 65148 ulp (0.00013 float ulp), max absolute error 5.3e-12. Accuracy degrades for larger angles.
+		static double FastCos(double value);
+		// Sine and cosine sharing the same range reduction. Same error as FastSin and FastCos.
+		static void FastSinCos(double value, double& sin, double& cos);
+		// Reciprocal square root as 1 / std::sqrt, which is exact to 1 ulp. The hardware square root measured faster
+		// than a Newton-refined bit-level estimate, so the fast tier keeps it; see FastMathCheck.
+		static double FastRsqrt(double value);
+		// Square root as std::sqrt, exact, for the same reason as FastRsqrt.
+		static double FastSqrt(double value);
+		// Arc tangent of y/x in the range [-pi, pi] with a minimax polynomial on [0, 1] after octant reduction.
+		// 1.8e8 ulp (0.33 float ulp), from a relative error of 2e-8 as y/x goes to 0; max absolute error 9e-10 radians.
+		// Zeros of either sign give what std::atan2 gives: +-0 or +-pi.
+		static double FastAtan2(double y, double x);
+
+		static void FastSin(std::vector<double> const& values, std::vector<double>& result);
+		static void FastCos(std::vector<double> const& values, std::vector<double>& result);
+		static void FastSinCos(std::vector<double> const& values, std::vector<double>& sin, std::vector<double>& cos);
+		static void FastRsqrt(std::vector<double> const& values, std::vector<double>& result);
+		static void FastSqrt(std::vector<double> const& values, std::vector<double>& result);
+		static void FastAtan2(std::vector<double> const& y, std::vector<double> const& x, std::vector<double>& result);
+
+		//----- Constant expression versions
+		// When constant-evaluated these run a quadrant reduction followed by Taylor polynomials accurate to
+		// about 1 ulp for |value| <= 1e5. At runtime they call <cmath>, so results match Sin and Cos exactly.
+
+		static constexpr double ConstexprSin(double value);
+		static constexpr double ConstexprCos(double value);
+		static constexpr void ConstexprSinCos(double value, double& sin, double& cos);
 		
 		
 		//----- Others
 
 		static constexpr double EPSILON = std::numeric_limits<double>::epsilon();
+		//Represents a quiet NaN, returned by the intersection tests that find no hit.
+		static constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
 		//Represents the constant to converts radians to degrees.
 		static constexpr double RADIANS_TO_DEGREE = 57.295779513082320876798154814105;
 		//Represents the constant to converts degress to radians.
@@ -88,8 +149,215 @@ namespace Xna {
 		//Returns true if the value is infinity and greater then 0.
 		static bool IsPositiveInfinity(double);
 
-		static double MathHelper::Sign(double value);
-	};	
+		static constexpr double Sign(double value);
+	};
+
+	constexpr double MathHelper::Barycentric(double value1, double value2, double value3, double amount1, double amount2) {
+		return value1 + (value2 - value1)
+			* amount1 + (value3 - value1)
+			* amount2;
+	}
+
+	constexpr double MathHelper::CatmullRom(double value1, double value2, double value3, double value4, double amount) {
+		double amountSquared = amount * amount;
+		double amountCubed = amountSquared * amount;
+
+		return (0.5 * (2.0 * value2 +
+			(value3 - value1) * amount +
+			(2.0 * value1 - 5.0 * value2 + 4.0 * value3 - value4) * amountSquared +
+			(3.0 * value2 - value1 - 3.0 * value3 + value4) * amountCubed));
+	}
+
+	constexpr double MathHelper::Clamp(double value, double min, double max) {
+		value = (value > max) ? max : value;
+		value = (value < min) ? min : value;
+		return value;
+	}
+
+	constexpr i32 MathHelper::Clamp(i32 value, i32 min, i32 max) {
+		value = (value > max) ? max : value;
+		value = (value < min) ? min : value;
+		return value;
+	}
+
+	inline double MathHelper::Distance(double value1, double value2) {
+		return std::abs(value1 - value2);
+	}
+
+	constexpr double MathHelper::Hermite(double value1, double tangent1, double value2, double tangent2, double amount) {
+		double v1 = value1;
+		double v2 = value2;
+		double t1 = tangent1;
+		double t2 = tangent2;
+		double s = amount;
+		double result;
+
+		double sCubed = s * s * s;
+		double sSquared = s * s;
+
+		if (amount == 0)
+			result = value1;
+		else if (amount == 1)
+			result = value2;
+		else
+			result = (2 * v1 - 2 * v2 + t2 + t1) * sCubed +
+			(3 * v2 - 3 * v1 - 2 * t1 - t2) * sSquared +
+			t1 * s +
+			v1;
+
+		return result;
+	}
+
+	constexpr double MathHelper::Lerp(double value1, double value2, double amount) {
+		return value1 + (value2 - value1) * amount;
+	}
+
+	constexpr double MathHelper::LerpPrecise(double value1, double value2, double amount) {
+		return ((1 - amount) * value1) + (value2 * amount);
+	}
+
+	constexpr double MathHelper::Max(double value1, double value2) {
+		return value1 > value2 ? value1 : value2;
+	}
+
+	constexpr i32 MathHelper::Max(i32 value1, i32 value2) {
+		return value1 > value2 ? value1 : value2;
+	}
+
+	constexpr double MathHelper::Min(double value1, double value2) {
+		return value1 < value2 ? value1 : value2;
+	}
+
+	constexpr i32 MathHelper::Min(i32 value1, i32 value2) {
+		return value1 < value2 ? value1 : value2;
+	}
+
+	constexpr double MathHelper::SmoothStep(double value1, double value2, double amount) {
+		double result = Clamp(amount, 0.0, 1.0);
+		result = Hermite(value1, 0, value2, 0, result);
+
+		return result;
+	}
+
+	constexpr double MathHelper::ToDegrees(double radians) {
+		return radians * RADIANS_TO_DEGREE;
+	}
+
+	constexpr double MathHelper::ToRadians(double degrees) {
+		return degrees * DEGREE_TO_RADIANS;
+	}
+
+	constexpr bool MathHelper::IsPowerOfTwo(i32 value) {
+		return (value > 0) && ((value & (value - 1)) == 0);
+	}	
+
+	inline double MathHelper::Sqrt(double value) {
+		return std::sqrt(value);
+	}
+
+	inline double MathHelper::Pow(double x, double y) {
+		return std::pow(x, y);
+	}
+
+	inline double MathHelper::Sin(double value) {
+		return std::sin(value);
+	}
+
+	inline double MathHelper::Cos(double value) {
+		return std::cos(value);
+	}
+
+	inline double MathHelper::Tan(double value) {
+		return std::tan(value);
+	}
+
+	inline double MathHelper::Asin(double value) {
+		return std::asin(value);
+	}
+
+	inline double MathHelper::Acos(double value) {
+		return std::acos(value);
+	}
+
+	inline double MathHelper::Atan(double value) {
+		return std::atan(value);
+	}
+
+	inline double MathHelper::Round(double value) {
+		return std::round(value);
+	}
+
+	inline double MathHelper::Ceiling(double value) {
+		return std::ceil(value);
+	}
+
+	inline double MathHelper::Floor(double value) {
+		return std::floor(value);
+	}
+
+	inline double MathHelper::Atan2(double y, double x) {
+		return std::atan2(y, x);
+	}
+
+	inline bool MathHelper::IsPositiveInfinity(double value) {
+		return std::isinf(value) && value > 0;
+	}
+
+	inline bool MathHelper::IsNan(double d) {
+		return std::isnan(d);
+	}
+
+	constexpr double MathHelper::Sign(double value) {
+		if (value < 0) {
+			return -1;
+		}			
+
+		return value > 0 ? 1 : 0;			
+	}
+
+	constexpr void MathHelper::ConstexprSinCos(double value, double& sin, double& cos) {
+		if (!std::is_constant_evaluated()) {
+			sin = std::sin(value);
+			cos = std::cos(value);
+			return;
+		}
+
+		// pi/2 split so that quadrant * PiOver2Hi is exact.
+		constexpr double PiOver2Hi = 1.57079632673412561417;
+		constexpr double PiOver2Lo = 6.07710050650619224932e-11;
+
+		double q = value * (2.0 / Pi);
+		i64 quadrant = static_cast<i64>(q < 0 ? q - 0.5 : q + 0.5);
+		double n = static_cast<double>(quadrant);
+		double r = (value - n * PiOver2Hi) - n * PiOver2Lo;
+		double r2 = r * r;
+
+		double s = r * (1.0 + r2 * (-1.0 / 6 + r2 * (1.0 / 120 + r2 * (-1.0 / 5040 + r2 * (1.0 / 362880
+			+ r2 * (-1.0 / 39916800 + r2 * (1.0 / 6227020800 + r2 * (-1.0 / 1307674368000))))))));
+		double c = 1.0 + r2 * (-1.0 / 2 + r2 * (1.0 / 24 + r2 * (-1.0 / 720 + r2 * (1.0 / 40320
+			+ r2 * (-1.0 / 3628800 + r2 * (1.0 / 479001600 + r2 * (-1.0 / 87178291200 + r2 * (1.0 / 20922789888000))))))));
+
+		switch (quadrant & 3) {
+		case 0: sin = s; cos = c; break;
+		case 1: sin = c; cos = -s; break;
+		case 2: sin = -s; cos = -c; break;
+		default: sin = -c; cos = s; break;
+		}
+	}
+
+	constexpr double MathHelper::ConstexprSin(double value) {
+		double sin = 0;
+		double cos = 0;
+		ConstexprSinCos(value, sin, cos);
+		return sin;
+	}
+
+	constexpr double MathHelper::ConstexprCos(double value) {
+		double sin = 0;
+		double cos = 0;
+		ConstexprSinCos(value, sin, cos);
+		return cos;
+	}
 }
 
 #endif
\ No newline at end of file
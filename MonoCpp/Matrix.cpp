@@ -5,25 +5,6 @@
 
 namespace Xna {
 
-	Matrix::Matrix() :
-		M11(0), M12(0), M13(0), M14(0),
-		M21(0), M22(0), M23(0), M24(0),
-		M31(0), M32(0), M33(0), M34(0),
-		M41(0), M42(0), M43(0), M44(0) {}
-
-	Matrix::Matrix(double m11, double m12, double m13, double m14, double m21, double m22, double m23, double m24, double m31,
-		double m32, double m33, double m34, double m41, double m42, double m43, double m44) :
-		M11(m11), M12(m12), M13(m13), M14(m14),
-		M21(m21), M22(m22), M23(m23), M24(m24),
-		M31(m31), M32(m32), M33(m33), M34(m34),
-		M41(m41), M42(m42), M43(m43), M44(m44) {}
-
-	Matrix::Matrix(Vector4 row1, Vector4 row2, Vector4 row3, Vector4 row4) :
-		M11(row1.X), M12(row1.Y), M13(row1.Z), M14(row1.W),
-		M21(row2.X), M22(row2.Y), M23(row2.Z), M24(row2.W),
-		M31(row3.X), M32(row3.Y), M33(row3.Z), M34(row3.W),
-		M41(row4.X), M42(row4.Y), M43(row4.Z), M44(row4.W) {}
-
 	//----- Operators
 
 	double& Matrix::operator[] (size_t index) {
@@ -61,67 +42,26 @@ namespace Xna {
 		return Matrix::Negate(matrix);
 	}
 
-	Matrix operator+ (Matrix matrix1, Matrix matrix2) {
-		return Matrix::Add(matrix1, matrix2);
-	}
-
-	Matrix operator- (Matrix matrix1, Matrix matrix2) {
-		return Matrix::Subtract(matrix1, matrix2);
-	}
-
-	Matrix operator/ (Matrix matrix1, Matrix matrix2) {
-		return Matrix::Divide(matrix1, matrix2);
-	}
-
-	Matrix operator/ (Matrix matrix, double divider) {
-		return Matrix::Divide(matrix, divider);
-	}
-
-	Matrix operator* (Matrix matrix1, Matrix matrix2) {
-		return Matrix::Multiply(matrix1, matrix2);
-	}
-
-	Matrix operator* (Matrix matrix, double scaleFactor) {
-		return Matrix::Multiply(matrix, scaleFactor);
-	}
-
-
-	bool operator== (Matrix matrix1, Matrix matrix2) {
-		return matrix1.Equals(matrix2);
-	}
-
-	bool operator!= (Matrix matrix1, Matrix matrix2) {
-		return !matrix1.Equals(matrix2);
-	}
-	
 	//----- Static
-	Matrix Matrix::Identity() {
-		return Matrix(
-			1, 0, 0, 0,
-			0, 1, 0, 0,
-			0, 0, 1, 0,
-			0, 0, 0, 1);
-	}
 
-	Matrix Matrix::Add(Matrix const& matrix1, Matrix const& matrix2) {
-		Matrix result = matrix1;
-		
-		result.M11 += matrix2.M11;
-		result.M12 += matrix2.M12;
-		result.M13 += matrix2.M13;
-		result.M14 += matrix2.M14;
-		result.M21 += matrix2.M21;
-		result.M22 += matrix2.M22;
-		result.M23 += matrix2.M23;
-		result.M24 += matrix2.M24;
-		result.M31 += matrix2.M31;
-		result.M32 += matrix2.M32;
-		result.M33 += matrix2.M33;
-		result.M34 += matrix2.M34;
-		result.M41 += matrix2.M41;
-		result.M42 += matrix2.M42;
-		result.M43 += matrix2.M43;
-		result.M44 += matrix2.M44;
+	Matrix Matrix::CreateAffineTransformation(double scaling, Vector3 const& rotationCenter, Quaternion const& rotation, Vector3 const& translation) {
+		// Scale, move the rotation center to the origin, rotate, move it back and translate.
+		Matrix result = CreateFromQuaternion(rotation);
+		Vector3 rotatedCenter = Vector3::TransformNormal(rotationCenter, result);
+
+		result.M11 *= scaling;
+		result.M12 *= scaling;
+		result.M13 *= scaling;
+		result.M21 *= scaling;
+		result.M22 *= scaling;
+		result.M23 *= scaling;
+		result.M31 *= scaling;
+		result.M32 *= scaling;
+		result.M33 *= scaling;
+		result.M41 = rotationCenter.X - rotatedCenter.X + translation.X;
+		result.M42 = rotationCenter.Y - rotatedCenter.Y + translation.Y;
+		result.M43 = rotationCenter.Z - rotatedCenter.Z + translation.Z;
+
 		return result;
 	}
 
@@ -309,6 +249,10 @@ namespace Xna {
 		return result;
 	}
 
+	Matrix Matrix::CreateFromTRS(Vector3 const& translation, Quaternion const& rotation, Vector3 const& scale) {
+		return AffineMatrix::CreateFromTRS(translation, rotation, scale).ToMatrix();
+	}
+
 	Matrix Matrix::CreateFromYawPitchRoll(double yaw, double pitch, double roll) {
 		Quaternion quaternion =	Quaternion::CreateFromYawPitchRoll(yaw, pitch, roll);
 		return CreateFromQuaternion(quaternion);
@@ -447,11 +391,12 @@ namespace Xna {
 		return result;
 	}
 
-	Matrix Matrix::CreateRotationX(double radians) {
+	Matrix Matrix::CreateRotationX(double radians, MathPrecision precision) {
 		Matrix result = Matrix::Identity();
 
-		double val1 = cos(radians);
-		double val2 = sin(radians);
+		double val1;
+		double val2;
+		MathHelper::SinCos(radians, val2, val1, precision);
 
 		result.M22 = val1;
 		result.M23 = val2;
@@ -461,11 +406,12 @@ namespace Xna {
 		return result;
 	}
 
-	Matrix Matrix::CreateRotationY(double radians) {
+	Matrix Matrix::CreateRotationY(double radians, MathPrecision precision) {
 		Matrix result = Matrix::Identity();
 
-		double val1 = cos(radians);
-		double val2 = sin(radians);
+		double val1;
+		double val2;
+		MathHelper::SinCos(radians, val2, val1, precision);
 
 		result.M11 = val1;
 		result.M13 = -val2;
@@ -475,11 +421,12 @@ namespace Xna {
 		return result;
 	}
 
-	Matrix Matrix::CreateRotationZ(double radians) {
+	Matrix Matrix::CreateRotationZ(double radians, MathPrecision precision) {
 		Matrix result = Matrix::Identity();
 
-		double val1 = cos(radians);
-		double val2 = sin(radians);
+		double val1;
+		double val2;
+		MathHelper::SinCos(radians, val2, val1, precision);
 
 		result.M11 = val1;
 		result.M12 = val2;
@@ -489,58 +436,6 @@ namespace Xna {
 		return result;
 	}
 
-	Matrix Matrix::CreateScale(double scale) {
-		return CreateScale(scale, scale, scale);
-	}
-
-	Matrix Matrix::CreateScale(double xScale, double yScale, double zScale) {
-
-		Matrix result;
-
-		result.M11 = xScale;
-		result.M12 = 0;
-		result.M13 = 0;
-		result.M14 = 0;
-		result.M21 = 0;
-		result.M22 = yScale;
-		result.M23 = 0;
-		result.M24 = 0;
-		result.M31 = 0;
-		result.M32 = 0;
-		result.M33 = zScale;
-		result.M34 = 0;
-		result.M41 = 0;
-		result.M42 = 0;
-		result.M43 = 0;
-		result.M44 = 1;
-
-		return result;
-	}
-
-	Matrix Matrix::CreateScale(Vector3 const& scales) {
-
-		Matrix result;
-
-		result.M11 = scales.X;
-		result.M12 = 0;
-		result.M13 = 0;
-		result.M14 = 0;
-		result.M21 = 0;
-		result.M22 = scales.Y;
-		result.M23 = 0;
-		result.M24 = 0;
-		result.M31 = 0;
-		result.M32 = 0;
-		result.M33 = scales.Z;
-		result.M34 = 0;
-		result.M41 = 0;
-		result.M42 = 0;
-		result.M43 = 0;
-		result.M44 = 1;
-
-		return result;
-	}
-
 	Matrix Matrix::CreateShadow(Vector3 const& lightDirection, Plane const& plane) {
 		double dot = (plane.Normal.X * lightDirection.X) + (plane.Normal.Y * lightDirection.Y) + (plane.Normal.Z * lightDirection.Z);
 		double x = -plane.Normal.X;
@@ -569,32 +464,6 @@ namespace Xna {
 		return result;
 	}
 
-	Matrix Matrix::CreateTranslation(double xPosition, double yPosition, double zPosition) {
-		return Matrix::CreateTranslation(Vector3(xPosition, yPosition, zPosition));
-	}
-
-	Matrix Matrix::CreateTranslation(Vector3 const& position) {
-		Matrix result;
-		result.M11 = 1;
-		result.M12 = 0;
-		result.M13 = 0;
-		result.M14 = 0;
-		result.M21 = 0;
-		result.M22 = 1;
-		result.M23 = 0;
-		result.M24 = 0;
-		result.M31 = 0;
-		result.M32 = 0;
-		result.M33 = 1;
-		result.M34 = 0;
-		result.M41 = position.X;
-		result.M42 = position.Y;
-		result.M43 = position.Z;
-		result.M44 = 1;
-
-		return result;
-	}
-
 	Matrix Matrix::CreateReflection(Plane const& value) {
 		Plane plane = Plane::Normalize(value);
 		double x = plane.Normal.X;
@@ -643,52 +512,6 @@ namespace Xna {
 		return result;
 	}
 
-
-	Matrix Matrix::Divide(Matrix const& matrix1, Matrix const& matrix2) {
-		Matrix result;
-
-		result.M11 = matrix1.M11 / matrix2.M11;
-		result.M12 = matrix1.M12 / matrix2.M12;
-		result.M13 = matrix1.M13 / matrix2.M13;
-		result.M14 = matrix1.M14 / matrix2.M14;
-		result.M21 = matrix1.M21 / matrix2.M21;
-		result.M22 = matrix1.M22 / matrix2.M22;
-		result.M23 = matrix1.M23 / matrix2.M23;
-		result.M24 = matrix1.M24 / matrix2.M24;
-		result.M31 = matrix1.M31 / matrix2.M31;
-		result.M32 = matrix1.M32 / matrix2.M32;
-		result.M33 = matrix1.M33 / matrix2.M33;
-		result.M34 = matrix1.M34 / matrix2.M34;
-		result.M41 = matrix1.M41 / matrix2.M41;
-		result.M42 = matrix1.M42 / matrix2.M42;
-		result.M43 = matrix1.M43 / matrix2.M43;
-		result.M44 = matrix1.M44 / matrix2.M44;
-		return result;
-	}
-
-	Matrix Matrix::Divide(Matrix const& matrix1, double divider) {
-		Matrix result;
-		
-		double num = 1.0 / divider;
-		result.M11 = matrix1.M11 * num;
-		result.M12 = matrix1.M12 * num;
-		result.M13 = matrix1.M13 * num;
-		result.M14 = matrix1.M14 * num;
-		result.M21 = matrix1.M21 * num;
-		result.M22 = matrix1.M22 * num;
-		result.M23 = matrix1.M23 * num;
-		result.M24 = matrix1.M24 * num;
-		result.M31 = matrix1.M31 * num;
-		result.M32 = matrix1.M32 * num;
-		result.M33 = matrix1.M33 * num;
-		result.M34 = matrix1.M34 * num;
-		result.M41 = matrix1.M41 * num;
-		result.M42 = matrix1.M42 * num;
-		result.M43 = matrix1.M43 * num;
-		result.M44 = matrix1.M44 * num;
-		return result;
-	}
-
 	Matrix Matrix::Invert(Matrix const& matrix) {
 		double num1 = matrix.M11;
 		double num2 = matrix.M12;
@@ -773,66 +596,6 @@ namespace Xna {
 		return result;
 	}
 
-	Matrix Matrix::Multiply(Matrix const& matrix1, Matrix const& matrix2) {
-		double m11 = (((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41);
-		double m12 = (((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42);
-		double m13 = (((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43);
-		double m14 = (((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44);
-		double m21 = (((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41);
-		double m22 = (((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42);
-		double m23 = (((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43);
-		double m24 = (((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44);
-		double m31 = (((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41);
-		double m32 = (((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42);
-		double m33 = (((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43);
-		double m34 = (((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44);
-		double m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41);
-		double m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42);
-		double m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43);
-		double m44 = (((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44);
-		
-		Matrix result;
-		result.M11 = m11;
-		result.M12 = m12;
-		result.M13 = m13;
-		result.M14 = m14;
-		result.M21 = m21;
-		result.M22 = m22;
-		result.M23 = m23;
-		result.M24 = m24;
-		result.M31 = m31;
-		result.M32 = m32;
-		result.M33 = m33;
-		result.M34 = m34;
-		result.M41 = m41;
-		result.M42 = m42;
-		result.M43 = m43;
-		result.M44 = m44;
-		return result;
-	}
-
-	Matrix Matrix::Multiply(Matrix const& matrix, double scaleFactor) {
-		Matrix result = matrix;
-
-		result.M11 *= scaleFactor;
-		result.M12 *= scaleFactor;
-		result.M13 *= scaleFactor;
-		result.M14 *= scaleFactor;
-		result.M21 *= scaleFactor;
-		result.M22 *= scaleFactor;
-		result.M23 *= scaleFactor;
-		result.M24 *= scaleFactor;
-		result.M31 *= scaleFactor;
-		result.M32 *= scaleFactor;
-		result.M33 *= scaleFactor;
-		result.M34 *= scaleFactor;
-		result.M41 *= scaleFactor;
-		result.M42 *= scaleFactor;
-		result.M43 *= scaleFactor;
-		result.M44 *= scaleFactor;
-		return result;
-	}
-
 	std::vector<double> Matrix::ToDoubleArray(Matrix const& matrix) {
 
 		return std::vector<double> {
@@ -843,76 +606,25 @@ namespace Xna {
 		};
 	}
 
-	Matrix Matrix::Negate(Matrix const& matrix) {
-		Matrix result;
-		
-		result.M11 = -matrix.M11;
-		result.M12 = -matrix.M12;
-		result.M13 = -matrix.M13;
-		result.M14 = -matrix.M14;
-		result.M21 = -matrix.M21;
-		result.M22 = -matrix.M22;
-		result.M23 = -matrix.M23;
-		result.M24 = -matrix.M24;
-		result.M31 = -matrix.M31;
-		result.M32 = -matrix.M32;
-		result.M33 = -matrix.M33;
-		result.M34 = -matrix.M34;
-		result.M41 = -matrix.M41;
-		result.M42 = -matrix.M42;
-		result.M43 = -matrix.M43;
-		result.M44 = -matrix.M44;
-		return result;
-	}
-
-	Matrix Matrix::Subtract(Matrix const& matrix1, Matrix const& matrix2) {
-
-		Matrix result;
+	std::pmr::vector<double> Matrix::ToDoubleArray(Matrix const& matrix, std::pmr::memory_resource* resource) {
 
-		result.M11 = matrix1.M11 - matrix2.M11;
-		result.M12 = matrix1.M12 - matrix2.M12;
-		result.M13 = matrix1.M13 - matrix2.M13;
-		result.M14 = matrix1.M14 - matrix2.M14;
-		result.M21 = matrix1.M21 - matrix2.M21;
-		result.M22 = matrix1.M22 - matrix2.M22;
-		result.M23 = matrix1.M23 - matrix2.M23;
-		result.M24 = matrix1.M24 - matrix2.M24;
-		result.M31 = matrix1.M31 - matrix2.M31;
-		result.M32 = matrix1.M32 - matrix2.M32;
-		result.M33 = matrix1.M33 - matrix2.M33;
-		result.M34 = matrix1.M34 - matrix2.M34;
-		result.M41 = matrix1.M41 - matrix2.M41;
-		result.M42 = matrix1.M42 - matrix2.M42;
-		result.M43 = matrix1.M43 - matrix2.M43;
-		result.M44 = matrix1.M44 - matrix2.M44;
-		return result;
+		return std::pmr::vector<double>({
+				matrix.M11, matrix.M12, matrix.M13, matrix.M14,
+				matrix.M21, matrix.M22, matrix.M23, matrix.M24,
+				matrix.M31, matrix.M32, matrix.M33, matrix.M34,
+				matrix.M41, matrix.M42, matrix.M43, matrix.M44
+		}, resource);
 	}
 
-	Matrix Matrix::Transpose(Matrix const& matrix) {
-		Matrix ret;
-
-		ret.M11 = matrix.M11;
-		ret.M12 = matrix.M21;
-		ret.M13 = matrix.M31;
-		ret.M14 = matrix.M41;
-
-		ret.M21 = matrix.M12;
-		ret.M22 = matrix.M22;
-		ret.M23 = matrix.M32;
-		ret.M24 = matrix.M42;
-
-		ret.M31 = matrix.M13;
-		ret.M32 = matrix.M23;
-		ret.M33 = matrix.M33;
-		ret.M34 = matrix.M43;
-
-		ret.M41 = matrix.M14;
-		ret.M42 = matrix.M24;
-		ret.M43 = matrix.M34;
-		ret.M44 = matrix.M44;
+	void Matrix::ToDoubleArray(Matrix const& matrix, std::vector<double>& result) {
 
-		return ret;
-	}	
+		result.assign({
+				matrix.M11, matrix.M12, matrix.M13, matrix.M14,
+				matrix.M21, matrix.M22, matrix.M23, matrix.M24,
+				matrix.M31, matrix.M32, matrix.M33, matrix.M34,
+				matrix.M41, matrix.M42, matrix.M43, matrix.M44
+		});
+	}
 
 	//----- Members
 
@@ -1042,22 +754,4 @@ namespace Xna {
 			- (num19 * (((num12 * num16) - (num11 * num14)) + (num10 * num13))));
 	}
 
-	bool Matrix::Equals(Matrix const& other) const {
-		return (M11 == other.M11)
-			&& (M22 == other.M22)
-			&& (M33 == other.M33)
-			&& (M44 == other.M44)
-			&& (M12 == other.M12)
-			&& (M13 == other.M13)
-			&& (M14 == other.M14)
-			&& (M21 == other.M21)
-			&& (M23 == other.M23)
-			&& (M24 == other.M24)
-			&& (M31 == other.M31)
-			&& (M32 == other.M32)
-			&& (M34 == other.M34) 
-			&& (M41 == other.M41)
-			&& (M42 == other.M42)
-			&& (M43 == other.M43);
-	}
 }
\ No newline at end of file
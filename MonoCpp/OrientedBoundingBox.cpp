@@ -0,0 +1,361 @@
+#include <cmath>
+#include <limits>
+#include "Space3d.h"
+#include "MathHelper.h"
+#include "Parallel.h"
+
+namespace Xna {
+
+	// Added to the rotation terms of the box-box test so nearly parallel edges, whose cross
+	// product is close to zero, cannot make a separating axis out of rounding errors.
+	static constexpr double ParallelEpsilon = 1e-12;
+
+	// A box with its axes expanded, prepared once for any number of tests.
+	struct BoxFrame {
+		Vector3 Center;
+		double Extents[3];
+		Vector3 Axes[3];
+	};
+
+	// The planes and corners of a frustum, read once for any number of tests.
+	struct FrustumShape {
+		Plane Planes[BoundingFrustum::PlaneCount];
+		Vector3 Corners[BoundingFrustum::CornerCount];
+	};
+
+	static void axesOf(Quaternion const& q, Vector3* axes) {
+		// Matrix::CreateFromQuaternion, scaled so quaternions that are not unit still give unit axes.
+		const double length = (q.X * q.X) + (q.Y * q.Y) + (q.Z * q.Z) + (q.W * q.W);
+		const double s = length > 0 ? 2.0 / length : 0.0;
+
+		const double xx = q.X * q.X * s, yy = q.Y * q.Y * s, zz = q.Z * q.Z * s;
+		const double xy = q.X * q.Y * s, zw = q.Z * q.W * s, zx = q.Z * q.X * s;
+		const double yw = q.Y * q.W * s, yz = q.Y * q.Z * s, xw = q.X * q.W * s;
+
+		axes[0] = Vector3(1.0 - (yy + zz), xy + zw, zx - yw);
+		axes[1] = Vector3(xy - zw, 1.0 - (zz + xx), yz + xw);
+		axes[2] = Vector3(zx + yw, yz - xw, 1.0 - (yy + xx));
+	}
+
+	static BoxFrame frameOf(OrientedBoundingBox const& box) {
+		BoxFrame frame;
+		frame.Center = box.Center;
+		frame.Extents[0] = std::abs(box.Extents.X);
+		frame.Extents[1] = std::abs(box.Extents.Y);
+		frame.Extents[2] = std::abs(box.Extents.Z);
+		axesOf(box.Orientation, frame.Axes);
+
+		return frame;
+	}
+
+	static BoxFrame frameOf(BoundingBox const& box) {
+		BoxFrame frame;
+		frame.Center = (box.Min + box.Max) * 0.5;
+		frame.Extents[0] = (box.Max.X - box.Min.X) * 0.5;
+		frame.Extents[1] = (box.Max.Y - box.Min.Y) * 0.5;
+		frame.Extents[2] = (box.Max.Z - box.Min.Z) * 0.5;
+		frame.Axes[0] = Vector3(1, 0, 0);
+		frame.Axes[1] = Vector3(0, 1, 0);
+		frame.Axes[2] = Vector3(0, 0, 1);
+
+		return frame;
+	}
+
+	static FrustumShape shapeOf(BoundingFrustum const& frustum) {
+		FrustumShape shape;
+		shape.Planes[0] = frustum.Near();
+		shape.Planes[1] = frustum.Far();
+		shape.Planes[2] = frustum.Left();
+		shape.Planes[3] = frustum.Right();
+		shape.Planes[4] = frustum.Top();
+		shape.Planes[5] = frustum.Bottom();
+
+		frustum.GetCorners(shape.Corners);
+
+		return shape;
+	}
+
+	// The separating axis test of two boxes: the 3 axes of each and the 9 cross products of an axis of each.
+	// Both are expressed in the frame of a, with R the rotation from b to a.
+	static bool overlaps(BoxFrame const& a, BoxFrame const& b) {
+		double r[3][3];
+		double absR[3][3];
+
+		for (i32 i = 0; i < 3; ++i) {
+			for (i32 j = 0; j < 3; ++j) {
+				r[i][j] = Vector3::Dot(a.Axes[i], b.Axes[j]);
+				absR[i][j] = std::abs(r[i][j]) + ParallelEpsilon;
+			}
+		}
+
+		const Vector3 offset = b.Center - a.Center;
+		const double t[3] = { Vector3::Dot(offset, a.Axes[0]), Vector3::Dot(offset, a.Axes[1]), Vector3::Dot(offset, a.Axes[2]) };
+		const double* ea = a.Extents;
+		const double* eb = b.Extents;
+
+		for (i32 i = 0; i < 3; ++i) {
+			if (std::abs(t[i]) > ea[i] + (eb[0] * absR[i][0]) + (eb[1] * absR[i][1]) + (eb[2] * absR[i][2]))
+				return false;
+		}
+
+		for (i32 j = 0; j < 3; ++j) {
+			const double distance = (t[0] * r[0][j]) + (t[1] * r[1][j]) + (t[2] * r[2][j]);
+
+			if (std::abs(distance) > (ea[0] * absR[0][j]) + (ea[1] * absR[1][j]) + (ea[2] * absR[2][j]) + eb[j])
+				return false;
+		}
+
+		for (i32 i = 0; i < 3; ++i) {
+			const i32 i1 = (i + 1) % 3;
+			const i32 i2 = (i + 2) % 3;
+
+			for (i32 j = 0; j < 3; ++j) {
+				const i32 j1 = (j + 1) % 3;
+				const i32 j2 = (j + 2) % 3;
+
+				const double ra = (ea[i1] * absR[i2][j]) + (ea[i2] * absR[i1][j]);
+				const double rb = (eb[j1] * absR[i][j2]) + (eb[j2] * absR[i][j1]);
+
+				if (std::abs((t[i2] * r[i1][j]) - (t[i1] * r[i2][j])) > ra + rb)
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	static bool overlaps(BoxFrame const& box, BoundingSphere const& sphere) {
+		// The closest point of the box to the center, found in the frame of the box.
+		const Vector3 offset = sphere.Center - box.Center;
+		double distanceSquared = 0;
+
+		for (i32 i = 0; i < 3; ++i) {
+			const double d = Vector3::Dot(offset, box.Axes[i]);
+			const double excess = d > box.Extents[i] ? d - box.Extents[i] : (d < -box.Extents[i] ? d + box.Extents[i] : 0.0);
+			distanceSquared += excess * excess;
+		}
+
+		return distanceSquared <= sphere.Radius * sphere.Radius;
+	}
+
+	static bool overlaps(BoxFrame const& box, FrustumShape const& frustum) {
+		// The frustum planes face outwards: a box wholly in front of one is outside.
+		for (Plane const& plane : frustum.Planes) {
+			const double radius =
+				(box.Extents[0] * std::abs(Vector3::Dot(plane.Normal, box.Axes[0]))) +
+				(box.Extents[1] * std::abs(Vector3::Dot(plane.Normal, box.Axes[1]))) +
+				(box.Extents[2] * std::abs(Vector3::Dot(plane.Normal, box.Axes[2])));
+
+			if (plane.DotCoordinate(box.Center) > radius)
+				return false;
+		}
+
+		// The axes of the box, against the extent of the frustum corners along them.
+		for (i32 i = 0; i < 3; ++i) {
+			double min = std::numeric_limits<double>::max();
+			double max = std::numeric_limits<double>::lowest();
+
+			for (Vector3 const& corner : frustum.Corners) {
+				const double d = Vector3::Dot(corner - box.Center, box.Axes[i]);
+				min = d < min ? d : min;
+				max = d > max ? d : max;
+			}
+
+			if (min > box.Extents[i] || max < -box.Extents[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	// Runs test on every box in parallel and counts the hits.
+	template <typename Test>
+	static size_t intersectAll(std::vector<OrientedBoundingBox> const& boxes, std::vector<byte>& result, Test const& test) {
+		result.resize(boxes.size());
+
+		Parallel::For(boxes.size(), Parallel::DefaultChunkSize, [&](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i)
+				result[i] = test(frameOf(boxes[i])) ? 1 : 0;
+		});
+
+		size_t count = 0;
+
+		for (byte hit : result)
+			count += hit;
+
+		return count;
+	}
+
+	// Constructors
+
+	OrientedBoundingBox::OrientedBoundingBox() :
+		Center(0), Extents(0), Orientation(Quaternion::Identity()) {}
+
+	OrientedBoundingBox::OrientedBoundingBox(Vector3 center, Vector3 extents, Quaternion orientation) :
+		Center(center), Extents(extents), Orientation(orientation) {}
+
+	// Operators
+
+	bool operator ==(OrientedBoundingBox const& a, OrientedBoundingBox const& b) {
+		return a.Equals(b);
+	}
+
+	bool operator !=(OrientedBoundingBox const& a, OrientedBoundingBox const& b) {
+		return !a.Equals(b);
+	}
+
+	// Static
+
+	OrientedBoundingBox OrientedBoundingBox::CreateFromBoundingBox(BoundingBox const& box, Quaternion const& rotation, Vector3 const& translation) {
+		const Vector3 center = (box.Min + box.Max) * 0.5;
+		return OrientedBoundingBox(Vector3::Transform(center, rotation) + translation, (box.Max - box.Min) * 0.5, rotation);
+	}
+
+	OrientedBoundingBox OrientedBoundingBox::CreateFromBoundingBox(BoundingBox const& box, Matrix const& transform) {
+		Vector3 scale;
+		Quaternion rotation;
+		Vector3 translation;
+		transform.Decompose(scale, rotation, translation);
+
+		const Vector3 center = (box.Min + box.Max) * 0.5;
+		const Vector3 extents = (box.Max - box.Min) * 0.5;
+
+		return OrientedBoundingBox(Vector3::Transform(center, transform),
+			Vector3(std::abs(extents.X * scale.X), std::abs(extents.Y * scale.Y), std::abs(extents.Z * scale.Z)), rotation);
+	}
+
+	size_t OrientedBoundingBox::Intersects(std::vector<OrientedBoundingBox> const& boxes, OrientedBoundingBox const& box, std::vector<byte>& result) {
+		const BoxFrame other = frameOf(box);
+		return intersectAll(boxes, result, [&](BoxFrame const& frame) { return overlaps(frame, other); });
+	}
+
+	size_t OrientedBoundingBox::Intersects(std::vector<OrientedBoundingBox> const& boxes, BoundingBox const& box, std::vector<byte>& result) {
+		const BoxFrame other = frameOf(box);
+		return intersectAll(boxes, result, [&](BoxFrame const& frame) { return overlaps(frame, other); });
+	}
+
+	size_t OrientedBoundingBox::Intersects(std::vector<OrientedBoundingBox> const& boxes, BoundingSphere const& sphere, std::vector<byte>& result) {
+		return intersectAll(boxes, result, [&](BoxFrame const& frame) { return overlaps(frame, sphere); });
+	}
+
+	size_t OrientedBoundingBox::Intersects(std::vector<OrientedBoundingBox> const& boxes, BoundingFrustum const& frustum, std::vector<byte>& result) {
+		const FrustumShape shape = shapeOf(frustum);
+		return intersectAll(boxes, result, [&](BoxFrame const& frame) { return overlaps(frame, shape); });
+	}
+
+	// Members
+
+	void OrientedBoundingBox::GetAxes(Vector3& x, Vector3& y, Vector3& z) const {
+		Vector3 axes[3];
+		axesOf(Orientation, axes);
+
+		x = axes[0];
+		y = axes[1];
+		z = axes[2];
+	}
+
+	void OrientedBoundingBox::GetCorners(std::vector<Vector3>& corners) const {
+		const BoxFrame frame = frameOf(*this);
+		const Vector3 x = frame.Axes[0] * frame.Extents[0];
+		const Vector3 y = frame.Axes[1] * frame.Extents[1];
+		const Vector3 z = frame.Axes[2] * frame.Extents[2];
+
+		corners.resize(CornerCount);
+		corners[0] = Center - x + y + z;
+		corners[1] = Center + x + y + z;
+		corners[2] = Center + x - y + z;
+		corners[3] = Center - x - y + z;
+		corners[4] = Center - x + y - z;
+		corners[5] = Center + x + y - z;
+		corners[6] = Center + x - y - z;
+		corners[7] = Center - x - y - z;
+	}
+
+	BoundingBox OrientedBoundingBox::GetBoundingBox() const {
+		const BoxFrame frame = frameOf(*this);
+		Vector3 half(0);
+
+		for (i32 i = 0; i < 3; ++i) {
+			half.X += std::abs(frame.Axes[i].X) * frame.Extents[i];
+			half.Y += std::abs(frame.Axes[i].Y) * frame.Extents[i];
+			half.Z += std::abs(frame.Axes[i].Z) * frame.Extents[i];
+		}
+
+		return BoundingBox(Center - half, Center + half);
+	}
+
+	ContainmentType OrientedBoundingBox::Contains(Vector3 const& point) const {
+		const BoxFrame frame = frameOf(*this);
+		const Vector3 offset = point - Center;
+
+		for (i32 i = 0; i < 3; ++i) {
+			if (std::abs(Vector3::Dot(offset, frame.Axes[i])) > frame.Extents[i])
+				return ContainmentType::Disjoint;
+		}
+
+		return ContainmentType::Contains;
+	}
+
+	bool OrientedBoundingBox::Intersects(OrientedBoundingBox const& box) const {
+		return overlaps(frameOf(*this), frameOf(box));
+	}
+
+	bool OrientedBoundingBox::Intersects(BoundingBox const& box) const {
+		return overlaps(frameOf(*this), frameOf(box));
+	}
+
+	bool OrientedBoundingBox::Intersects(BoundingSphere const& sphere) const {
+		return overlaps(frameOf(*this), sphere);
+	}
+
+	bool OrientedBoundingBox::Intersects(BoundingFrustum const& frustum) const {
+		return overlaps(frameOf(*this), shapeOf(frustum));
+	}
+
+	double OrientedBoundingBox::Intersects(Ray const& ray) const {
+		// The slab test of Ray::Intersects(BoundingBox), in the frame of the box. A rotation keeps
+		// lengths, so distances along the ray are the same in both frames.
+		const BoxFrame frame = frameOf(*this);
+		const Vector3 offset = ray.Position - Center;
+		double tMin = std::numeric_limits<double>::lowest();
+		double tMax = std::numeric_limits<double>::max();
+
+		for (i32 i = 0; i < 3; ++i) {
+			const double position = Vector3::Dot(offset, frame.Axes[i]);
+			const double direction = Vector3::Dot(ray.Direction, frame.Axes[i]);
+			const double extent = frame.Extents[i];
+
+			if (std::abs(direction) < MathHelper::EPSILON) {
+				if (position < -extent || position > extent)
+					return MathHelper::NaN;
+
+				continue;
+			}
+
+			double t1 = (-extent - position) / direction;
+			double t2 = (extent - position) / direction;
+
+			if (t1 > t2) {
+				const double temp = t1;
+				t1 = t2;
+				t2 = temp;
+			}
+
+			tMin = t1 > tMin ? t1 : tMin;
+			tMax = t2 < tMax ? t2 : tMax;
+
+			if (tMin > tMax)
+				return MathHelper::NaN;
+		}
+
+		// A ray that starts inside the box hits it at 0; a box behind the ray is missed.
+		if (tMax < 0)
+			return MathHelper::NaN;
+
+		return tMin < 0 ? 0 : tMin;
+	}
+
+	bool OrientedBoundingBox::Equals(OrientedBoundingBox const& other) const {
+		return Center == other.Center && Extents == other.Extents && Orientation == other.Orientation;
+	}
+}
@@ -0,0 +1,368 @@
+#include <bit>
+#include <cmath>
+#include "PackedVector.h"
+
+namespace Xna {
+
+	// Stored components of PackedQuaternion lie in [-1/sqrt(2), 1/sqrt(2)] and use 10 bits.
+	static constexpr double QuaternionRange = 0.70710678118654752440;
+	static constexpr double QuaternionSteps = 1023.0;
+	static constexpr double NormalSteps = 32767.0;
+
+	static double clamp(double value, double min, double max) {
+		return value < min ? min : (value > max ? max : value);
+	}
+
+	// Sign that never returns 0, so points on the octahedron edges fold consistently.
+	static double signNotZero(double value) {
+		return value < 0 ? -1.0 : 1.0;
+	}
+
+	//----- HalfSingle
+
+	HalfSingle::HalfSingle() : _packedValue(0) {}
+
+	HalfSingle::HalfSingle(double value) : _packedValue(Pack(value)) {}
+
+	u16 HalfSingle::PackedValue() const {
+		return _packedValue;
+	}
+
+	double HalfSingle::ToDouble() const {
+		return Unpack(_packedValue);
+	}
+
+	u16 HalfSingle::Pack(double value) {
+		const u64 bits = std::bit_cast<u64>(value);
+		const u32 sign = static_cast<u32>(bits >> 48) & 0x8000;
+		const i32 exponent = static_cast<i32>((bits >> 52) & 0x7ff);
+		u64 mantissa = bits & 0xfffffffffffffull;
+
+		// Infinity stays infinity, NaN stays a quiet NaN.
+		if (exponent == 0x7ff)
+			return static_cast<u16>(sign | 0x7c00 | (mantissa != 0 ? 0x200 : 0));
+
+		const i32 halfExponent = exponent - 1023 + 15;
+
+		if (halfExponent >= 31)
+			return static_cast<u16>(sign | 0x7c00);
+
+		// Below half the smallest subnormal, rounds to zero.
+		if (halfExponent < -10)
+			return static_cast<u16>(sign);
+
+		i32 shift = 42;
+		u32 half = static_cast<u32>(halfExponent) << 10;
+
+		if (halfExponent <= 0) {
+			// Subnormal: the implicit leading bit becomes explicit and the exponent field is 0.
+			mantissa |= 1ull << 52;
+			shift = 43 - halfExponent;
+			half = 0;
+		}
+
+		half |= static_cast<u32>(mantissa >> shift);
+		const u64 remainder = mantissa & ((1ull << shift) - 1);
+		const u64 halfway = 1ull << (shift - 1);
+
+		// Round to nearest even. A carry out of the mantissa correctly bumps the exponent, up to infinity.
+		if (remainder > halfway || (remainder == halfway && (half & 1) != 0))
+			++half;
+
+		return static_cast<u16>(sign | half);
+	}
+
+	double HalfSingle::Unpack(u16 packedValue) {
+		const double sign = (packedValue & 0x8000) != 0 ? -1.0 : 1.0;
+		const i32 exponent = (packedValue >> 10) & 0x1f;
+		const i32 mantissa = packedValue & 0x3ff;
+
+		if (exponent == 0)
+			return sign * std::ldexp(mantissa, -24);
+
+		if (exponent == 31)
+			return mantissa != 0 ? std::numeric_limits<double>::quiet_NaN() : sign * std::numeric_limits<double>::infinity();
+
+		return sign * std::ldexp(mantissa | 0x400, exponent - 25);
+	}
+
+	//----- HalfVector2
+
+	HalfVector2::HalfVector2() : _packedValue(0) {}
+
+	HalfVector2::HalfVector2(Vector2 const& value) :
+		_packedValue(HalfSingle::Pack(value.X) | (static_cast<u32>(HalfSingle::Pack(value.Y)) << 16)) {}
+
+	u32 HalfVector2::PackedValue() const {
+		return _packedValue;
+	}
+
+	Vector2 HalfVector2::ToVector2() const {
+		return Vector2(
+			HalfSingle::Unpack(static_cast<u16>(_packedValue)),
+			HalfSingle::Unpack(static_cast<u16>(_packedValue >> 16)));
+	}
+
+	void HalfVector2::Pack(std::vector<Vector2> const& values, std::vector<HalfVector2>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = HalfVector2(values[i]);
+	}
+
+	void HalfVector2::Unpack(std::vector<HalfVector2> const& values, std::vector<Vector2>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = values[i].ToVector2();
+	}
+
+	//----- HalfVector3
+
+	HalfVector3::HalfVector3() : _packedValue(0) {}
+
+	HalfVector3::HalfVector3(Vector3 const& value) :
+		_packedValue(HalfSingle::Pack(value.X)
+			| (static_cast<u64>(HalfSingle::Pack(value.Y)) << 16)
+			| (static_cast<u64>(HalfSingle::Pack(value.Z)) << 32)) {}
+
+	u64 HalfVector3::PackedValue() const {
+		return _packedValue;
+	}
+
+	Vector3 HalfVector3::ToVector3() const {
+		return Vector3(
+			HalfSingle::Unpack(static_cast<u16>(_packedValue)),
+			HalfSingle::Unpack(static_cast<u16>(_packedValue >> 16)),
+			HalfSingle::Unpack(static_cast<u16>(_packedValue >> 32)));
+	}
+
+	void HalfVector3::Pack(std::vector<Vector3> const& values, std::vector<HalfVector3>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = HalfVector3(values[i]);
+	}
+
+	void HalfVector3::Unpack(std::vector<HalfVector3> const& values, std::vector<Vector3>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = values[i].ToVector3();
+	}
+
+	//----- HalfVector4
+
+	HalfVector4::HalfVector4() : _packedValue(0) {}
+
+	HalfVector4::HalfVector4(Vector4 const& value) :
+		_packedValue(HalfSingle::Pack(value.X)
+			| (static_cast<u64>(HalfSingle::Pack(value.Y)) << 16)
+			| (static_cast<u64>(HalfSingle::Pack(value.Z)) << 32)
+			| (static_cast<u64>(HalfSingle::Pack(value.W)) << 48)) {}
+
+	u64 HalfVector4::PackedValue() const {
+		return _packedValue;
+	}
+
+	Vector4 HalfVector4::ToVector4() const {
+		return Vector4(
+			HalfSingle::Unpack(static_cast<u16>(_packedValue)),
+			HalfSingle::Unpack(static_cast<u16>(_packedValue >> 16)),
+			HalfSingle::Unpack(static_cast<u16>(_packedValue >> 32)),
+			HalfSingle::Unpack(static_cast<u16>(_packedValue >> 48)));
+	}
+
+	void HalfVector4::Pack(std::vector<Vector4> const& values, std::vector<HalfVector4>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = HalfVector4(values[i]);
+	}
+
+	void HalfVector4::Unpack(std::vector<HalfVector4> const& values, std::vector<Vector4>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = values[i].ToVector4();
+	}
+
+	//----- PackedQuaternion
+
+	PackedQuaternion::PackedQuaternion() : _packedValue(0) {}
+
+	PackedQuaternion::PackedQuaternion(Quaternion const& value) {
+		const double q[4] = { value.X, value.Y, value.Z, value.W };
+		u32 largest = 0;
+
+		for (u32 i = 1; i < 4; ++i) {
+			if (std::abs(q[i]) > std::abs(q[largest]))
+				largest = i;
+		}
+
+		// q and -q are the same rotation, so the largest component can be kept positive.
+		const double sign = q[largest] < 0 ? -1.0 : 1.0;
+		u32 packed = largest << 30;
+		i32 shift = 20;
+
+		for (u32 i = 0; i < 4; ++i) {
+			if (i == largest)
+				continue;
+
+			const double unit = (clamp(sign * q[i], -QuaternionRange, QuaternionRange) / QuaternionRange + 1.0) * 0.5;
+			packed |= static_cast<u32>(std::round(unit * QuaternionSteps)) << shift;
+			shift -= 10;
+		}
+
+		_packedValue = packed;
+	}
+
+	u32 PackedQuaternion::PackedValue() const {
+		return _packedValue;
+	}
+
+	Quaternion PackedQuaternion::ToQuaternion() const {
+		const u32 largest = _packedValue >> 30;
+		double q[4];
+		double sum = 0;
+		i32 shift = 20;
+
+		for (u32 i = 0; i < 4; ++i) {
+			if (i == largest)
+				continue;
+
+			const double unit = ((_packedValue >> shift) & 0x3ff) / QuaternionSteps;
+			q[i] = (unit * 2.0 - 1.0) * QuaternionRange;
+			sum += q[i] * q[i];
+			shift -= 10;
+		}
+
+		q[largest] = std::sqrt(sum < 1.0 ? 1.0 - sum : 0.0);
+
+		return Quaternion::Normalize(Quaternion(q[0], q[1], q[2], q[3]));
+	}
+
+	void PackedQuaternion::Pack(std::vector<Quaternion> const& values, std::vector<PackedQuaternion>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = PackedQuaternion(values[i]);
+	}
+
+	void PackedQuaternion::Unpack(std::vector<PackedQuaternion> const& values, std::vector<Quaternion>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = values[i].ToQuaternion();
+	}
+
+	//----- PackedNormal
+
+	PackedNormal::PackedNormal() : _packedValue(0) {}
+
+	PackedNormal::PackedNormal(Vector3 const& value) {
+		const double l1 = std::abs(value.X) + std::abs(value.Y) + std::abs(value.Z);
+		double x = l1 > 0 ? value.X / l1 : 0.0;
+		double y = l1 > 0 ? value.Y / l1 : 0.0;
+
+		if (value.Z < 0) {
+			const double fx = (1.0 - std::abs(y)) * signNotZero(x);
+			const double fy = (1.0 - std::abs(x)) * signNotZero(y);
+			x = fx;
+			y = fy;
+		}
+
+		const i16 px = static_cast<i16>(std::round(clamp(x, -1.0, 1.0) * NormalSteps));
+		const i16 py = static_cast<i16>(std::round(clamp(y, -1.0, 1.0) * NormalSteps));
+
+		_packedValue = static_cast<u16>(px) | (static_cast<u32>(static_cast<u16>(py)) << 16);
+	}
+
+	u32 PackedNormal::PackedValue() const {
+		return _packedValue;
+	}
+
+	Vector3 PackedNormal::ToVector3() const {
+		double x = static_cast<i16>(static_cast<u16>(_packedValue)) / NormalSteps;
+		double y = static_cast<i16>(static_cast<u16>(_packedValue >> 16)) / NormalSteps;
+		const double z = 1.0 - std::abs(x) - std::abs(y);
+
+		if (z < 0) {
+			const double fx = (1.0 - std::abs(y)) * signNotZero(x);
+			const double fy = (1.0 - std::abs(x)) * signNotZero(y);
+			x = fx;
+			y = fy;
+		}
+
+		return Vector3::Normalize(Vector3(x, y, z));
+	}
+
+	void PackedNormal::Pack(std::vector<Vector3> const& values, std::vector<PackedNormal>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = PackedNormal(values[i]);
+	}
+
+	void PackedNormal::Unpack(std::vector<PackedNormal> const& values, std::vector<Vector3>& result) {
+		result.resize(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			result[i] = values[i].ToVector3();
+	}
+
+	//----- PositionQuantizer
+
+	PositionQuantizer::PositionQuantizer(BoundingBox const& bounds, i32 bitsPerAxis) :
+		_bounds(bounds), _bits(bitsPerAxis < 1 ? 1 : (bitsPerAxis > MaxBitsPerAxis ? MaxBitsPerAxis : bitsPerAxis)) {
+
+		const double steps = static_cast<double>((1u << _bits) - 1);
+		_step = (bounds.Max - bounds.Min) / steps;
+	}
+
+	BoundingBox PositionQuantizer::Bounds() const {
+		return _bounds;
+	}
+
+	i32 PositionQuantizer::BitsPerAxis() const {
+		return _bits;
+	}
+
+	Vector3 PositionQuantizer::MaxError() const {
+		return _step * 0.5;
+	}
+
+	u64 PositionQuantizer::Pack(Vector3 const& position) const {
+		const double steps = static_cast<double>((1u << _bits) - 1);
+		const double x = _step.X > 0 ? std::round(clamp((position.X - _bounds.Min.X) / _step.X, 0.0, steps)) : 0.0;
+		const double y = _step.Y > 0 ? std::round(clamp((position.Y - _bounds.Min.Y) / _step.Y, 0.0, steps)) : 0.0;
+		const double z = _step.Z > 0 ? std::round(clamp((position.Z - _bounds.Min.Z) / _step.Z, 0.0, steps)) : 0.0;
+
+		return static_cast<u64>(x)
+			| (static_cast<u64>(y) << _bits)
+			| (static_cast<u64>(z) << (2 * _bits));
+	}
+
+	Vector3 PositionQuantizer::Unpack(u64 packedValue) const {
+		const u64 mask = (1ull << _bits) - 1;
+
+		return Vector3(
+			_bounds.Min.X + static_cast<double>(packedValue & mask) * _step.X,
+			_bounds.Min.Y + static_cast<double>((packedValue >> _bits) & mask) * _step.Y,
+			_bounds.Min.Z + static_cast<double>((packedValue >> (2 * _bits)) & mask) * _step.Z);
+	}
+
+	void PositionQuantizer::Pack(std::vector<Vector3> const& positions, std::vector<u64>& result) const {
+		result.resize(positions.size());
+
+		for (size_t i = 0; i < positions.size(); ++i)
+			result[i] = Pack(positions[i]);
+	}
+
+	void PositionQuantizer::Unpack(std::vector<u64> const& packedValues, std::vector<Vector3>& result) const {
+		result.resize(packedValues.size());
+
+		for (size_t i = 0; i < packedValues.size(); ++i)
+			result[i] = Unpack(packedValues[i]);
+	}
+}
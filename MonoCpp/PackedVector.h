@@ -0,0 +1,161 @@
+#ifndef PACKEDVECTOR_H
+#define PACKEDVECTOR_H
+
+#include <vector>
+#include "CSharp.h"
+#include "Structs.h"
+#include "Space3d.h"
+
+namespace Xna {
+
+	// Compact encodings of the math types for storage and network snapshots.
+	// Each type documents the largest error a value picks up in a pack/unpack round trip.
+	// The bulk Pack and Unpack functions resize the result array to the source.
+
+	//-----------------------------------//
+	//-----		$ HALFSINGLE		-----//
+	//-----------------------------------//
+
+	// An IEEE 754 half-precision (binary16) number, rounded to nearest even.
+	// The relative error is at most 2^-11 for magnitudes in [6.1e-5, 65504]. Smaller magnitudes
+	// are subnormal with an absolute error up to 2^-25, larger ones become infinity.
+	struct HalfSingle {
+		HalfSingle();
+		HalfSingle(double value);
+
+		u16 PackedValue() const;
+		double ToDouble() const;
+
+		static u16 Pack(double value);
+		static double Unpack(u16 packedValue);
+
+	private:
+		u16 _packedValue;
+	};
+
+	//-----------------------------------//
+	//-----		$ HALFVECTOR		-----//
+	//-----------------------------------//
+
+	// Two half-precision components in 32 bits, X in the low bits. Errors as HalfSingle.
+	struct HalfVector2 {
+		HalfVector2();
+		HalfVector2(Vector2 const& value);
+
+		u32 PackedValue() const;
+		Vector2 ToVector2() const;
+
+		static void Pack(std::vector<Vector2> const& values, std::vector<HalfVector2>& result);
+		static void Unpack(std::vector<HalfVector2> const& values, std::vector<Vector2>& result);
+
+	private:
+		u32 _packedValue;
+	};
+
+	// Three half-precision components in the low 48 bits, X in the low bits. Errors as HalfSingle.
+	struct HalfVector3 {
+		HalfVector3();
+		HalfVector3(Vector3 const& value);
+
+		u64 PackedValue() const;
+		Vector3 ToVector3() const;
+
+		static void Pack(std::vector<Vector3> const& values, std::vector<HalfVector3>& result);
+		static void Unpack(std::vector<HalfVector3> const& values, std::vector<Vector3>& result);
+
+	private:
+		u64 _packedValue;
+	};
+
+	// Four half-precision components in 64 bits, X in the low bits. Errors as HalfSingle.
+	struct HalfVector4 {
+		HalfVector4();
+		HalfVector4(Vector4 const& value);
+
+		u64 PackedValue() const;
+		Vector4 ToVector4() const;
+
+		static void Pack(std::vector<Vector4> const& values, std::vector<HalfVector4>& result);
+		static void Unpack(std::vector<HalfVector4> const& values, std::vector<Vector4>& result);
+
+	private:
+		u64 _packedValue;
+	};
+
+	//-----------------------------------//
+	//-----		$ PACKEDQUATERNION	-----//
+	//-----------------------------------//
+
+	// A unit quaternion in 32 bits with the smallest-three encoding: the index of the largest
+	// component in the top 2 bits and the other three in 10 bits each. The largest component is
+	// made positive and rebuilt from the others, which lie in [-1/sqrt(2), 1/sqrt(2)].
+	// The three stored components are off by at most 0.0007 after decoding, and the rebuilt one by at most 0.0021.
+	// The rotation is off by at most 0.28 degrees. The worst case is four components near 0.5.
+	struct PackedQuaternion {
+		PackedQuaternion();
+		PackedQuaternion(Quaternion const& value);
+
+		u32 PackedValue() const;
+		Quaternion ToQuaternion() const;
+
+		static void Pack(std::vector<Quaternion> const& values, std::vector<PackedQuaternion>& result);
+		static void Unpack(std::vector<PackedQuaternion> const& values, std::vector<Quaternion>& result);
+
+	private:
+		u32 _packedValue;
+	};
+
+	//-----------------------------------//
+	//-----		$ PACKEDNORMAL		-----//
+	//-----------------------------------//
+
+	// A unit vector in 32 bits with the octahedral encoding: the vector is projected on the
+	// octahedron |x| + |y| + |z| = 1, whose lower half is folded over the upper half, and the
+	// two remaining coordinates are stored as 16-bit signed normalized values, X in the low bits.
+	// The decoded direction is off by at most 0.004 degrees.
+	struct PackedNormal {
+		PackedNormal();
+		PackedNormal(Vector3 const& value);
+
+		u32 PackedValue() const;
+		Vector3 ToVector3() const;
+
+		static void Pack(std::vector<Vector3> const& values, std::vector<PackedNormal>& result);
+		static void Unpack(std::vector<PackedNormal> const& values, std::vector<Vector3>& result);
+
+	private:
+		u32 _packedValue;
+	};
+
+	//-----------------------------------//
+	//-----		$ POSITIONQUANTIZER	-----//
+	//-----------------------------------//
+
+	// Packs positions inside a BoundingBox as fixed-point values, bitsPerAxis bits per axis in a u64,
+	// X in the low bits. Positions outside the box are clamped to it.
+	// Each axis is off by at most half a step, see MaxError.
+	struct PositionQuantizer {
+		// The largest number of bits per axis that fits in a u64.
+		static constexpr i32 MaxBitsPerAxis = 21;
+
+		PositionQuantizer(BoundingBox const& bounds, i32 bitsPerAxis = MaxBitsPerAxis);
+
+		BoundingBox Bounds() const;
+		i32 BitsPerAxis() const;
+		// The largest error on each axis of a position inside the box.
+		Vector3 MaxError() const;
+
+		u64 Pack(Vector3 const& position) const;
+		Vector3 Unpack(u64 packedValue) const;
+
+		void Pack(std::vector<Vector3> const& positions, std::vector<u64>& result) const;
+		void Unpack(std::vector<u64> const& packedValues, std::vector<Vector3>& result) const;
+
+	private:
+		BoundingBox _bounds;
+		i32 _bits;
+		Vector3 _step;
+	};
+}
+
+#endif
@@ -0,0 +1,13 @@
+#include "JobSystem.h"
+#include "Parallel.h"
+
+namespace Xna {
+
+	size_t Parallel::ChunkCount(size_t count, size_t minChunkSize) {
+		return JobSystem::Shared().ChunkCount(count, minChunkSize);
+	}
+
+	void Parallel::For(size_t count, size_t minChunkSize, std::function<void(size_t, size_t, size_t)> const& body) {
+		JobSystem::Shared().For(count, minChunkSize, body);
+	}
+}
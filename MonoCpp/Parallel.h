@@ -0,0 +1,26 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <functional>
+#include "CSharp.h"
+
+namespace Xna {
+
+	// Splits batch work over [0, count) into contiguous chunks that run on the workers of JobSystem::Shared().
+	// Calls may be nested: a chunk waiting for its own chunks runs pending jobs meanwhile.
+	struct Parallel {
+		// The minChunkSize used by the batch kernels, which do tens to hundreds of operations per item.
+		static constexpr size_t DefaultChunkSize = 1 << 12;
+
+		// Returns the number of chunks For uses for count items, so callers can size
+		// their per-chunk results. Every chunk has at least minChunkSize items and
+		// there are a few chunks per hardware thread at most.
+		static size_t ChunkCount(size_t count, size_t minChunkSize);
+
+		// Calls body(chunk, begin, end) once per chunk and returns when all chunks are done.
+		// The first chunk runs on the calling thread.
+		static void For(size_t count, size_t minChunkSize, std::function<void(size_t, size_t, size_t)> const& body);
+	};
+}
+
+#endif
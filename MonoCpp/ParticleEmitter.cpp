@@ -0,0 +1,184 @@
+#include "ParticleEmitter.h"
+#include "Parallel.h"
+
+namespace Xna {
+
+	static void reserve(Vector3Stream& stream, size_t count) {
+		stream.X.reserve(count);
+		stream.Y.reserve(count);
+		stream.Z.reserve(count);
+	}
+
+	// Linearly interpolates a table baked over [0, 1] at amount.
+	static double sample(std::vector<double> const& table, double amount) {
+		const size_t last = table.size() - 1;
+		const double position = (amount < 0 ? 0 : (amount > 1 ? 1 : amount)) * last;
+		size_t index = static_cast<size_t>(position);
+
+		if (index >= last)
+			index = last - 1;
+
+		return table[index] + (table[index + 1] - table[index]) * (position - index);
+	}
+
+	static Color withAlpha(Color const& color, double alpha) {
+		const double a = color.A() * (alpha < 0 ? 0 : (alpha > 1 ? 1 : alpha));
+		return Color((static_cast<u32>(color.PackedValue()) & 0x00FFFFFFu) | (static_cast<u32>(a + 0.5) << 24));
+	}
+
+	// ParticleStream
+
+	ParticleStream::ParticleStream() {}
+
+	size_t ParticleStream::Count() const {
+		return Age.size();
+	}
+
+	void ParticleStream::Resize(size_t count) {
+		Position.Resize(count);
+		Velocity.Resize(count);
+		Age.resize(count);
+		Life.resize(count);
+		Size.resize(count);
+		Color.resize(count, Xna::Color(0u));
+	}
+
+	void ParticleStream::Reserve(size_t count) {
+		reserve(Position, count);
+		reserve(Velocity, count);
+		Age.reserve(count);
+		Life.reserve(count);
+		Size.reserve(count);
+		Color.reserve(count);
+	}
+
+	// ParticleEmitter
+
+	ParticleEmitter::ParticleEmitter(Curve const& size, Curve const& alpha, Curve const& speed, size_t capacity, size_t lutSize, u32 seed) :
+		Position(0), Velocity(0), Spread(0), Acceleration(0), MinLife(1), MaxLife(1), Tint(0xFFFFFFFFu),
+		_capacity(capacity), _random(seed) {
+
+		bake(size, lutSize, _sizeTable);
+		bake(alpha, lutSize, _alphaTable);
+		bake(speed, lutSize, _speedTable);
+
+		// Both buffers are sized up front so emitting and updating never allocate.
+		_particles.Reserve(capacity);
+		_back.Reserve(capacity);
+	}
+
+	size_t ParticleEmitter::Emit(size_t count) {
+		const size_t first = _particles.Count();
+		const size_t room = _capacity - first;
+
+		if (count > room)
+			count = room;
+
+		_particles.Resize(first + count);
+
+		std::uniform_real_distribution<double> unit(0.0, 1.0);
+		const double size = _sizeTable[0];
+		const Color color = withAlpha(Tint, _alphaTable[0]);
+
+		for (size_t i = first; i < first + count; ++i) {
+			_particles.Position.Set(i, Position);
+			_particles.Velocity.Set(i, Vector3(
+				Velocity.X + Spread * (unit(_random) * 2 - 1),
+				Velocity.Y + Spread * (unit(_random) * 2 - 1),
+				Velocity.Z + Spread * (unit(_random) * 2 - 1)));
+			_particles.Age[i] = 0;
+			_particles.Life[i] = MinLife + (MaxLife - MinLife) * unit(_random);
+			_particles.Size[i] = size;
+			_particles.Color[i] = color;
+		}
+
+		return count;
+	}
+
+	void ParticleEmitter::Update(double elapsedSeconds) {
+		const size_t count = _particles.Count();
+		const size_t chunks = Parallel::ChunkCount(count, UpdateChunkSize);
+
+		// First count the survivors of each chunk, so each chunk knows where to write them.
+		_offsets.assign(chunks + 1, 0);
+
+		Parallel::For(count, UpdateChunkSize, [this, elapsedSeconds](size_t chunk, size_t begin, size_t end) {
+			const double* age = _particles.Age.data();
+			const double* life = _particles.Life.data();
+			size_t alive = 0;
+
+			for (size_t i = begin; i < end; ++i)
+				alive += age[i] + elapsedSeconds < life[i] ? 1 : 0;
+
+			_offsets[chunk + 1] = alive;
+		});
+
+		for (size_t i = 1; i <= chunks; ++i)
+			_offsets[i] += _offsets[i - 1];
+
+		_back.Resize(_offsets[chunks]);
+
+		// Then move the survivors and write them packed into the back buffer.
+		Parallel::For(count, UpdateChunkSize, [this, elapsedSeconds](size_t chunk, size_t begin, size_t end) {
+			ParticleStream const& from = _particles;
+			ParticleStream& to = _back;
+			size_t j = _offsets[chunk];
+
+			for (size_t i = begin; i < end; ++i) {
+				const double age = from.Age[i] + elapsedSeconds;
+
+				if (!(age < from.Life[i]))
+					continue;
+
+				const double amount = age / from.Life[i];
+				const double speed = sample(_speedTable, amount) * elapsedSeconds;
+
+				const double vx = from.Velocity.X[i] + Acceleration.X * elapsedSeconds;
+				const double vy = from.Velocity.Y[i] + Acceleration.Y * elapsedSeconds;
+				const double vz = from.Velocity.Z[i] + Acceleration.Z * elapsedSeconds;
+
+				to.Position.X[j] = from.Position.X[i] + vx * speed;
+				to.Position.Y[j] = from.Position.Y[i] + vy * speed;
+				to.Position.Z[j] = from.Position.Z[i] + vz * speed;
+				to.Velocity.X[j] = vx;
+				to.Velocity.Y[j] = vy;
+				to.Velocity.Z[j] = vz;
+				to.Age[j] = age;
+				to.Life[j] = from.Life[i];
+				to.Size[j] = sample(_sizeTable, amount);
+				to.Color[j] = withAlpha(Tint, sample(_alphaTable, amount));
+				++j;
+			}
+		});
+
+		std::swap(_particles, _back);
+	}
+
+	void ParticleEmitter::Clear() {
+		_particles.Resize(0);
+	}
+
+	size_t ParticleEmitter::Count() const {
+		return _particles.Count();
+	}
+
+	size_t ParticleEmitter::Capacity() const {
+		return _capacity;
+	}
+
+	ParticleStream const& ParticleEmitter::Particles() const {
+		return _particles;
+	}
+
+	// Private
+
+	void ParticleEmitter::bake(Curve const& curve, size_t lutSize, std::vector<double>& table) const {
+		if (lutSize < 2)
+			lutSize = 2;
+
+		table.resize(lutSize);
+
+		for (size_t i = 0; i < lutSize; ++i)
+			table[i] = curve.Evaluate(static_cast<double>(i) / (lutSize - 1));
+	}
+}
@@ -0,0 +1,98 @@
+#ifndef PARTICLEEMITTER_H
+#define PARTICLEEMITTER_H
+
+#include <random>
+#include <vector>
+#include "CSharp.h"
+#include "Color.h"
+#include "Curve.h"
+#include "Structs.h"
+#include "Streams.h"
+
+namespace Xna {
+
+	// The particles of an emitter, one array per attribute.
+	struct ParticleStream {
+		Vector3Stream Position;
+		// The velocity before the speed curve is applied.
+		Vector3Stream Velocity;
+		// Seconds since the particle was emitted.
+		std::vector<double> Age;
+		// Seconds the particle lives.
+		std::vector<double> Life;
+		std::vector<double> Size;
+		std::vector<Xna::Color> Color;
+
+		ParticleStream();
+
+		// Returns the number of particles in the stream.
+		size_t Count() const;
+		// Changes the number of particles in the stream.
+		void Resize(size_t count);
+		// Reserves room for count particles in every array.
+		void Reserve(size_t count);
+	};
+
+	// Emits particles and moves them over their life.
+	// Size, alpha and speed over the life of a particle come from curves evaluated at the
+	// normalized age, from 0 at birth to 1 at death. The curves are baked to lookup tables
+	// when the emitter is created, so later changes to them have no effect.
+	// Update runs in parallel chunks and keeps the live particles packed at the front.
+	struct ParticleEmitter {
+
+		// Where new particles start.
+		Vector3 Position;
+		// The velocity of new particles.
+		Vector3 Velocity;
+		// The largest random offset added to each component of the velocity of new particles.
+		double Spread;
+		// Added to the velocity of every particle each second, such as gravity.
+		Vector3 Acceleration;
+		// The shortest and longest life of new particles, in seconds.
+		double MinLife;
+		double MaxLife;
+		// The color of particles, whose alpha is scaled by the alpha curve.
+		Xna::Color Tint;
+
+		// size: the size over life.
+		// alpha: the alpha over life, from 0 to 1.
+		// speed: the factor applied to the velocity over life.
+		// capacity: the most particles alive at once; emitting beyond it does nothing.
+		// lutSize: the number of samples each curve is baked to.
+		ParticleEmitter(Curve const& size, Curve const& alpha, Curve const& speed, size_t capacity, size_t lutSize = 256, u32 seed = 0);
+
+		// Emits count particles, or as many as fit. Returns how many were emitted.
+		size_t Emit(size_t count);
+		// Ages and moves the particles by elapsedSeconds and removes those past their life.
+		// Survivors keep their relative order.
+		void Update(double elapsedSeconds);
+		// Removes every particle.
+		void Clear();
+
+		// Returns the number of live particles.
+		size_t Count() const;
+		// Returns the most particles alive at once.
+		size_t Capacity() const;
+		// The live particles.
+		ParticleStream const& Particles() const;
+
+	private:
+		// Aging a particle is a handful of operations, so a chunk needs more of them than Parallel::DefaultChunkSize.
+		static constexpr size_t UpdateChunkSize = 1 << 14;
+
+		size_t _capacity;
+		// Updated particles are written to _back, which then becomes _particles.
+		ParticleStream _particles;
+		ParticleStream _back;
+		std::vector<double> _sizeTable;
+		std::vector<double> _alphaTable;
+		std::vector<double> _speedTable;
+		// The number of survivors of each chunk, then where each chunk writes them.
+		std::vector<size_t> _offsets;
+		std::mt19937 _random;
+
+		void bake(Curve const& curve, size_t lutSize, std::vector<double>& table) const;
+	};
+}
+
+#endif
@@ -46,22 +46,39 @@ namespace Xna {
 		return plane1.Equals(plane2);
 	}
 
-	Plane Plane::Transform(Plane plane, Matrix matrix) {
-		Matrix transformedMatrix = Matrix::Invert(matrix);
-		transformedMatrix = Matrix::Transpose(transformedMatrix);
+	// Transforms the planes as Vector4 by the inverse transpose, in a loop the compiler can vectorize.
+	// The source and destination may be the same array.
+	static void transformPlanes(const Plane* source, Plane* destination, size_t length, Matrix const& m) {
+		for (size_t i = 0; i < length; ++i) {
+			const double x = source[i].Normal.X;
+			const double y = source[i].Normal.Y;
+			const double z = source[i].Normal.Z;
+			const double w = source[i].D;
 
-		Vector4 vector = Vector4(plane.Normal, plane.D);
-
-		Vector4 transformedVector = Vector4::Transform(vector, transformedMatrix);
+			destination[i].Normal.X = (x * m.M11) + (y * m.M21) + (z * m.M31) + (w * m.M41);
+			destination[i].Normal.Y = (x * m.M12) + (y * m.M22) + (z * m.M32) + (w * m.M42);
+			destination[i].Normal.Z = (x * m.M13) + (y * m.M23) + (z * m.M33) + (w * m.M43);
+			destination[i].D = (x * m.M14) + (y * m.M24) + (z * m.M34) + (w * m.M44);
+		}
+	}
 
-		return Plane(transformedVector);
+	Plane Plane::Transform(Plane const& plane, Matrix const& matrix) {
+		return PlaneTransform(matrix).Transform(plane);
 	}
 
-	Plane Plane::Transform(Plane plane, Quaternion rotation) {
+	Plane Plane::Transform(Plane const& plane, Quaternion const& rotation) {
 		Vector3 result = Vector3::Transform(plane.Normal, rotation);
 		return Plane(result, plane.D);
 	}
 
+	void Plane::Transform(std::vector<Plane> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Plane>& destinationArray, size_t destinationIndex, size_t length) {
+		PlaneTransform(matrix).Transform(sourceArray, sourceIndex, destinationArray, destinationIndex, length);
+	}
+
+	void Plane::Transform(std::vector<Plane> const& sourceArray, Matrix const& matrix, std::vector<Plane>& destinationArray) {
+		PlaneTransform(matrix).Transform(sourceArray, destinationArray);
+	}
+
 	Plane Plane::Normalize(Plane value) {
 		double length = value.Normal.Length();
 		double factor = 1.0 / length;
@@ -132,4 +149,39 @@ namespace Xna {
 		return std::abs((plane.Normal.X * point.X + plane.Normal.Y * point.Y + plane.Normal.Z * point.Z)
 			/ std::sqrt(plane.Normal.X * plane.Normal.X + plane.Normal.Y * plane.Normal.Y + plane.Normal.Z * plane.Normal.Z));
 	}
+
+	//----- PlaneTransform
+
+	PlaneTransform::PlaneTransform() :
+		_matrix(Matrix::Identity()), _inverseTranspose(Matrix::Identity()) {}
+
+	PlaneTransform::PlaneTransform(Matrix const& matrix) :
+		_matrix(matrix), _inverseTranspose(Matrix::Transpose(Matrix::Invert(matrix))) {}
+
+	Matrix PlaneTransform::Matrix_() const {
+		return _matrix;
+	}
+
+	void PlaneTransform::Matrix_(Matrix const& value) {
+		if (value == _matrix)
+			return;
+
+		_matrix = value;
+		_inverseTranspose = Matrix::Transpose(Matrix::Invert(value));
+	}
+
+	Plane PlaneTransform::Transform(Plane const& plane) const {
+		Plane result;
+		transformPlanes(&plane, &result, 1, _inverseTranspose);
+		return result;
+	}
+
+	void PlaneTransform::Transform(std::vector<Plane> const& sourceArray, size_t sourceIndex, std::vector<Plane>& destinationArray, size_t destinationIndex, size_t length) const {
+		transformPlanes(sourceArray.data() + sourceIndex, destinationArray.data() + destinationIndex, length, _inverseTranspose);
+	}
+
+	void PlaneTransform::Transform(std::vector<Plane> const& sourceArray, std::vector<Plane>& destinationArray) const {
+		destinationArray.resize(sourceArray.size());
+		transformPlanes(sourceArray.data(), destinationArray.data(), sourceArray.size(), _inverseTranspose);
+	}
 }
\ No newline at end of file
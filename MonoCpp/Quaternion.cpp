@@ -2,81 +2,10 @@
 #include "MathHelper.h"
 
 namespace Xna {
-	Quaternion::Quaternion() :
-		X(0), Y(0), Z(0), W(0) {}
-
-	Quaternion::Quaternion(double x, double y, double z, double w) :
-		X(x), Y(y), Z(z), W(w) {}
-
-	Quaternion::Quaternion(Vector3 value, double w) :
-		X(value.X), Y(value.Y), Z(value.Z), W(0) {}
-
-	Quaternion::Quaternion(Vector4 value) :
-		X(value.X), Y(value.Y), Z(value.Z), W(value.W) {}
-
 	Quaternion Quaternion::operator -(Quaternion quaternion) {
 		return Quaternion::Negate(quaternion);
 	}
 
-	Quaternion operator +(Quaternion quaternion1, Quaternion quaternion2) {
-		return Quaternion::Add(quaternion1, quaternion2);
-	}
-
-	Quaternion operator /(Quaternion quaternion1, Quaternion quaternion2) {
-		return Quaternion::Divide(quaternion1, quaternion2);
-	}
-
-	bool operator ==(Quaternion quaternion1, Quaternion quaternion2) {
-		return quaternion1.Equals(quaternion2);
-	}
-
-	bool operator !=(Quaternion quaternion1, Quaternion quaternion2) {
-		return !quaternion1.Equals(quaternion2);
-	}
-
-	Quaternion operator *(Quaternion quaternion1, Quaternion quaternion2) {
-		return Quaternion::Multiply(quaternion1, quaternion2);
-	}
-
-	Quaternion operator -(Quaternion quaternion1, Quaternion quaternion2) {
-		return Quaternion::Subtract(quaternion1, quaternion2);
-	}
-
-	Quaternion Quaternion::Identity() { return Quaternion(0, 0, 0, 1); }
-
-	Quaternion Quaternion::Add(Quaternion const& quaternion1, Quaternion const& quaternion2) {
-		return Quaternion(
-			quaternion1.X + quaternion2.X,
-			quaternion1.Y + quaternion2.Y,
-			quaternion1.Z + quaternion2.Z,
-			quaternion1.W + quaternion2.W);
-	}
-
-	Quaternion Quaternion::Concatenate(Quaternion const& value1, Quaternion const& value2) {
-		Quaternion quaternion;
-
-		double x1 = value1.X;
-		double y1 = value1.Y;
-		double z1 = value1.Z;
-		double w1 = value1.W;
-
-		double x2 = value2.X;
-		double y2 = value2.Y;
-		double z2 = value2.Z;
-		double w2 = value2.W;
-
-		quaternion.X = ((x2 * w1) + (x1 * w2)) + ((y2 * z1) - (z2 * y1));
-		quaternion.Y = ((y2 * w1) + (y1 * w2)) + ((z2 * x1) - (x2 * z1));
-		quaternion.Z = ((z2 * w1) + (z1 * w2)) + ((x2 * y1) - (y2 * x1));
-		quaternion.W = (w2 * w1) - (((x2 * x1) + (y2 * y1)) + (z2 * z1));
-
-		return quaternion;
-	}
-
-	Quaternion Quaternion::Conjugate(Quaternion const& value) {
-		return Quaternion(-value.X, -value.Y, -value.Z, value.W);
-	}
-
 	Quaternion Quaternion::CreateFromAxisAngle(Vector3 const& axis, double angle) {
 		double half = angle * 0.5f;
 		double sin = MathHelper::Sin(half);
@@ -84,6 +13,14 @@ namespace Xna {
 		return Quaternion(axis.X * sin, axis.Y * sin, axis.Z * sin, cos);
 	}
 
+	Quaternion Quaternion::CreateFromAxisAngle(Vector3 const& axis, double angle, MathPrecision precision) {
+		double half = angle * 0.5f;
+		double sin;
+		double cos;
+		MathHelper::SinCos(half, sin, cos, precision);
+		return Quaternion(axis.X * sin, axis.Y * sin, axis.Z * sin, cos);
+	}
+
 	Quaternion Quaternion::CreateFromRotationMatrix(Matrix const& matrix) {
 		Quaternion quaternion;
 		double sqrt;
@@ -155,31 +92,19 @@ namespace Xna {
 			(cosYaw * cosPitch * cosRoll) + (sinYaw * sinPitch * sinRoll));
 	}
 
-	Quaternion Quaternion::Divide(Quaternion const& quaternion1, Quaternion const& quaternion2) {
-		Quaternion quaternion;
-		double x = quaternion1.X;
-		double y = quaternion1.Y;
-		double z = quaternion1.Z;
-		double w = quaternion1.W;
-		double num14 = (((quaternion2.X * quaternion2.X) + (quaternion2.Y * quaternion2.Y)) + (quaternion2.Z * quaternion2.Z)) + (quaternion2.W * quaternion2.W);
-		double num5 = 1.0 / num14;
-		double num4 = -quaternion2.X * num5;
-		double num3 = -quaternion2.Y * num5;
-		double num2 = -quaternion2.Z * num5;
-		double num = quaternion2.W * num5;
-		double num13 = (y * num2) - (z * num3);
-		double num12 = (z * num4) - (x * num2);
-		double num11 = (x * num3) - (y * num4);
-		double num10 = ((x * num4) + (y * num3)) + (z * num2);
-		quaternion.X = ((x * num) + (num4 * w)) + num13;
-		quaternion.Y = ((y * num) + (num3 * w)) + num12;
-		quaternion.Z = ((z * num) + (num2 * w)) + num11;
-		quaternion.W = (w * num) - num10;
-		return quaternion;
-	}
+	Quaternion Quaternion::CreateFromYawPitchRoll(double yaw, double pitch, double roll, MathPrecision precision) {
+		double sinRoll, cosRoll;
+		double sinPitch, cosPitch;
+		double sinYaw, cosYaw;
+
+		MathHelper::SinCos(roll * 0.5f, sinRoll, cosRoll, precision);
+		MathHelper::SinCos(pitch * 0.5f, sinPitch, cosPitch, precision);
+		MathHelper::SinCos(yaw * 0.5f, sinYaw, cosYaw, precision);
 
-	double Quaternion::Dot(Quaternion const& quaternion1, Quaternion const& quaternion2) {
-		return ((((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W));
+		return Quaternion((cosYaw * sinPitch * cosRoll) + (sinYaw * cosPitch * sinRoll),
+			(sinYaw * cosPitch * cosRoll) - (cosYaw * sinPitch * sinRoll),
+			(cosYaw * cosPitch * sinRoll) - (sinYaw * sinPitch * cosRoll),
+			(cosYaw * cosPitch * cosRoll) + (sinYaw * sinPitch * sinRoll));
 	}
 
 	Quaternion Quaternion::Inverse(Quaternion const& quaternion) {
@@ -252,49 +177,6 @@ namespace Xna {
 		return quaternion;
 	}
 
-	Quaternion Quaternion::Subtract(Quaternion const& quaternion1, Quaternion const& quaternion2) {
-		Quaternion quaternion;
-		quaternion.X = quaternion1.X - quaternion2.X;
-		quaternion.Y = quaternion1.Y - quaternion2.Y;
-		quaternion.Z = quaternion1.Z - quaternion2.Z;
-		quaternion.W = quaternion1.W - quaternion2.W;
-		return quaternion;
-	}
-
-	Quaternion Quaternion::Multiply(Quaternion const& quaternion1, Quaternion const& quaternion2) {
-		Quaternion quaternion;
-		double x = quaternion1.X;
-		double y = quaternion1.Y;
-		double z = quaternion1.Z;
-		double w = quaternion1.W;
-		double num4 = quaternion2.X;
-		double num3 = quaternion2.Y;
-		double num2 = quaternion2.Z;
-		double num = quaternion2.W;
-		double num12 = (y * num2) - (z * num3);
-		double num11 = (z * num4) - (x * num2);
-		double num10 = (x * num3) - (y * num4);
-		double num9 = ((x * num4) + (y * num3)) + (z * num2);
-		quaternion.X = ((x * num) + (num4 * w)) + num12;
-		quaternion.Y = ((y * num) + (num3 * w)) + num11;
-		quaternion.Z = ((z * num) + (num2 * w)) + num10;
-		quaternion.W = (w * num) - num9;
-		return quaternion;
-	}
-
-	Quaternion Quaternion::Multiply(Quaternion const& quaternion1, double scaleFactor) {
-		Quaternion quaternion;
-		quaternion.X = quaternion1.X * scaleFactor;
-		quaternion.Y = quaternion1.Y * scaleFactor;
-		quaternion.Z = quaternion1.Z * scaleFactor;
-		quaternion.W = quaternion1.W * scaleFactor;
-		return quaternion;
-	}
-
-	Quaternion Quaternion::Negate(Quaternion const& quaternion) {
-		return Quaternion(-quaternion.X, -quaternion.Y, -quaternion.Z, -quaternion.W);
-	}
-
 	Quaternion Quaternion::Normalize(Quaternion const& quaternion) {
 		Quaternion result;
 		double num = 1.0 / MathHelper::Sqrt((quaternion.X * quaternion.X) + (quaternion.Y * quaternion.Y) + (quaternion.Z * quaternion.Z) + (quaternion.W * quaternion.W));
@@ -305,20 +187,21 @@ namespace Xna {
 		return result;
 	}
 
-	void Quaternion::Conjugate() {
-		Quaternion value = Quaternion::Conjugate(*this);
-		X = value.X;
-		Y = value.Y;
-		Z = value.Z;
-		W = value.W;
-	}
+	Quaternion Quaternion::Normalize(Quaternion const& quaternion, MathPrecision precision) {
+		if (precision != MathPrecision::Fast)
+			return Normalize(quaternion);
 
-	double Quaternion::Length() const {
-		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
+		Quaternion result;
+		double num = MathHelper::FastRsqrt((quaternion.X * quaternion.X) + (quaternion.Y * quaternion.Y) + (quaternion.Z * quaternion.Z) + (quaternion.W * quaternion.W));
+		result.X = quaternion.X * num;
+		result.Y = quaternion.Y * num;
+		result.Z = quaternion.Z * num;
+		result.W = quaternion.W * num;
+		return result;
 	}
 
-	double Quaternion::LengthSquared() const {
-		return (X * X) + (Y * Y) + (Z * Z) + (W * W);
+	double Quaternion::Length(MathPrecision precision) const {
+		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W), precision);
 	}
 
 	void Quaternion::Normalize() {
@@ -333,11 +216,4 @@ namespace Xna {
 		return Vector4(X, Y, Z, W);
 	}
 
-	bool Quaternion::Equals(Quaternion const& other) const {
-		return 
-			X == other.X &&
-			Y == other.Y &&
-			Z == other.Z &&
-			W == other.W;
-	}
 }
\ No newline at end of file
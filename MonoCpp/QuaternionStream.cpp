@@ -0,0 +1,312 @@
+#include <cmath>
+#include "Streams.h"
+
+namespace Xna {
+
+	// The amount array is read with a stride of 0 for a single shared amount or 1 for one amount per pair.
+	static void lerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, const double* t, size_t stride, size_t count, QuaternionStream& result) {
+		result.Resize(count);
+
+		const double* x1 = quaternion1.X.data();
+		const double* y1 = quaternion1.Y.data();
+		const double* z1 = quaternion1.Z.data();
+		const double* w1 = quaternion1.W.data();
+		const double* x2 = quaternion2.X.data();
+		const double* y2 = quaternion2.Y.data();
+		const double* z2 = quaternion2.Z.data();
+		const double* w2 = quaternion2.W.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+		double* rw = result.W.data();
+
+		for (size_t i = 0; i < count; ++i) {
+			const double dot = (x1[i] * x2[i]) + (y1[i] * y2[i]) + (z1[i] * z2[i]) + (w1[i] * w2[i]);
+			// Blend towards the closest of q2 and -q2 without branching.
+			const double amount = t[i * stride];
+			const double num = dot >= 0.0 ? amount : -amount;
+			const double num2 = 1.0 - amount;
+
+			const double x = (num2 * x1[i]) + (num * x2[i]);
+			const double y = (num2 * y1[i]) + (num * y2[i]);
+			const double z = (num2 * z1[i]) + (num * z2[i]);
+			const double w = (num2 * w1[i]) + (num * w2[i]);
+			const double num3 = 1.0 / std::sqrt((x * x) + (y * y) + (z * z) + (w * w));
+
+			rx[i] = x * num3;
+			ry[i] = y * num3;
+			rz[i] = z * num3;
+			rw[i] = w * num3;
+		}
+	}
+
+	static void slerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, const double* t, size_t stride, size_t count, QuaternionStream& result) {
+		result.Resize(count);
+
+		const double* x1 = quaternion1.X.data();
+		const double* y1 = quaternion1.Y.data();
+		const double* z1 = quaternion1.Z.data();
+		const double* w1 = quaternion1.W.data();
+		const double* x2 = quaternion2.X.data();
+		const double* y2 = quaternion2.Y.data();
+		const double* z2 = quaternion2.Z.data();
+		const double* w2 = quaternion2.W.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+		double* rw = result.W.data();
+
+		for (size_t i = 0; i < count; ++i) {
+			double dot = (x1[i] * x2[i]) + (y1[i] * y2[i]) + (z1[i] * z2[i]) + (w1[i] * w2[i]);
+			const double sign = dot < 0.0 ? -1.0 : 1.0;
+			dot *= sign;
+
+			double num2 = t[i * stride];
+			double num3 = 1.0 - num2;
+
+			// Same threshold as Quaternion::Slerp: nearly parallel pairs fall back to a linear blend.
+			if (dot <= 0.999999f) {
+				const double num5 = std::acos(dot);
+				const double num6 = 1.0 / std::sin(num5);
+				num3 = std::sin(num3 * num5) * num6;
+				num2 = std::sin(num2 * num5) * num6;
+			}
+
+			num2 *= sign;
+
+			const double x = (num3 * x1[i]) + (num2 * x2[i]);
+			const double y = (num3 * y1[i]) + (num2 * y2[i]);
+			const double z = (num3 * z1[i]) + (num2 * z2[i]);
+			const double w = (num3 * w1[i]) + (num2 * w2[i]);
+
+			rx[i] = x;
+			ry[i] = y;
+			rz[i] = z;
+			rw[i] = w;
+		}
+	}
+
+	QuaternionStream::QuaternionStream() {}
+
+	QuaternionStream::QuaternionStream(size_t count) :
+		X(count), Y(count), Z(count), W(count) {}
+
+	QuaternionStream::QuaternionStream(std::vector<Quaternion> const& values) :
+		X(values.size()), Y(values.size()), Z(values.size()), W(values.size()) {
+
+		for (size_t i = 0; i < values.size(); ++i) {
+			X[i] = values[i].X;
+			Y[i] = values[i].Y;
+			Z[i] = values[i].Z;
+			W[i] = values[i].W;
+		}
+	}
+
+	//----- Static
+
+	void QuaternionStream::Multiply(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, QuaternionStream& result) {
+		const size_t count = minCount(quaternion1.Count(), quaternion2.Count());
+		result.Resize(count);
+
+		const double* x1 = quaternion1.X.data();
+		const double* y1 = quaternion1.Y.data();
+		const double* z1 = quaternion1.Z.data();
+		const double* w1 = quaternion1.W.data();
+		const double* x2 = quaternion2.X.data();
+		const double* y2 = quaternion2.Y.data();
+		const double* z2 = quaternion2.Z.data();
+		const double* w2 = quaternion2.W.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+		double* rw = result.W.data();
+
+		for (size_t i = 0; i < count; ++i) {
+			const double x = x1[i];
+			const double y = y1[i];
+			const double z = z1[i];
+			const double w = w1[i];
+			const double num4 = x2[i];
+			const double num3 = y2[i];
+			const double num2 = z2[i];
+			const double num = w2[i];
+			const double num12 = (y * num2) - (z * num3);
+			const double num11 = (z * num4) - (x * num2);
+			const double num10 = (x * num3) - (y * num4);
+			const double num9 = ((x * num4) + (y * num3)) + (z * num2);
+			rx[i] = ((x * num) + (num4 * w)) + num12;
+			ry[i] = ((y * num) + (num3 * w)) + num11;
+			rz[i] = ((z * num) + (num2 * w)) + num10;
+			rw[i] = (w * num) - num9;
+		}
+	}
+
+	void QuaternionStream::Multiply(QuaternionStream const& quaternion1, Quaternion const& quaternion2, QuaternionStream& result) {
+		const size_t count = quaternion1.Count();
+		result.Resize(count);
+
+		const double* x1 = quaternion1.X.data();
+		const double* y1 = quaternion1.Y.data();
+		const double* z1 = quaternion1.Z.data();
+		const double* w1 = quaternion1.W.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+		double* rw = result.W.data();
+
+		const double num4 = quaternion2.X;
+		const double num3 = quaternion2.Y;
+		const double num2 = quaternion2.Z;
+		const double num = quaternion2.W;
+
+		for (size_t i = 0; i < count; ++i) {
+			const double x = x1[i];
+			const double y = y1[i];
+			const double z = z1[i];
+			const double w = w1[i];
+			const double num12 = (y * num2) - (z * num3);
+			const double num11 = (z * num4) - (x * num2);
+			const double num10 = (x * num3) - (y * num4);
+			const double num9 = ((x * num4) + (y * num3)) + (z * num2);
+			rx[i] = ((x * num) + (num4 * w)) + num12;
+			ry[i] = ((y * num) + (num3 * w)) + num11;
+			rz[i] = ((z * num) + (num2 * w)) + num10;
+			rw[i] = (w * num) - num9;
+		}
+	}
+
+	void QuaternionStream::Normalize(QuaternionStream const& quaternion, QuaternionStream& result) {
+		const size_t count = quaternion.Count();
+		result.Resize(count);
+
+		const double* x = quaternion.X.data();
+		const double* y = quaternion.Y.data();
+		const double* z = quaternion.Z.data();
+		const double* w = quaternion.W.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+		double* rw = result.W.data();
+
+		for (size_t i = 0; i < count; ++i) {
+			const double num = 1.0 / std::sqrt((x[i] * x[i]) + (y[i] * y[i]) + (z[i] * z[i]) + (w[i] * w[i]));
+			rx[i] = x[i] * num;
+			ry[i] = y[i] * num;
+			rz[i] = z[i] * num;
+			rw[i] = w[i] * num;
+		}
+	}
+
+	void QuaternionStream::Lerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, double amount, QuaternionStream& result) {
+		const size_t count = minCount(quaternion1.Count(), quaternion2.Count());
+		lerp(quaternion1, quaternion2, &amount, 0, count, result);
+	}
+
+	void QuaternionStream::Lerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, std::vector<double> const& amounts, QuaternionStream& result) {
+		const size_t count = minCount(minCount(quaternion1.Count(), quaternion2.Count()), amounts.size());
+		lerp(quaternion1, quaternion2, amounts.data(), 1, count, result);
+	}
+
+	void QuaternionStream::Slerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, double amount, QuaternionStream& result) {
+		const size_t count = minCount(quaternion1.Count(), quaternion2.Count());
+		slerp(quaternion1, quaternion2, &amount, 0, count, result);
+	}
+
+	void QuaternionStream::Slerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, std::vector<double> const& amounts, QuaternionStream& result) {
+		const size_t count = minCount(minCount(quaternion1.Count(), quaternion2.Count()), amounts.size());
+		slerp(quaternion1, quaternion2, amounts.data(), 1, count, result);
+	}
+
+	void QuaternionStream::Transform(Vector3Stream const& values, QuaternionStream const& rotations, Vector3Stream& result) {
+		const size_t count = minCount(values.Count(), rotations.Count());
+		result.Resize(count);
+
+		const double* vx = values.X.data();
+		const double* vy = values.Y.data();
+		const double* vz = values.Z.data();
+		const double* qx = rotations.X.data();
+		const double* qy = rotations.Y.data();
+		const double* qz = rotations.Z.data();
+		const double* qw = rotations.W.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+
+		for (size_t i = 0; i < count; ++i) {
+			const double x = 2. * (qy[i] * vz[i] - qz[i] * vy[i]);
+			const double y = 2. * (qz[i] * vx[i] - qx[i] * vz[i]);
+			const double z = 2. * (qx[i] * vy[i] - qy[i] * vx[i]);
+
+			const double resultX = vx[i] + x * qw[i] + (qy[i] * z - qz[i] * y);
+			const double resultY = vy[i] + y * qw[i] + (qz[i] * x - qx[i] * z);
+			const double resultZ = vz[i] + z * qw[i] + (qx[i] * y - qy[i] * x);
+
+			rx[i] = resultX;
+			ry[i] = resultY;
+			rz[i] = resultZ;
+		}
+	}
+
+	void QuaternionStream::Transform(Vector3Stream const& values, Quaternion const& rotation, Vector3Stream& result) {
+		const size_t count = values.Count();
+		result.Resize(count);
+
+		const double* vx = values.X.data();
+		const double* vy = values.Y.data();
+		const double* vz = values.Z.data();
+		double* rx = result.X.data();
+		double* ry = result.Y.data();
+		double* rz = result.Z.data();
+
+		const double qx = rotation.X;
+		const double qy = rotation.Y;
+		const double qz = rotation.Z;
+		const double qw = rotation.W;
+
+		for (size_t i = 0; i < count; ++i) {
+			const double x = 2. * (qy * vz[i] - qz * vy[i]);
+			const double y = 2. * (qz * vx[i] - qx * vz[i]);
+			const double z = 2. * (qx * vy[i] - qy * vx[i]);
+
+			const double resultX = vx[i] + x * qw + (qy * z - qz * y);
+			const double resultY = vy[i] + y * qw + (qz * x - qx * z);
+			const double resultZ = vz[i] + z * qw + (qx * y - qy * x);
+
+			rx[i] = resultX;
+			ry[i] = resultY;
+			rz[i] = resultZ;
+		}
+	}
+
+	//----- Members
+
+	size_t QuaternionStream::Count() const {
+		return X.size();
+	}
+
+	void QuaternionStream::Resize(size_t count) {
+		X.resize(count);
+		Y.resize(count);
+		Z.resize(count);
+		W.resize(count);
+	}
+
+	Quaternion QuaternionStream::Get(size_t index) const {
+		return Quaternion(X[index], Y[index], Z[index], W[index]);
+	}
+
+	void QuaternionStream::Set(size_t index, Quaternion const& value) {
+		X[index] = value.X;
+		Y[index] = value.Y;
+		Z[index] = value.Z;
+		W[index] = value.W;
+	}
+
+	void QuaternionStream::CopyTo(std::vector<Quaternion>& destinationArray) const {
+		destinationArray.resize(Count());
+
+		for (size_t i = 0; i < destinationArray.size(); ++i) {
+			destinationArray[i] = Quaternion(X[i], Y[i], Z[i], W[i]);
+		}
+	}
+}
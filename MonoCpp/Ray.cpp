@@ -1,10 +1,11 @@
+#include <cmath>
 #include <limits>
+#include <numeric>
 #include "Space3d.h"
 #include "MathHelper.h"
+#include "Parallel.h"
 
 namespace Xna {
-    static double nan = std::numeric_limits<double>::quiet_NaN();
-
 	Ray::Ray() : 
 		Position(Vector3()), Direction(Vector3()) {}
 
@@ -22,13 +23,13 @@ namespace Xna {
 	double Ray::Intersects(BoundingBox const& box) const {
         const double Epsilon = MathHelper::EPSILON;        
 
-        double tMin = nan;
-        double tMax = nan;
+        double tMin = MathHelper::NaN;
+        double tMax = MathHelper::NaN;
 
         if (std::abs(Direction.X) < Epsilon)
         {
             if (Position.X < box.Min.X || Position.X > box.Max.X)
-                return nan;
+                return MathHelper::NaN;
         }
         else
         {
@@ -46,7 +47,7 @@ namespace Xna {
         if (std::abs(Direction.Y) < Epsilon)
         {
             if (Position.Y < box.Min.Y || Position.Y > box.Max.Y)
-                return nan;
+                return MathHelper::NaN;
         }
         else
         {
@@ -62,7 +63,7 @@ namespace Xna {
 
             //(tMin.HasValue && tMin > tMaxZ) || (tMax.HasValue && tMinZ > tMax)
             if ((!MathHelper::IsNan(tMin) && tMin > tMaxY) || (!MathHelper::IsNan(tMax) && tMinY > tMax))
-                return nan;
+                return MathHelper::NaN;
 
             //!tMin.HasValue || tMinZ > tMin) tMin = tMinZ;
             if (MathHelper::IsNan(tMin) || tMinY > tMin) tMin = tMinY;
@@ -73,7 +74,7 @@ namespace Xna {
         if (std::abs(Direction.Z) < Epsilon)
         {
             if (Position.Z < box.Min.Z || Position.Z > box.Max.Z)
-                return nan;
+                return MathHelper::NaN;
         }
         else
         {
@@ -89,7 +90,7 @@ namespace Xna {
 
             if ((!MathHelper::IsNan(tMin) && tMin > tMaxZ) ||
                 (!MathHelper::IsNan(tMax) && tMinZ > tMax))
-                return nan;
+                return MathHelper::NaN;
 
             if (MathHelper::IsNan(tMin) || tMinZ > tMin) tMin = tMinZ;
             if (MathHelper::IsNan(tMax) || tMaxZ < tMax) tMax = tMaxZ;
@@ -103,7 +104,7 @@ namespace Xna {
         // a negative tMin means that the intersection point is behind the ray's origin
         // we discard these as not hitting the AABB
         if (tMin < 0) 
-            return nan;
+            return MathHelper::NaN;
 
         return tMin;
 	};
@@ -124,12 +125,12 @@ namespace Xna {
         distanceAlongRay = Vector3::Dot(Direction, difference);
         
         if (distanceAlongRay < 0) {
-            return nan;
+            return MathHelper::NaN;
         }
         
         double dist = sphereRadiusSquared + distanceAlongRay * distanceAlongRay - differenceLengthSquared;
 
-        return (dist < 0) ? nan : distanceAlongRay - MathHelper::Sqrt(dist);
+        return (dist < 0) ? MathHelper::NaN : distanceAlongRay - MathHelper::Sqrt(dist);
     }
    
     double Ray::Intersects(Plane const& plane) const {
@@ -138,7 +139,7 @@ namespace Xna {
         double result;
 
         if (std::abs(den) < 0.00001) {
-            return nan;
+            return MathHelper::NaN;
         }
 
         result = (-plane.D - Vector3::Dot(plane.Normal, Position)) / den;
@@ -146,7 +147,7 @@ namespace Xna {
         if (result < 0.0f)
         {
             if (result < -0.00001f) {
-                return nan;
+                return MathHelper::NaN;
             }
 
             result = 0.0f;
@@ -155,6 +156,30 @@ namespace Xna {
         return result;
     }
 
+    double Ray::Intersects(BoundingFrustum const& frustum) const {
+        return frustum.Intersects((*this));
+    }
+
+    size_t Ray::Intersects(std::vector<Ray> const& rays, BoundingFrustum const& frustum, std::vector<double>& result) {
+        const size_t count = rays.size();
+        result.resize(count);
+        std::vector<size_t> hits(Parallel::ChunkCount(count, Parallel::DefaultChunkSize), 0);
+
+        // The frustum test reads only the planes, so the threads can share it.
+        Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t chunk, size_t begin, size_t end) {
+            size_t found = 0;
+
+            for (size_t i = begin; i < end; ++i) {
+                result[i] = frustum.Intersects(rays[i]);
+                found += std::isnan(result[i]) ? 0 : 1;
+            }
+
+            hits[chunk] = found;
+        });
+
+        return std::accumulate(hits.begin(), hits.end(), size_t(0));
+    }
+
     void Ray::Deconstruct(Vector3& position, Vector3& direction) const {
         position = Position;
         direction = Direction;
@@ -0,0 +1,214 @@
+#include "Streams.h"
+
+namespace Xna {
+
+	RectangleStream::RectangleStream() {}
+
+	RectangleStream::RectangleStream(size_t count) :
+		X(count), Y(count), Width(count), Height(count) {}
+
+	RectangleStream::RectangleStream(std::vector<Rectangle> const& values) :
+		X(values.size()), Y(values.size()), Width(values.size()), Height(values.size()) {
+
+		for (size_t i = 0; i < values.size(); ++i) {
+			X[i] = values[i].X;
+			Y[i] = values[i].Y;
+			Width[i] = values[i].Width;
+			Height[i] = values[i].Height;
+		}
+	}
+
+	//----- Members
+
+	size_t RectangleStream::Count() const {
+		return X.size();
+	}
+
+	void RectangleStream::Resize(size_t count) {
+		X.resize(count);
+		Y.resize(count);
+		Width.resize(count);
+		Height.resize(count);
+	}
+
+	void RectangleStream::Reserve(size_t count) {
+		X.reserve(count);
+		Y.reserve(count);
+		Width.reserve(count);
+		Height.reserve(count);
+	}
+
+	Rectangle RectangleStream::Get(size_t index) const {
+		return Rectangle(X[index], Y[index], Width[index], Height[index]);
+	}
+
+	void RectangleStream::Set(size_t index, Rectangle const& value) {
+		X[index] = value.X;
+		Y[index] = value.Y;
+		Width[index] = value.Width;
+		Height[index] = value.Height;
+	}
+
+	void RectangleStream::Add(Rectangle const& value) {
+		X.push_back(value.X);
+		Y.push_back(value.Y);
+		Width.push_back(value.Width);
+		Height.push_back(value.Height);
+	}
+
+	void RectangleStream::CopyTo(std::vector<Rectangle>& destinationArray) const {
+		destinationArray.resize(Count());
+
+		for (size_t i = 0; i < destinationArray.size(); ++i) {
+			destinationArray[i] = Rectangle(X[i], Y[i], Width[i], Height[i]);
+		}
+	}
+
+	//----- Static
+
+	size_t RectangleStream::Intersects(RectangleStream const& rectangles, Rectangle const& value, std::vector<byte>& result) {
+		const size_t count = rectangles.Count();
+		result.resize(count);
+
+		const i32* x = rectangles.X.data();
+		const i32* y = rectangles.Y.data();
+		const i32* w = rectangles.Width.data();
+		const i32* h = rectangles.Height.data();
+		byte* mask = result.data();
+		const i32 left = value.Left();
+		const i32 top = value.Top();
+		const i32 right = value.Right();
+		const i32 bottom = value.Bottom();
+		size_t hits = 0;
+
+		// Non-short-circuit ands keep the loop free of branches.
+		for (size_t i = 0; i < count; ++i) {
+			const byte hit = static_cast<byte>((left < x[i] + w[i]) & (x[i] < right) & (top < y[i] + h[i]) & (y[i] < bottom));
+			mask[i] = hit;
+			hits += hit;
+		}
+
+		return hits;
+	}
+
+	size_t RectangleStream::Contains(RectangleStream const& rectangles, Point const& value, std::vector<byte>& result) {
+		const size_t count = rectangles.Count();
+		result.resize(count);
+
+		const i32* x = rectangles.X.data();
+		const i32* y = rectangles.Y.data();
+		const i32* w = rectangles.Width.data();
+		const i32* h = rectangles.Height.data();
+		byte* mask = result.data();
+		size_t hits = 0;
+
+		for (size_t i = 0; i < count; ++i) {
+			const byte hit = static_cast<byte>((x[i] <= value.X) & (value.X < x[i] + w[i]) & (y[i] <= value.Y) & (value.Y < y[i] + h[i]));
+			mask[i] = hit;
+			hits += hit;
+		}
+
+		return hits;
+	}
+
+	void RectangleStream::Clip(RectangleStream const& rectangles, Rectangle const& viewport, RectangleStream& result) {
+		const size_t count = rectangles.Count();
+		result.Resize(count);
+
+		const i32* x = rectangles.X.data();
+		const i32* y = rectangles.Y.data();
+		const i32* w = rectangles.Width.data();
+		const i32* h = rectangles.Height.data();
+		i32* rx = result.X.data();
+		i32* ry = result.Y.data();
+		i32* rw = result.Width.data();
+		i32* rh = result.Height.data();
+		const i32 left = viewport.Left();
+		const i32 top = viewport.Top();
+		const i32 right = viewport.Right();
+		const i32 bottom = viewport.Bottom();
+
+		for (size_t i = 0; i < count; ++i) {
+			const i32 l = x[i] > left ? x[i] : left;
+			const i32 t = y[i] > top ? y[i] : top;
+			const i32 r = x[i] + w[i] < right ? x[i] + w[i] : right;
+			const i32 b = y[i] + h[i] < bottom ? y[i] + h[i] : bottom;
+			// All ones when the rectangles intersect as Rectangle::Intersects tests them, zero otherwise.
+			const i32 keep = -static_cast<i32>((left < x[i] + w[i]) & (x[i] < right) & (top < y[i] + h[i]) & (y[i] < bottom));
+
+			rx[i] = l & keep;
+			ry[i] = t & keep;
+			rw[i] = (r - l) & keep;
+			rh[i] = (b - t) & keep;
+		}
+	}
+
+	Rectangle RectangleStream::Union(RectangleStream const& rectangles) {
+		const size_t count = rectangles.Count();
+
+		if (count == 0)
+			return Rectangle::Empty();
+
+		const i32* x = rectangles.X.data();
+		const i32* y = rectangles.Y.data();
+		const i32* w = rectangles.Width.data();
+		const i32* h = rectangles.Height.data();
+		i32 left = x[0];
+		i32 top = y[0];
+		i32 right = x[0] + w[0];
+		i32 bottom = y[0] + h[0];
+
+		for (size_t i = 1; i < count; ++i) {
+			left = x[i] < left ? x[i] : left;
+			top = y[i] < top ? y[i] : top;
+			right = x[i] + w[i] > right ? x[i] + w[i] : right;
+			bottom = y[i] + h[i] > bottom ? y[i] + h[i] : bottom;
+		}
+
+		return Rectangle(left, top, right - left, bottom - top);
+	}
+
+	void RectangleStream::Merge(RectangleStream const& rectangles, RectangleStream& result) {
+		if (&rectangles == &result) {
+			const RectangleStream copy(rectangles);
+			Merge(copy, result);
+			return;
+		}
+
+		// Built in the result so its storage is reused from call to call.
+		RectangleStream& merged = result;
+		merged.Resize(0);
+
+		for (size_t i = 0; i < rectangles.Count(); ++i) {
+			if (rectangles.Width[i] <= 0 || rectangles.Height[i] <= 0)
+				continue;
+
+			Rectangle current = rectangles.Get(i);
+			bool grown = true;
+
+			// A grown rectangle can reach ones it missed before, so scan again until it stops growing.
+			while (grown) {
+				grown = false;
+				size_t j = 0;
+
+				while (j < merged.Count()) {
+					const Rectangle other = merged.Get(j);
+
+					if (!current.Intersects(other)) {
+						++j;
+						continue;
+					}
+
+					current = Rectangle::Union(current, other);
+					grown = true;
+
+					const size_t last = merged.Count() - 1;
+					merged.Set(j, merged.Get(last));
+					merged.Resize(last);
+				}
+			}
+
+			merged.Add(current);
+		}
+	}
+}
@@ -0,0 +1,267 @@
+#include <cmath>
+#include "Skinning.h"
+#include "Parallel.h"
+
+namespace Xna {
+
+	// Turns result from local poses into a palette: model-space poses first, since parents come
+	// before their children and so are ready when a child needs them, then the inverse bind poses.
+	static void composePalette(std::vector<i32> const& parents, std::vector<AffineMatrix> const& inverseBindPoses, std::vector<AffineMatrix>& result) {
+		const size_t count = result.size();
+
+		for (size_t i = 0; i < count; ++i) {
+			const i32 parent = parents[i];
+
+			if (parent >= 0 && static_cast<size_t>(parent) < i)
+				result[i] = result[i] * result[parent];
+		}
+
+		for (size_t i = 0; i < count; ++i)
+			result[i] = inverseBindPoses[i] * result[i];
+	}
+
+	// Skins vertices [begin, end). Normals are skipped when normals is null.
+	// The blended matrix is summed in locals so the compiler keeps it in registers.
+	static void skinLinear(std::vector<AffineMatrix> const& palette, std::vector<BoneWeights> const& weights,
+		Vector3Stream const& positions, Vector3Stream const* normals, Vector3Stream& resultPositions, Vector3Stream* resultNormals,
+		size_t begin, size_t end) {
+
+		const size_t boneCount = palette.size();
+		const AffineMatrix* bones = palette.data();
+
+		for (size_t i = begin; i < end; ++i) {
+			BoneWeights const& influence = weights[i];
+			double m11 = 0, m12 = 0, m13 = 0;
+			double m21 = 0, m22 = 0, m23 = 0;
+			double m31 = 0, m32 = 0, m33 = 0;
+			double m41 = 0, m42 = 0, m43 = 0;
+
+			for (i32 k = 0; k < 4; ++k) {
+				if (influence.Bones[k] >= boneCount)
+					continue;
+
+				AffineMatrix const& bone = bones[influence.Bones[k]];
+				const double w = influence.Weights[k];
+
+				m11 += w * bone.M11; m12 += w * bone.M12; m13 += w * bone.M13;
+				m21 += w * bone.M21; m22 += w * bone.M22; m23 += w * bone.M23;
+				m31 += w * bone.M31; m32 += w * bone.M32; m33 += w * bone.M33;
+				m41 += w * bone.M41; m42 += w * bone.M42; m43 += w * bone.M43;
+			}
+
+			const double x = positions.X[i];
+			const double y = positions.Y[i];
+			const double z = positions.Z[i];
+
+			resultPositions.X[i] = (x * m11) + (y * m21) + (z * m31) + m41;
+			resultPositions.Y[i] = (x * m12) + (y * m22) + (z * m32) + m42;
+			resultPositions.Z[i] = (x * m13) + (y * m23) + (z * m33) + m43;
+
+			if (normals == nullptr)
+				continue;
+
+			const double nx = normals->X[i];
+			const double ny = normals->Y[i];
+			const double nz = normals->Z[i];
+
+			const double rx = (nx * m11) + (ny * m21) + (nz * m31);
+			const double ry = (nx * m12) + (ny * m22) + (nz * m32);
+			const double rz = (nx * m13) + (ny * m23) + (nz * m33);
+			const double length = std::sqrt((rx * rx) + (ry * ry) + (rz * rz));
+			const double scale = length > 0 ? 1.0 / length : 0.0;
+
+			resultNormals->X[i] = rx * scale;
+			resultNormals->Y[i] = ry * scale;
+			resultNormals->Z[i] = rz * scale;
+		}
+	}
+
+	static void skinDualQuaternion(std::vector<DualQuaternion> const& palette, std::vector<BoneWeights> const& weights,
+		Vector3Stream const& positions, Vector3Stream const* normals, Vector3Stream& resultPositions, Vector3Stream* resultNormals,
+		size_t begin, size_t end) {
+
+		const size_t boneCount = palette.size();
+		const DualQuaternion* bones = palette.data();
+
+		for (size_t i = begin; i < end; ++i) {
+			BoneWeights const& influence = weights[i];
+			double rx = 0, ry = 0, rz = 0, rw = 0;
+			double dx = 0, dy = 0, dz = 0, dw = 0;
+			const DualQuaternion* first = nullptr;
+
+			for (i32 k = 0; k < 4; ++k) {
+				if (influence.Bones[k] >= boneCount)
+					continue;
+
+				DualQuaternion const& bone = bones[influence.Bones[k]];
+
+				if (first == nullptr)
+					first = &bone;
+
+				// q and -q are the same rotation: blend each bone on the side of the first one.
+				const double dot = (first->Real.X * bone.Real.X) + (first->Real.Y * bone.Real.Y) + (first->Real.Z * bone.Real.Z) + (first->Real.W * bone.Real.W);
+				const double w = dot < 0 ? -influence.Weights[k] : influence.Weights[k];
+
+				rx += w * bone.Real.X; ry += w * bone.Real.Y; rz += w * bone.Real.Z; rw += w * bone.Real.W;
+				dx += w * bone.Dual.X; dy += w * bone.Dual.Y; dz += w * bone.Dual.Z; dw += w * bone.Dual.W;
+			}
+
+			const double length = std::sqrt((rx * rx) + (ry * ry) + (rz * rz) + (rw * rw));
+
+			if (!(length > 0)) {
+				resultPositions.X[i] = resultPositions.Y[i] = resultPositions.Z[i] = 0;
+
+				if (normals != nullptr)
+					resultNormals->X[i] = resultNormals->Y[i] = resultNormals->Z[i] = 0;
+
+				continue;
+			}
+
+			const double scale = 1.0 / length;
+			rx *= scale; ry *= scale; rz *= scale; rw *= scale;
+			dx *= scale; dy *= scale; dz *= scale; dw *= scale;
+
+			// The translation is the vector part of 2 * dual * conjugate(real).
+			const double tx = 2. * ((rw * dx) - (dw * rx) + (ry * dz) - (rz * dy));
+			const double ty = 2. * ((rw * dy) - (dw * ry) + (rz * dx) - (rx * dz));
+			const double tz = 2. * ((rw * dz) - (dw * rz) + (rx * dy) - (ry * dx));
+
+			// Rotation as in Vector3::Transform(Vector3, Quaternion).
+			const double x = positions.X[i];
+			const double y = positions.Y[i];
+			const double z = positions.Z[i];
+			const double cx = 2. * ((ry * z) - (rz * y));
+			const double cy = 2. * ((rz * x) - (rx * z));
+			const double cz = 2. * ((rx * y) - (ry * x));
+
+			resultPositions.X[i] = x + (cx * rw) + ((ry * cz) - (rz * cy)) + tx;
+			resultPositions.Y[i] = y + (cy * rw) + ((rz * cx) - (rx * cz)) + ty;
+			resultPositions.Z[i] = z + (cz * rw) + ((rx * cy) - (ry * cx)) + tz;
+
+			if (normals == nullptr)
+				continue;
+
+			const double nx = normals->X[i];
+			const double ny = normals->Y[i];
+			const double nz = normals->Z[i];
+			const double ex = 2. * ((ry * nz) - (rz * ny));
+			const double ey = 2. * ((rz * nx) - (rx * nz));
+			const double ez = 2. * ((rx * ny) - (ry * nx));
+
+			resultNormals->X[i] = nx + (ex * rw) + ((ry * ez) - (rz * ey));
+			resultNormals->Y[i] = ny + (ey * rw) + ((rz * ex) - (rx * ez));
+			resultNormals->Z[i] = nz + (ez * rw) + ((rx * ey) - (ry * ex));
+		}
+	}
+
+	// DualQuaternion
+
+	DualQuaternion DualQuaternion::Create(Quaternion const& rotation, Vector3 const& translation) {
+		// Half of the pure quaternion (translation, 0) times the rotation.
+		DualQuaternion result;
+		result.Real = rotation;
+		result.Dual.X = 0.5 * ((rotation.W * translation.X) + (translation.Y * rotation.Z) - (translation.Z * rotation.Y));
+		result.Dual.Y = 0.5 * ((rotation.W * translation.Y) + (translation.Z * rotation.X) - (translation.X * rotation.Z));
+		result.Dual.Z = 0.5 * ((rotation.W * translation.Z) + (translation.X * rotation.Y) - (translation.Y * rotation.X));
+		result.Dual.W = -0.5 * ((translation.X * rotation.X) + (translation.Y * rotation.Y) + (translation.Z * rotation.Z));
+
+		return result;
+	}
+
+	DualQuaternion DualQuaternion::Create(AffineMatrix const& matrix) {
+		Vector3 scale;
+		Quaternion rotation;
+		Vector3 translation;
+
+		matrix.ToMatrix().Decompose(scale, rotation, translation);
+
+		return Create(rotation, translation);
+	}
+
+	Vector3 DualQuaternion::Translation() const {
+		return Vector3(
+			2. * ((Real.W * Dual.X) - (Dual.W * Real.X) + (Real.Y * Dual.Z) - (Real.Z * Dual.Y)),
+			2. * ((Real.W * Dual.Y) - (Dual.W * Real.Y) + (Real.Z * Dual.X) - (Real.X * Dual.Z)),
+			2. * ((Real.W * Dual.Z) - (Dual.W * Real.Z) + (Real.X * Dual.Y) - (Real.Y * Dual.X)));
+	}
+
+	// Skinning
+
+	void Skinning::BuildPalette(std::vector<i32> const& parents, std::vector<AffineMatrix> const& localPoses,
+		std::vector<AffineMatrix> const& inverseBindPoses, std::vector<AffineMatrix>& result) {
+
+		const size_t count = minCount(minCount(parents.size(), localPoses.size()), inverseBindPoses.size());
+
+		if (&result == &localPoses)
+			result.resize(count);
+		else
+			result.assign(localPoses.begin(), localPoses.begin() + count);
+
+		composePalette(parents, inverseBindPoses, result);
+	}
+
+	void Skinning::BuildPalette(std::vector<i32> const& parents, TransformStream const& localPoses,
+		std::vector<AffineMatrix> const& inverseBindPoses, std::vector<AffineMatrix>& result) {
+
+		const size_t count = minCount(minCount(parents.size(), localPoses.Count()), inverseBindPoses.size());
+		result.resize(count);
+
+		for (size_t i = 0; i < count; ++i)
+			result[i] = AffineMatrix::CreateFromTRS(localPoses.Translation.Get(i), localPoses.Rotation.Get(i), localPoses.Scale.Get(i));
+
+		composePalette(parents, inverseBindPoses, result);
+	}
+
+	void Skinning::BuildPalette(std::vector<AffineMatrix> const& palette, std::vector<DualQuaternion>& result) {
+		result.resize(palette.size());
+
+		for (size_t i = 0; i < palette.size(); ++i)
+			result[i] = DualQuaternion::Create(palette[i]);
+	}
+
+	void Skinning::Skin(std::vector<AffineMatrix> const& palette, std::vector<BoneWeights> const& weights,
+		Vector3Stream const& positions, Vector3Stream& result) {
+
+		const size_t count = minCount(weights.size(), positions.Count());
+		result.Resize(count);
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t, size_t begin, size_t end) {
+			skinLinear(palette, weights, positions, nullptr, result, nullptr, begin, end);
+		});
+	}
+
+	void Skinning::Skin(std::vector<AffineMatrix> const& palette, std::vector<BoneWeights> const& weights,
+		Vector3Stream const& positions, Vector3Stream const& normals, Vector3Stream& resultPositions, Vector3Stream& resultNormals) {
+
+		const size_t count = minCount(minCount(weights.size(), positions.Count()), normals.Count());
+		resultPositions.Resize(count);
+		resultNormals.Resize(count);
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t, size_t begin, size_t end) {
+			skinLinear(palette, weights, positions, &normals, resultPositions, &resultNormals, begin, end);
+		});
+	}
+
+	void Skinning::Skin(std::vector<DualQuaternion> const& palette, std::vector<BoneWeights> const& weights,
+		Vector3Stream const& positions, Vector3Stream& result) {
+
+		const size_t count = minCount(weights.size(), positions.Count());
+		result.Resize(count);
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t, size_t begin, size_t end) {
+			skinDualQuaternion(palette, weights, positions, nullptr, result, nullptr, begin, end);
+		});
+	}
+
+	void Skinning::Skin(std::vector<DualQuaternion> const& palette, std::vector<BoneWeights> const& weights,
+		Vector3Stream const& positions, Vector3Stream const& normals, Vector3Stream& resultPositions, Vector3Stream& resultNormals) {
+
+		const size_t count = minCount(minCount(weights.size(), positions.Count()), normals.Count());
+		resultPositions.Resize(count);
+		resultNormals.Resize(count);
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t, size_t begin, size_t end) {
+			skinDualQuaternion(palette, weights, positions, &normals, resultPositions, &resultNormals, begin, end);
+		});
+	}
+}
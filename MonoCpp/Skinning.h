@@ -0,0 +1,74 @@
+#ifndef SKINNING_H
+#define SKINNING_H
+
+#include <vector>
+#include "CSharp.h"
+#include "Structs.h"
+#include "Streams.h"
+
+namespace Xna {
+
+	// The bones that move a vertex and how much each one does.
+	// Weights should sum to 1. An unused influence has a zero weight; an influence
+	// whose bone is outside the palette is ignored.
+	struct BoneWeights {
+		u16 Bones[4];
+		double Weights[4];
+	};
+
+	// A rigid transform as a unit dual quaternion: Real is the rotation and Dual
+	// is half the translation, as a pure quaternion, times Real.
+	struct DualQuaternion {
+		Quaternion Real;
+		Quaternion Dual;
+
+		// Creates the dual quaternion of a rotation followed by a translation.
+		static DualQuaternion Create(Quaternion const& rotation, Vector3 const& translation);
+		// Creates the dual quaternion of the rotation and translation of a matrix. Scale is dropped.
+		static DualQuaternion Create(AffineMatrix const& matrix);
+
+		// Gets the translation.
+		Vector3 Translation() const;
+	};
+
+	// CPU skinning of vertex streams, for servers without a GPU and for
+	// anything that needs the posed mesh, such as hitboxes.
+	// Vertices are split in chunks that run in parallel with Parallel::For.
+	// Skin results may not be one of the inputs.
+	struct Skinning {
+
+		// Builds the palette of a skeleton from the local pose of each bone.
+		// parents: the parent of each bone, or -1 for a root. A parent must come before its children;
+		// any other parent makes the bone a root.
+		// localPoses: each bone relative to its parent.
+		// inverseBindPoses: the inverse of each bone's model-space transform in the bind pose.
+		// result: for each bone, inverseBindPose * localPose * parent's model-space pose,
+		// which takes a vertex from the bind pose to the current pose.
+		// The bone count is the smallest count of the inputs.
+		static void BuildPalette(std::vector<i32> const& parents, std::vector<AffineMatrix> const& localPoses,
+			std::vector<AffineMatrix> const& inverseBindPoses, std::vector<AffineMatrix>& result);
+		// Builds the palette from local poses given as scale, rotation and translation, as in Matrix::CreateFromTRS.
+		static void BuildPalette(std::vector<i32> const& parents, TransformStream const& localPoses,
+			std::vector<AffineMatrix> const& inverseBindPoses, std::vector<AffineMatrix>& result);
+		// Converts a palette for dual quaternion skinning. Scale in the palette is dropped.
+		static void BuildPalette(std::vector<AffineMatrix> const& palette, std::vector<DualQuaternion>& result);
+
+		// Linear blend skinning: each position is transformed by the weighted sum of its bones' matrices.
+		static void Skin(std::vector<AffineMatrix> const& palette, std::vector<BoneWeights> const& weights,
+			Vector3Stream const& positions, Vector3Stream& result);
+		// Linear blend skinning of positions and normals. Normals are transformed by the blended matrix
+		// without its translation and renormalized; the matrix must not have a non-uniform scale.
+		static void Skin(std::vector<AffineMatrix> const& palette, std::vector<BoneWeights> const& weights,
+			Vector3Stream const& positions, Vector3Stream const& normals, Vector3Stream& resultPositions, Vector3Stream& resultNormals);
+
+		// Dual quaternion skinning, which blends rotations rather than matrices and so keeps
+		// the volume of twisted joints that linear blending collapses.
+		static void Skin(std::vector<DualQuaternion> const& palette, std::vector<BoneWeights> const& weights,
+			Vector3Stream const& positions, Vector3Stream& result);
+		// Dual quaternion skinning of positions and normals.
+		static void Skin(std::vector<DualQuaternion> const& palette, std::vector<BoneWeights> const& weights,
+			Vector3Stream const& positions, Vector3Stream const& normals, Vector3Stream& resultPositions, Vector3Stream& resultNormals);
+	};
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef SPACE2D_H
+#define SPACE2D_H
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "Structs.h"
+#include "CSharp.h"
+
+namespace Xna {
+
+	// Spatial indexes over Rectangle for hit-testing and 2D collision.
+	// Both return ids from Insert that stay valid until the item is removed; removed ids
+	// are reused by later inserts. Queries use the same tests as Rectangle::Intersects and
+	// Rectangle::Contains, append to the result without clearing it and report each item once.
+	// Queries keep scratch state, so one index must not be queried from several threads at once.
+
+	//-----------------------------------//
+	//-----		$ SpatialHash		-----//
+	//-----------------------------------//
+
+	// A hashed uniform grid. Best when the items are of similar size, with a cell size
+	// about that of the typical item; an item is linked into every cell it overlaps.
+	struct SpatialHash {
+
+		SpatialHash(i32 cellSize);
+
+		// Adds an item and returns its id.
+		u32 Insert(Rectangle const& bounds);
+		// Changes the bounds of an item. Only the cells that changed are relinked.
+		void Move(u32 id, Rectangle const& bounds);
+		void Remove(u32 id);
+		// Gets whether the id refers to a live item.
+		bool Contains(u32 id) const;
+		Rectangle Bounds(u32 id) const;
+		// Returns the number of live items.
+		size_t Count() const;
+		void Clear();
+
+		// Appends the ids of the items that intersect the region.
+		void Query(Rectangle const& region, std::vector<u32>& result) const;
+		// Appends the ids of the items that contain the point.
+		void Query(Point const& point, std::vector<u32>& result) const;
+		void Query(Vector2 const& point, std::vector<u32>& result) const;
+		// Appends every pair of intersecting items once, the lower id first.
+		void QueryPairs(std::vector<std::pair<u32, u32>>& result) const;
+
+	private:
+		struct Item {
+			Rectangle Bounds;
+			bool Alive;
+		};
+
+		// A link of an item into a cell, pooled and chained per cell.
+		struct Entry {
+			u32 Item;
+			u32 Next;
+		};
+
+		// The cells an item overlaps, bounds included.
+		struct CellRange {
+			i32 MinX;
+			i32 MinY;
+			i32 MaxX;
+			i32 MaxY;
+		};
+
+		i32 _cellSize;
+		std::vector<Item> _items;
+		std::vector<u32> _freeItems;
+		std::vector<Entry> _entries;
+		u32 _freeEntries;
+		std::unordered_map<u64, u32> _cells;
+		size_t _count;
+		// Query stamps so items spanning several cells are reported once.
+		mutable std::vector<u32> _stamps;
+		mutable u32 _stamp;
+
+		i32 cell(i32 coordinate) const;
+		CellRange cellsOf(Rectangle const& bounds) const;
+		void link(u32 id, i32 x, i32 y);
+		void unlink(u32 id, i32 x, i32 y);
+		u32 nextStamp() const;
+	};
+
+	//-----------------------------------//
+	//-----		$ LooseQuadtree		-----//
+	//-----------------------------------//
+
+	// A loose quadtree for items of mixed sizes. Each node's bounds are its cell grown by half
+	// a cell on every side, so an item sits in exactly one node: the deepest one whose cell is
+	// at least the item's size, chosen by the item's center. Items larger than the world or
+	// centered outside it are kept in the root. Nodes come from a pool and empty ones are recycled.
+	struct LooseQuadtree {
+
+		// world: the area most items live in. maxDepth: the number of levels below the root.
+		LooseQuadtree(Rectangle const& world, i32 maxDepth = 8);
+
+		// Adds an item and returns its id.
+		u32 Insert(Rectangle const& bounds);
+		// Changes the bounds of an item. It only changes node if its size or center moved it to another one.
+		void Move(u32 id, Rectangle const& bounds);
+		void Remove(u32 id);
+		// Gets whether the id refers to a live item.
+		bool Contains(u32 id) const;
+		Rectangle Bounds(u32 id) const;
+		// Returns the number of live items.
+		size_t Count() const;
+		void Clear();
+
+		// Appends the ids of the items that intersect the region.
+		void Query(Rectangle const& region, std::vector<u32>& result) const;
+		// Appends the ids of the items that contain the point.
+		void Query(Point const& point, std::vector<u32>& result) const;
+		void Query(Vector2 const& point, std::vector<u32>& result) const;
+		// Appends every pair of intersecting items once, the lower id first.
+		void QueryPairs(std::vector<std::pair<u32, u32>>& result) const;
+
+	private:
+		static constexpr u32 None = 0xffffffff;
+
+		struct Item {
+			Rectangle Bounds;
+			u32 Node;
+			u32 Prev;
+			u32 Next;
+			bool Alive;
+		};
+
+		struct Node {
+			u32 Parent;
+			u32 Children[4];
+			u32 FirstItem;
+			// Items in this node and below it, so empty branches are skipped and recycled.
+			u32 Count;
+		};
+
+		// The cell of a node: its center and half its side.
+		struct Cell {
+			double X;
+			double Y;
+			double Half;
+		};
+
+		Rectangle _world;
+		i32 _maxDepth;
+		std::vector<Item> _items;
+		std::vector<u32> _freeItems;
+		std::vector<Node> _nodes;
+		std::vector<u32> _freeNodes;
+		size_t _count;
+		mutable std::vector<std::pair<u32, Cell>> _stack;
+
+		Cell root() const;
+		static Cell child(Cell const& cell, i32 quadrant);
+		static i32 quadrantOf(Cell const& cell, double x, double y);
+		u32 allocateNode(u32 parent);
+		u32 nodeFor(Rectangle const& bounds, bool create);
+		void link(u32 id, u32 node);
+		void unlink(u32 id);
+		void queryPairs(u32 node, Cell const& cell, std::vector<std::pair<u32, u32>>& result) const;
+		void pairsOf(u32 id, double half, std::vector<std::pair<u32, u32>>& result) const;
+	};
+}
+
+#endif
@@ -1,6 +1,8 @@
 #ifndef SPACE3D_H
 #define SPACE3D_H
 
+#include <memory_resource>
+#include <utility>
 #include <vector>
 #include "Structs.h"
 #include "CSharp.h"
@@ -10,7 +12,9 @@ namespace Xna {
 	struct BoundingBox;
 	struct BoundingSphere;
 	struct BoundingFrustum;
+	struct OrientedBoundingBox;
 	struct Plane;
+	struct Vector3Stream;
 
 	//-------------------------------------------//
 	//-----		$ ContainmentType			-----//	
@@ -40,6 +44,32 @@ namespace Xna {
 		Intersecting
 	};
 
+	//-------------------------------------------//
+	//-----		$ CullingMode				-----//	
+	//-------------------------------------------//
+
+	// Defines how closely a volume is tested against a BoundingFrustum.
+	enum class CullingMode {
+		// Tests the volume against each plane of the frustum. Never misses a volume that intersects the frustum,
+		// but may report one that lies just outside near an edge or corner.
+		Conservative,
+		// Also tests the edges and corners of the frustum, so only intersecting volumes are reported.
+		Exact
+	};
+
+	//-------------------------------------------//
+	//-----		$ BoundingSphereFit			-----//	
+	//-------------------------------------------//
+
+	// Defines how BoundingSphere::CreateFromPoints fits a sphere to a point cloud.
+	enum class BoundingSphereFit {
+		// Starts from the most distant pair of extreme points along the three axes and grows the sphere to enclose every point.
+		Fast,
+		// Starts from the minimum sphere of the extreme points along 7 directions (EPOS-14) and grows it to enclose every point.
+		// Usually tighter than Fast, at about twice its cost.
+		Tight
+	};
+
 	//-------------------------------//
 	//-----		$ Ray			-----//	
 	//-------------------------------//
@@ -58,12 +88,15 @@ namespace Xna {
 		double Intersects(BoundingBox const& box) const;
 		double Intersects(BoundingSphere const& sphere) const;
 		double Intersects(Plane const& plane) const;
+		// Returns the distance along the ray to the frustum, 0 if the ray starts inside it, or NaN if the ray misses it.
+		double Intersects(BoundingFrustum const& frustum) const;
+
+		// Tests every ray against one frustum, in parallel, setting result[i] to the distance of rays[i] as Intersects does.
+		// Returns the number of rays that hit the frustum.
+		static size_t Intersects(std::vector<Ray> const& rays, BoundingFrustum const& frustum, std::vector<double>& result);
 
 		void Deconstruct(Vector3& position, Vector3& direction) const;
 		bool Equals(Ray const& other) const;
-
-		//C# code not implemented
-		//double Intersects(BoundingFrustum frustum);
 	};	
 
 	//-------------------------------//
@@ -85,8 +118,12 @@ namespace Xna {
 		friend bool operator!= (Plane plane1, Plane plane2);
 		friend bool operator== (Plane plane1, Plane plane2);
 
-		static Plane Transform(Plane plane, Matrix matrix);
-		static Plane Transform(Plane plane, Quaternion rotation);
+		static Plane Transform(Plane const& plane, Matrix const& matrix);
+		static Plane Transform(Plane const& plane, Quaternion const& rotation);
+		// Transforms length planes by one matrix, inverting it only once.
+		static void Transform(std::vector<Plane> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Plane>& destinationArray, size_t destinationIndex, size_t length);
+		// Transforms every plane by one matrix, inverting it only once. The destination is resized to the source.
+		static void Transform(std::vector<Plane> const& sourceArray, Matrix const& matrix, std::vector<Plane>& destinationArray);
 		static Plane Normalize(Plane value);
 
 		double Dot(Vector4 const& value) const;
@@ -115,6 +152,33 @@ namespace Xna {
 		static double PerpendicularDistance(Vector3 const& point, Plane const& plane);
 	};	
 
+	//-----------------------------------//
+	//-----		$ PlaneTransform	-----//	
+	//-----------------------------------//
+
+	// A matrix prepared for transforming planes.
+	// Planes transform by the inverse transpose of the matrix, which is kept
+	// between calls and only recomputed when the matrix changes.
+	struct PlaneTransform {
+
+		PlaneTransform();
+		PlaneTransform(Matrix const& matrix);
+
+		// Gets the matrix the planes are transformed by.
+		Matrix Matrix_() const;
+		// Sets the matrix the planes are transformed by. Setting the current matrix again costs nothing.
+		void Matrix_(Matrix const& value);
+
+		Plane Transform(Plane const& plane) const;
+		void Transform(std::vector<Plane> const& sourceArray, size_t sourceIndex, std::vector<Plane>& destinationArray, size_t destinationIndex, size_t length) const;
+		// The destination is resized to the source.
+		void Transform(std::vector<Plane> const& sourceArray, std::vector<Plane>& destinationArray) const;
+
+	private:
+		Matrix _matrix;
+		Matrix _inverseTranspose;
+	};
+
 	//-----------------------------------//
 	//-----		$ BoundingFrustum	-----//	
 	//-----------------------------------//
@@ -137,7 +201,16 @@ namespace Xna {
 		// Gets or sets the Matrix of the frustum.
 		Matrix Matrix_() const;
 		// Sets or sets the Matrix of the frustum.
+		// Only the planes that depend on the changed columns of the matrix are extracted again,
+		// and only the corners that lie on those planes are intersected again.
+		// The corners are rebuilt here rather than on first use, so a const frustum holds no lazy state
+		// and can be read from several threads.
 		void Matrix_(Matrix value);
+		// Moves the frustum by a rigid camera motion (rotation and translation, no scale) given in world space.
+		// The planes and corners are transformed directly instead of being extracted again from the matrix.
+		void Transform(Matrix const& motion);
+		// Moves the frustum by a camera translation given in world space.
+		void Translate(Vector3 const& translation);
 		// Gets the near plane of the frustum.
 		Plane Near() const;
 		// Gets the far plane of the frustum.
@@ -161,18 +234,23 @@ namespace Xna {
 		ContainmentType Contains(Vector3 const& point) const;
 		// Returns a copy of internal corners array.
 		std::vector<Vector3> GetCorners() const;
-		// Returns a copy of internal corners array.
-		void GetCorners(std::vector<Vector3>& corners);
+		// Returns a copy of internal corners array, allocated from the resource.
+		std::pmr::vector<Vector3> GetCorners(std::pmr::memory_resource* resource) const;
+		// Copies the corners to the array, resizing it to CornerCount.
+		void GetCorners(std::vector<Vector3>& corners) const;
+		// Copies the corners to the first CornerCount places of the array.
+		void GetCorners(Vector3* corners) const;
 		// Gets whether or not a specified BoundingBox intersects with this BoundingFrustum.
 		bool Intersects(BoundingBox const& box) const;
 		// Gets whether or not a specified BoundingFrustum intersects with this BoundingFrustum.
 		bool Intersects(BoundingFrustum const& frustum) const;
 		// Gets whether or not a specified BoundingSphere intersects with this BoundingFrustum.
-		bool Intersects(BoundingSphere const& sphere) const;
+		// The planes are tested first and the test stops at the first one the sphere lies entirely in front of.
+		bool Intersects(BoundingSphere const& sphere, CullingMode mode = CullingMode::Conservative) const;
 		// Gets type of intersection between specified Plane and this BoundingFrustum.
 		PlaneIntersectionType Intersects(Plane const& plane) const;
 		// Gets the distance of intersection of Ray and this BoundingFrustum or null if no intersection happens.
-		// Returns the distance at which ray intersects with this BoundingFrustum or NaN if no intersection happens.</returns>
+		// Returns the distance at which ray intersects with this BoundingFrustum, 0 if the ray starts inside it, or NaN if no intersection happens.
 		// The original C# source code returns an object of type Nullable<float>
 		double Intersects(Ray const& ray) const;
 
@@ -180,6 +258,10 @@ namespace Xna {
 		bool Equals(BoundingFrustum const& other);
 
 	private:
+		// Masks with one bit per plane, in the order of _planes, and one bit per corner.
+		static constexpr byte AllPlanes = (1 << PlaneCount) - 1;
+		static constexpr byte AllCorners = 0xff;
+
 		Matrix _matrix;
 		std::vector<Vector3> _corners;
 		std::vector<Plane> _planes;
@@ -187,8 +269,8 @@ namespace Xna {
 		static Vector3 IntersectionPoint(Plane const& a, Plane const& b, Plane const& c);
 		void NormalizePlane(Plane& p);
 
-		void CreateCorners();
-		void CreatePlanes();
+		void CreateCorners(byte corners);
+		void CreatePlanes(byte planes);
 	};
 
 	//-----------------------------------//
@@ -209,6 +291,10 @@ namespace Xna {
 
 		static BoundingSphere CreateFromFrustum(BoundingFrustum const& frustum);
 		static BoundingSphere CreateFromPoints(std::vector<Vector3> const& points);
+		// Creates a sphere enclosing count points. Large inputs are split across threads.
+		static BoundingSphere CreateFromPoints(Vector3 const* points, size_t count, BoundingSphereFit fit = BoundingSphereFit::Fast);
+		// Creates a sphere enclosing every point of the stream. Large inputs are split across threads.
+		static BoundingSphere CreateFromPoints(Vector3Stream const& points, BoundingSphereFit fit = BoundingSphereFit::Fast);
 		static BoundingSphere CreateMerged(BoundingSphere const& original, BoundingSphere const& additional);
 		static BoundingSphere CreateFromBoundingBox(BoundingBox const& box);
 
@@ -218,11 +304,31 @@ namespace Xna {
 		ContainmentType Contains(Vector3 const& point) const;
 		bool Intersects(BoundingBox const& box) const;
 		bool Intersects(BoundingSphere const& sphere) const;
-		//bool Intersects(BoundingFrustum frustum);			//this code is not implemented in source code.
+		bool Intersects(BoundingFrustum const& frustum, CullingMode mode = CullingMode::Conservative) const;
 		PlaneIntersectionType Intersects(Plane const& plane) const;
 		double Intersects(Ray const& ray) const;
 		BoundingSphere Transform(Matrix const& matrix);
 
+		// Tests every sphere against one frustum, in parallel, setting result[i] to 1 where spheres[i] intersects it.
+		// The planes are loaded once for the whole batch. Returns the number of intersecting spheres.
+		static size_t Intersects(std::vector<BoundingSphere> const& spheres, BoundingFrustum const& frustum, std::vector<byte>& result,
+			CullingMode mode = CullingMode::Conservative);
+
+		// Moves the sphere along motion and returns the fraction of the motion, in [0, 1], at which it first touches the volume,
+		// 0 if it already does, or NaN if it does not touch it before the end of the motion.
+		// For two moving volumes, pass the motion of this sphere minus that of the other.
+		double Sweep(Vector3 const& motion, BoundingBox const& box) const;
+		double Sweep(Vector3 const& motion, BoundingSphere const& sphere) const;
+		double Sweep(Vector3 const& motion, Plane const& plane) const;
+
+		// Sweeps the pairs found by a broad phase, in parallel: result[i] is the Sweep of spheres[pairs[i].first],
+		// moving by motions[pairs[i].first], against the still boxes[pairs[i].second]. Returns the number of pairs that touch.
+		static size_t Sweep(std::vector<BoundingSphere> const& spheres, std::vector<Vector3> const& motions, std::vector<BoundingBox> const& boxes,
+			std::vector<std::pair<u32, u32>> const& pairs, std::vector<double>& result);
+		// Sweeps the pairs of spheres found by a broad phase, both moving, in parallel. Returns the number of pairs that touch.
+		static size_t Sweep(std::vector<BoundingSphere> const& spheres, std::vector<Vector3> const& motions,
+			std::vector<std::pair<u32, u32>> const& pairs, std::vector<double>& result);
+
 		void Deconstruct(Vector3& center, double& radius) const;
 		bool Equals(BoundingSphere const& other) const;
 	};
@@ -255,6 +361,10 @@ namespace Xna {
 		// index: The base index to start iterating from.
 		// count: The number of points to iterate.
 		static BoundingBox CreateFromPoints(std::vector<Vector3> const& points, i32 index = 0, i32 count = -1);
+		// Create a bounding box from count points. Large inputs are split across threads.
+		static BoundingBox CreateFromPoints(Vector3 const* points, size_t count);
+		// Create a bounding box from every point of the stream. Large inputs are split across threads.
+		static BoundingBox CreateFromPoints(Vector3Stream const& points);
 
 		// Create the enclosing BoundingBox of a BoundingSphere.
 		static BoundingBox CreateFromSphere(BoundingSphere const& sphere);
@@ -262,6 +372,11 @@ namespace Xna {
 		// Create the BoundingBox enclosing two other BoundingBox instances.
 		static BoundingBox CreateMerged(BoundingBox const& original, BoundingBox const& additional);
 
+		// Create the BoundingBox enclosing a BoundingBox over its whole motion, to insert into a broad phase.
+		static BoundingBox CreateSwept(BoundingBox const& box, Vector3 const& motion);
+		// Create the BoundingBox enclosing a BoundingSphere over its whole motion, to insert into a broad phase.
+		static BoundingBox CreateSwept(BoundingSphere const& sphere, Vector3 const& motion);
+
 		// Check if this BoundingBox contains another BoundingBox.		
 		ContainmentType Contains(BoundingBox const& box) const;
 		// Check if this BoundingBox contains a BoundingFrustum.
@@ -274,10 +389,16 @@ namespace Xna {
 		// Get an array of Vector3 containing the corners of this BoundingBox.
 		std::vector<Vector3> GetCorners() const;
 
-		// Fill the first 8 places of an array of Vector3"
-		// with the corners of this BoundingBox.
+		// Get an array of Vector3 containing the corners of this BoundingBox, allocated from the resource.
+		std::pmr::vector<Vector3> GetCorners(std::pmr::memory_resource* resource) const;
+
+		// Fill the first 8 places of an array of Vector3
+		// with the corners of this BoundingBox, growing it if needed.
 		void GetCorners(std::vector<Vector3>& corners) const;
 
+		// Fill the first 8 places of an array of Vector3 with the corners of this BoundingBox.
+		void GetCorners(Vector3* corners) const;
+
 		// Check if this BoundingBox intersects another BoundingBox.
 		bool Intersects(BoundingBox const& box) const;
 
@@ -296,6 +417,16 @@ namespace Xna {
 		// The original C# source code returns an object of type Nullable<float>
 		double Intersects(Ray ray) const;
 
+		// Moves this BoundingBox along motion and returns the fraction of the motion, in [0, 1], at which it first touches
+		// another BoundingBox, 0 if it already does, or NaN if it does not touch it before the end of the motion.
+		// For two moving boxes, pass the motion of this box minus that of the other.
+		double Sweep(Vector3 const& motion, BoundingBox const& box) const;
+
+		// Sweeps the pairs of boxes found by a broad phase, both moving, in parallel: result[i] is the Sweep of
+		// boxes[pairs[i].first] against boxes[pairs[i].second]. Returns the number of pairs that touch.
+		static size_t Sweep(std::vector<BoundingBox> const& boxes, std::vector<Vector3> const& motions,
+			std::vector<std::pair<u32, u32>> const& pairs, std::vector<double>& result);
+
 		//Deconstruction method for BoundingBox.
 		void Deconstruct(Vector3& min, Vector3& max) const;
 
@@ -305,6 +436,62 @@ namespace Xna {
 		static const Vector3 MaxVector3;
 		static const Vector3 MinVector3;
 	};
+
+	//-----------------------------------------------//
+	//-----		$ OrientedBoundingBox		-----//	
+	//-----------------------------------------------//
+
+	// A box that rotates with its object, for tighter bounds than a BoundingBox around a rotated one.
+	// The intersection tests use the separating axis theorem. The frustum test checks the frustum planes
+	// and the box axes but not their cross products, so like the BoundingFrustum tests it may report
+	// an intersection for a box just outside a frustum edge, but never misses one.
+	struct OrientedBoundingBox {
+
+		// The number of corners in an OrientedBoundingBox. This is equal to 8.
+		static constexpr i32 CornerCount = 8;
+
+		Vector3 Center;
+		// Half the size of the box along each of its axes.
+		Vector3 Extents;
+		// The rotation from the world axes to the box axes.
+		Quaternion Orientation;
+
+		OrientedBoundingBox();
+		OrientedBoundingBox(Vector3 center, Vector3 extents, Quaternion orientation);
+
+		friend bool operator ==(OrientedBoundingBox const& a, OrientedBoundingBox const& b);
+		friend bool operator !=(OrientedBoundingBox const& a, OrientedBoundingBox const& b);
+
+		// Creates the box a BoundingBox becomes when rotated and then translated.
+		static OrientedBoundingBox CreateFromBoundingBox(BoundingBox const& box, Quaternion const& rotation, Vector3 const& translation);
+		// Creates the box a BoundingBox becomes when transformed by a matrix of scale, rotation and translation.
+		static OrientedBoundingBox CreateFromBoundingBox(BoundingBox const& box, Matrix const& transform);
+
+		// Gets the unit axes of the box, the rows of Matrix::CreateFromQuaternion(Orientation).
+		void GetAxes(Vector3& x, Vector3& y, Vector3& z) const;
+		// Copies the corners to the array, resizing it to CornerCount, in the order of BoundingBox::GetCorners.
+		void GetCorners(std::vector<Vector3>& corners) const;
+		// Gets the smallest BoundingBox that contains this box.
+		BoundingBox GetBoundingBox() const;
+
+		// Containment test between this OrientedBoundingBox and specified Vector3.
+		ContainmentType Contains(Vector3 const& point) const;
+		bool Intersects(OrientedBoundingBox const& box) const;
+		bool Intersects(BoundingBox const& box) const;
+		bool Intersects(BoundingSphere const& sphere) const;
+		bool Intersects(BoundingFrustum const& frustum) const;
+		// Returns the distance along the ray to the box, 0 if the ray starts inside it, or NaN if the ray misses it.
+		double Intersects(Ray const& ray) const;
+
+		// Tests every box against one volume, in parallel, setting result[i] to 1 where boxes[i] intersects it.
+		// The volume is prepared once for the whole batch. Returns the number of intersecting boxes.
+		static size_t Intersects(std::vector<OrientedBoundingBox> const& boxes, OrientedBoundingBox const& box, std::vector<byte>& result);
+		static size_t Intersects(std::vector<OrientedBoundingBox> const& boxes, BoundingBox const& box, std::vector<byte>& result);
+		static size_t Intersects(std::vector<OrientedBoundingBox> const& boxes, BoundingSphere const& sphere, std::vector<byte>& result);
+		static size_t Intersects(std::vector<OrientedBoundingBox> const& boxes, BoundingFrustum const& frustum, std::vector<byte>& result);
+
+		bool Equals(OrientedBoundingBox const& other) const;
+	};
 }
 
 #endif
\ No newline at end of file
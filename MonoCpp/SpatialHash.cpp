@@ -0,0 +1,245 @@
+#include "Space2d.h"
+
+namespace Xna {
+
+	static constexpr u32 NoEntry = 0xffffffff;
+
+	static u64 cellKey(i32 x, i32 y) {
+		return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u32>(y);
+	}
+
+	static bool inRange(i32 value, i32 min, i32 max) {
+		return min <= value && value <= max;
+	}
+
+	SpatialHash::SpatialHash(i32 cellSize) :
+		_cellSize(cellSize < 1 ? 1 : cellSize), _freeEntries(NoEntry), _count(0), _stamp(0) {}
+
+	u32 SpatialHash::Insert(Rectangle const& bounds) {
+		u32 id;
+
+		if (!_freeItems.empty()) {
+			id = _freeItems.back();
+			_freeItems.pop_back();
+		}
+		else {
+			id = static_cast<u32>(_items.size());
+			_items.push_back(Item());
+			_stamps.push_back(0);
+		}
+
+		_items[id].Bounds = bounds;
+		_items[id].Alive = true;
+		++_count;
+
+		const CellRange cells = cellsOf(bounds);
+
+		for (i32 y = cells.MinY; y <= cells.MaxY; ++y)
+			for (i32 x = cells.MinX; x <= cells.MaxX; ++x)
+				link(id, x, y);
+
+		return id;
+	}
+
+	void SpatialHash::Move(u32 id, Rectangle const& bounds) {
+		if (!Contains(id))
+			return;
+
+		const CellRange from = cellsOf(_items[id].Bounds);
+		const CellRange to = cellsOf(bounds);
+		_items[id].Bounds = bounds;
+
+		for (i32 y = from.MinY; y <= from.MaxY; ++y)
+			for (i32 x = from.MinX; x <= from.MaxX; ++x)
+				if (!inRange(x, to.MinX, to.MaxX) || !inRange(y, to.MinY, to.MaxY))
+					unlink(id, x, y);
+
+		for (i32 y = to.MinY; y <= to.MaxY; ++y)
+			for (i32 x = to.MinX; x <= to.MaxX; ++x)
+				if (!inRange(x, from.MinX, from.MaxX) || !inRange(y, from.MinY, from.MaxY))
+					link(id, x, y);
+	}
+
+	void SpatialHash::Remove(u32 id) {
+		if (!Contains(id))
+			return;
+
+		const CellRange cells = cellsOf(_items[id].Bounds);
+
+		for (i32 y = cells.MinY; y <= cells.MaxY; ++y)
+			for (i32 x = cells.MinX; x <= cells.MaxX; ++x)
+				unlink(id, x, y);
+
+		_items[id].Alive = false;
+		_freeItems.push_back(id);
+		--_count;
+	}
+
+	bool SpatialHash::Contains(u32 id) const {
+		return id < _items.size() && _items[id].Alive;
+	}
+
+	Rectangle SpatialHash::Bounds(u32 id) const {
+		return Contains(id) ? _items[id].Bounds : Rectangle();
+	}
+
+	size_t SpatialHash::Count() const {
+		return _count;
+	}
+
+	void SpatialHash::Clear() {
+		_items.clear();
+		_freeItems.clear();
+		_entries.clear();
+		_freeEntries = NoEntry;
+		_cells.clear();
+		_stamps.clear();
+		_stamp = 0;
+		_count = 0;
+	}
+
+	void SpatialHash::Query(Rectangle const& region, std::vector<u32>& result) const {
+		const CellRange cells = cellsOf(region);
+		const u32 stamp = nextStamp();
+
+		for (i32 y = cells.MinY; y <= cells.MaxY; ++y) {
+			for (i32 x = cells.MinX; x <= cells.MaxX; ++x) {
+				auto found = _cells.find(cellKey(x, y));
+
+				if (found == _cells.end())
+					continue;
+
+				for (u32 e = found->second; e != NoEntry; e = _entries[e].Next) {
+					const u32 id = _entries[e].Item;
+
+					if (_stamps[id] == stamp)
+						continue;
+
+					_stamps[id] = stamp;
+
+					if (_items[id].Bounds.Intersects(region))
+						result.push_back(id);
+				}
+			}
+		}
+	}
+
+	void SpatialHash::Query(Point const& point, std::vector<u32>& result) const {
+		auto found = _cells.find(cellKey(cell(point.X), cell(point.Y)));
+
+		if (found == _cells.end())
+			return;
+
+		// An item is linked once per cell, so no stamps are needed.
+		for (u32 e = found->second; e != NoEntry; e = _entries[e].Next) {
+			const u32 id = _entries[e].Item;
+
+			if (_items[id].Bounds.Contains(point))
+				result.push_back(id);
+		}
+	}
+
+	void SpatialHash::Query(Vector2 const& point, std::vector<u32>& result) const {
+		Query(Point(static_cast<i32>(point.X), static_cast<i32>(point.Y)), result);
+	}
+
+	void SpatialHash::QueryPairs(std::vector<std::pair<u32, u32>>& result) const {
+		for (auto const& c : _cells) {
+			const i32 cx = static_cast<i32>(static_cast<u32>(c.first >> 32));
+			const i32 cy = static_cast<i32>(static_cast<u32>(c.first));
+
+			for (u32 a = c.second; a != NoEntry; a = _entries[a].Next) {
+				Rectangle const& first = _items[_entries[a].Item].Bounds;
+
+				for (u32 b = _entries[a].Next; b != NoEntry; b = _entries[b].Next) {
+					Rectangle const& second = _items[_entries[b].Item].Bounds;
+
+					if (!first.Intersects(second))
+						continue;
+
+					// Items sharing several cells meet in each of them; only the cell holding the
+					// top-left corner of their overlap reports the pair.
+					const i32 left = first.X > second.X ? first.X : second.X;
+					const i32 top = first.Y > second.Y ? first.Y : second.Y;
+
+					if (cell(left) != cx || cell(top) != cy)
+						continue;
+
+					const u32 i = _entries[a].Item;
+					const u32 j = _entries[b].Item;
+					result.push_back(i < j ? std::make_pair(i, j) : std::make_pair(j, i));
+				}
+			}
+		}
+	}
+
+	// Private
+
+	i32 SpatialHash::cell(i32 coordinate) const {
+		// Rounds toward negative infinity so cells keep their size across zero.
+		i32 q = coordinate / _cellSize;
+
+		if (coordinate % _cellSize != 0 && coordinate < 0)
+			--q;
+
+		return q;
+	}
+
+	SpatialHash::CellRange SpatialHash::cellsOf(Rectangle const& bounds) const {
+		// The right and bottom edges are exclusive; empty rectangles still occupy their corner cell.
+		const i32 right = bounds.Width > 0 ? bounds.Right() - 1 : bounds.X;
+		const i32 bottom = bounds.Height > 0 ? bounds.Bottom() - 1 : bounds.Y;
+
+		return CellRange{ cell(bounds.X), cell(bounds.Y), cell(right), cell(bottom) };
+	}
+
+	void SpatialHash::link(u32 id, i32 x, i32 y) {
+		u32 e;
+
+		if (_freeEntries != NoEntry) {
+			e = _freeEntries;
+			_freeEntries = _entries[e].Next;
+		}
+		else {
+			e = static_cast<u32>(_entries.size());
+			_entries.push_back(Entry());
+		}
+
+		auto inserted = _cells.emplace(cellKey(x, y), NoEntry).first;
+		_entries[e].Item = id;
+		_entries[e].Next = inserted->second;
+		inserted->second = e;
+	}
+
+	void SpatialHash::unlink(u32 id, i32 x, i32 y) {
+		auto found = _cells.find(cellKey(x, y));
+
+		if (found == _cells.end())
+			return;
+
+		u32* link = &found->second;
+
+		while (*link != NoEntry && _entries[*link].Item != id)
+			link = &_entries[*link].Next;
+
+		if (*link == NoEntry)
+			return;
+
+		const u32 e = *link;
+		*link = _entries[e].Next;
+		_entries[e].Next = _freeEntries;
+		_freeEntries = e;
+
+		if (found->second == NoEntry)
+			_cells.erase(found);
+	}
+
+	u32 SpatialHash::nextStamp() const {
+		if (++_stamp == 0) {
+			std::fill(_stamps.begin(), _stamps.end(), 0);
+			_stamp = 1;
+		}
+
+		return _stamp;
+	}
+}
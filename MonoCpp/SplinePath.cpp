@@ -0,0 +1,198 @@
+#include <algorithm>
+#include <cmath>
+#include "SplinePath.h"
+#include "Parallel.h"
+
+namespace Xna {
+
+	// Chords a hint may be off by before the search falls back to bisection.
+	static constexpr u32 HintSteps = 4;
+
+	static Vector3 tangentOf(std::vector<Vector3> const& points, size_t index) {
+		const size_t last = points.size() - 1;
+		const Vector3& previous = points[index > 0 ? index - 1 : 0];
+		const Vector3& next = points[index < last ? index + 1 : last];
+
+		return (next - previous) * 0.5;
+	}
+
+	SplinePath::SplinePath() :
+		_distances(1, 0.0), _samplesPerSegment(1) {}
+
+	SplinePath::SplinePath(std::vector<Vector3> const& points, size_t samplesPerSegment) {
+		build(points, std::vector<Vector3>(), samplesPerSegment);
+	}
+
+	SplinePath::SplinePath(std::vector<Vector3> const& points, std::vector<Vector3> const& tangents, size_t samplesPerSegment) {
+		build(points, tangents, samplesPerSegment);
+	}
+
+	double SplinePath::Length() const {
+		return _distances.back();
+	}
+
+	size_t SplinePath::SegmentCount() const {
+		return _segments.size();
+	}
+
+	Vector3 SplinePath::PositionAt(double distance) const {
+		u32 hint = 0;
+		return PositionAt(distance, hint);
+	}
+
+	Vector3 SplinePath::PositionAt(double distance, u32& hint) const {
+		if (_segments.empty())
+			return Vector3(0);
+
+		size_t segment;
+		double t;
+		parameterOf(distance, hint, segment, t);
+
+		Segment const& s = _segments[segment];
+		return ((s.A * t + s.B) * t + s.C) * t + s.D;
+	}
+
+	Vector3 SplinePath::TangentAt(double distance) const {
+		u32 hint = 0;
+		return TangentAt(distance, hint);
+	}
+
+	Vector3 SplinePath::TangentAt(double distance, u32& hint) const {
+		if (_segments.empty())
+			return Vector3(0);
+
+		size_t segment;
+		double t;
+		parameterOf(distance, hint, segment, t);
+
+		Segment const& s = _segments[segment];
+		const Vector3 derivative = (s.A * (3 * t) + s.B * 2) * t + s.C;
+		const double length = derivative.Length();
+
+		return length > 0 ? derivative / length : Vector3(0);
+	}
+
+	void SplinePath::Sample(SplinePath const& path, std::vector<double> const& distances, std::vector<u32>& hints,
+		Vector3Stream& positions, Vector3Stream& tangents) {
+
+		const size_t count = distances.size();
+		hints.resize(count, 0);
+		positions.Resize(count);
+		tangents.Resize(count);
+
+		if (path._segments.empty()) {
+			std::fill(positions.X.begin(), positions.X.end(), 0.0);
+			std::fill(positions.Y.begin(), positions.Y.end(), 0.0);
+			std::fill(positions.Z.begin(), positions.Z.end(), 0.0);
+			std::fill(tangents.X.begin(), tangents.X.end(), 0.0);
+			std::fill(tangents.Y.begin(), tangents.Y.end(), 0.0);
+			std::fill(tangents.Z.begin(), tangents.Z.end(), 0.0);
+			return;
+		}
+
+		Parallel::For(count, Parallel::DefaultChunkSize, [&](size_t, size_t begin, size_t end) {
+			for (size_t i = begin; i < end; ++i) {
+				size_t segment;
+				double t;
+				path.parameterOf(distances[i], hints[i], segment, t);
+
+				// Position and derivative share the segment lookup.
+				Segment const& s = path._segments[segment];
+				const Vector3 position = ((s.A * t + s.B) * t + s.C) * t + s.D;
+				const Vector3 derivative = (s.A * (3 * t) + s.B * 2) * t + s.C;
+				const double length = derivative.Length();
+				const double scale = length > 0 ? 1.0 / length : 0.0;
+
+				positions.X[i] = position.X;
+				positions.Y[i] = position.Y;
+				positions.Z[i] = position.Z;
+				tangents.X[i] = derivative.X * scale;
+				tangents.Y[i] = derivative.Y * scale;
+				tangents.Z[i] = derivative.Z * scale;
+			}
+		});
+	}
+
+	// Private
+
+	void SplinePath::build(std::vector<Vector3> const& points, std::vector<Vector3> const& tangents, size_t samplesPerSegment) {
+		_samplesPerSegment = samplesPerSegment > 0 ? samplesPerSegment : 1;
+		_segments.clear();
+		_distances.assign(1, 0.0);
+
+		if (points.empty())
+			return;
+
+		// A single point is a segment of length zero.
+		const size_t segmentCount = points.size() > 1 ? points.size() - 1 : 1;
+		const size_t last = points.size() - 1;
+		_segments.resize(segmentCount);
+
+		for (size_t i = 0; i < segmentCount; ++i) {
+			const Vector3& p0 = points[i < last ? i : last];
+			const Vector3& p1 = points[i + 1 < last ? i + 1 : last];
+			const Vector3 m0 = i < tangents.size() ? tangents[i] : tangentOf(points, i < last ? i : last);
+			const Vector3 m1 = i + 1 < tangents.size() ? tangents[i + 1] : tangentOf(points, i + 1 < last ? i + 1 : last);
+
+			// The Hermite basis of MathHelper::Hermite, collected by powers of t.
+			_segments[i].A = p0 * 2 - p1 * 2 + m0 + m1;
+			_segments[i].B = p1 * 3 - p0 * 3 - m0 * 2 - m1;
+			_segments[i].C = m0;
+			_segments[i].D = p0;
+		}
+
+		_distances.reserve(segmentCount * _samplesPerSegment + 1);
+		double length = 0;
+
+		for (size_t i = 0; i < segmentCount; ++i) {
+			Segment const& s = _segments[i];
+			Vector3 previous = s.D;
+
+			for (size_t k = 1; k <= _samplesPerSegment; ++k) {
+				const double t = static_cast<double>(k) / _samplesPerSegment;
+				const Vector3 point = ((s.A * t + s.B) * t + s.C) * t + s.D;
+
+				length += Vector3::Distance(previous, point);
+				_distances.push_back(length);
+				previous = point;
+			}
+		}
+	}
+
+	u32 SplinePath::locate(double distance, u32 hint) const {
+		const u32 last = static_cast<u32>(_distances.size() - 2);
+
+		if (hint > last)
+			hint = 0;
+
+		// Followers usually move less than a chord per query, so the hint is close.
+		if (_distances[hint] <= distance) {
+			for (u32 step = 0; step < HintSteps; ++step, ++hint) {
+				if (hint == last || distance <= _distances[hint + 1])
+					return hint;
+			}
+		}
+		else {
+			for (u32 step = 0; step < HintSteps && hint > 0; ++step) {
+				if (_distances[--hint] <= distance)
+					return hint;
+			}
+		}
+
+		const size_t found = std::upper_bound(_distances.begin(), _distances.end(), distance) - _distances.begin();
+		return found == 0 ? 0 : (found - 1 > last ? last : static_cast<u32>(found - 1));
+	}
+
+	void SplinePath::parameterOf(double distance, u32& hint, size_t& segment, double& amount) const {
+		const double length = _distances.back();
+		distance = distance > 0 ? (distance < length ? distance : length) : 0.0;
+
+		const u32 chord = locate(distance, hint);
+		const double span = _distances[chord + 1] - _distances[chord];
+		const double fraction = span > 0 ? (distance - _distances[chord]) / span : 0.0;
+
+		hint = chord;
+		segment = chord / _samplesPerSegment;
+		amount = ((chord % _samplesPerSegment) + fraction) / _samplesPerSegment;
+	}
+}
@@ -0,0 +1,67 @@
+#ifndef SPLINEPATH_H
+#define SPLINEPATH_H
+
+#include <vector>
+#include "CSharp.h"
+#include "Structs.h"
+#include "Streams.h"
+
+namespace Xna {
+
+	// A smooth path through points, sampled by distance along it so followers move at constant speed.
+	// Each segment is a cubic Hermite curve as in Vector3::Hermite; without explicit tangents the path is
+	// the Catmull-Rom spline of Vector3::CatmullRom, with the end points repeated to close the ends.
+	// The arc length is tabulated once at construction, samplesPerSegment chords per segment, and a query
+	// finds its chord by binary search, or in a step or two from a hint left by the previous query.
+	// Distances outside [0, Length()] are clamped. The path is immutable and safe to sample from many threads.
+	struct SplinePath {
+
+		SplinePath();
+		// Creates the Catmull-Rom path through points.
+		SplinePath(std::vector<Vector3> const& points, size_t samplesPerSegment = 16);
+		// Creates the Hermite path through points with a tangent at each point.
+		// Points without a tangent get the Catmull-Rom one.
+		SplinePath(std::vector<Vector3> const& points, std::vector<Vector3> const& tangents, size_t samplesPerSegment = 16);
+
+		// Returns the length of the path.
+		double Length() const;
+		// Returns the number of segments, one less than the number of points. A single point makes one segment of length zero.
+		size_t SegmentCount() const;
+
+		// Gets the position at a distance along the path.
+		Vector3 PositionAt(double distance) const;
+		// Gets the position at a distance along the path, starting the search at hint and updating it.
+		// A hint of 0 is always valid; keep one per follower.
+		Vector3 PositionAt(double distance, u32& hint) const;
+		// Gets the unit direction of the path at a distance along it, or zero where the path stops.
+		Vector3 TangentAt(double distance) const;
+		Vector3 TangentAt(double distance, u32& hint) const;
+
+		// Samples the position and direction of many followers at once, in parallel.
+		// hints: one per follower, kept from call to call. Resized to the number of distances; new hints are 0.
+		static void Sample(SplinePath const& path, std::vector<double> const& distances, std::vector<u32>& hints,
+			Vector3Stream& positions, Vector3Stream& tangents);
+
+	private:
+		// The cubic A t^3 + B t^2 + C t + D of a segment, for t in [0, 1].
+		struct Segment {
+			Vector3 A;
+			Vector3 B;
+			Vector3 C;
+			Vector3 D;
+		};
+
+		std::vector<Segment> _segments;
+		// The distance along the path of each chord end, samplesPerSegment per segment plus the last point.
+		std::vector<double> _distances;
+		size_t _samplesPerSegment;
+
+		void build(std::vector<Vector3> const& points, std::vector<Vector3> const& tangents, size_t samplesPerSegment);
+		// Returns the chord that holds distance, which must be in range.
+		u32 locate(double distance, u32 hint) const;
+		// Converts a distance to a segment and a parameter on it.
+		void parameterOf(double distance, u32& hint, size_t& segment, double& amount) const;
+	};
+}
+
+#endif
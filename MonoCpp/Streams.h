@@ -0,0 +1,199 @@
+#ifndef STREAMS_H
+#define STREAMS_H
+
+#include <vector>
+#include "Structs.h"
+#include "CSharp.h"
+
+namespace Xna {
+
+	// Structure-of-arrays containers for batch math.
+	// Each component lives in its own contiguous array so the kernels below
+	// run as straight loops over doubles that the compiler can vectorize.
+	// All kernels process the smallest count of their input streams and resize
+	// the result stream to that count. The result may be one of the inputs.
+
+	// The count a kernel processes for two input lengths.
+	inline size_t minCount(size_t a, size_t b) {
+		return a < b ? a : b;
+	}
+
+	//-----------------------------------//
+	//-----		$ VECTOR3STREAM		-----//
+	//-----------------------------------//
+
+	struct Vector3Stream {
+		std::vector<double> X;
+		std::vector<double> Y;
+		std::vector<double> Z;
+
+		Vector3Stream();
+		// Creates a stream with count vectors set to zero.
+		Vector3Stream(size_t count);
+		// Creates a stream from an array of Vector3.
+		Vector3Stream(std::vector<Vector3> const& values);
+
+		// Returns the number of vectors in the stream.
+		size_t Count() const;
+		// Changes the number of vectors in the stream.
+		void Resize(size_t count);
+		// Gets the vector at index.
+		Vector3 Get(size_t index) const;
+		// Sets the vector at index.
+		void Set(size_t index, Vector3 const& value);
+		// Copies the stream to an array of Vector3, resizing the destination.
+		void CopyTo(std::vector<Vector3>& destinationArray) const;
+	};
+
+	//-----------------------------------//
+	//-----		$ QUATERNIONSTREAM	-----//
+	//-----------------------------------//
+
+	struct QuaternionStream {
+		std::vector<double> X;
+		std::vector<double> Y;
+		std::vector<double> Z;
+		std::vector<double> W;
+
+		QuaternionStream();
+		// Creates a stream with count quaternions set to zero.
+		QuaternionStream(size_t count);
+		// Creates a stream from an array of Quaternion.
+		QuaternionStream(std::vector<Quaternion> const& values);
+
+		// Returns the number of quaternions in the stream.
+		size_t Count() const;
+		// Changes the number of quaternions in the stream.
+		void Resize(size_t count);
+		// Gets the quaternion at index.
+		Quaternion Get(size_t index) const;
+		// Sets the quaternion at index.
+		void Set(size_t index, Quaternion const& value);
+		// Copies the stream to an array of Quaternion, resizing the destination.
+		void CopyTo(std::vector<Quaternion>& destinationArray) const;
+
+		// Batch version of Quaternion::Multiply(Quaternion, Quaternion).
+		static void Multiply(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, QuaternionStream& result);
+		// Multiplies every quaternion of the stream by the same quaternion.
+		static void Multiply(QuaternionStream const& quaternion1, Quaternion const& quaternion2, QuaternionStream& result);
+		// Batch version of Quaternion::Normalize(Quaternion).
+		static void Normalize(QuaternionStream const& quaternion, QuaternionStream& result);
+		// Batch version of Quaternion::Lerp (normalized linear interpolation) with one amount for all pairs.
+		static void Lerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, double amount, QuaternionStream& result);
+		// Batch version of Quaternion::Lerp (normalized linear interpolation) with one amount per pair.
+		static void Lerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, std::vector<double> const& amounts, QuaternionStream& result);
+		// Batch version of Quaternion::Slerp with one amount for all pairs.
+		static void Slerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, double amount, QuaternionStream& result);
+		// Batch version of Quaternion::Slerp with one amount per pair.
+		static void Slerp(QuaternionStream const& quaternion1, QuaternionStream const& quaternion2, std::vector<double> const& amounts, QuaternionStream& result);
+		// Batch version of Vector3::Transform(Vector3, Quaternion), rotating each vector by the quaternion at the same index.
+		static void Transform(Vector3Stream const& values, QuaternionStream const& rotations, Vector3Stream& result);
+		// Batch version of Vector3::Transform(Vector3, Quaternion), rotating every vector by the same quaternion.
+		static void Transform(Vector3Stream const& values, Quaternion const& rotation, Vector3Stream& result);
+	};
+
+	//-----------------------------------//
+	//-----		$ TRANSFORMSTREAM	-----//
+	//-----------------------------------//
+
+	// A transform quantized for network snapshots, 28 bytes instead of the 80 of its doubles.
+	// Translation and scale are fixed-point multiples of the steps given to TransformStream::Quantize
+	// and are off by at most half a step. The rotation is stored with W >= 0 and each component
+	// scaled to [-32767, 32767], off by at most 1/65534 per component before renormalization.
+	// Values out of the fixed-point range are clamped.
+	struct QuantizedTransform {
+		i32 TranslationX;
+		i32 TranslationY;
+		i32 TranslationZ;
+		i16 RotationX;
+		i16 RotationY;
+		i16 RotationZ;
+		i16 RotationW;
+		i16 ScaleX;
+		i16 ScaleY;
+		i16 ScaleZ;
+	};
+
+	// Scale, rotation and translation of many transforms, the decomposed form of a world matrix.
+	struct TransformStream {
+		Vector3Stream Scale;
+		QuaternionStream Rotation;
+		Vector3Stream Translation;
+
+		TransformStream();
+		// Creates a stream with count transforms set to zero.
+		TransformStream(size_t count);
+
+		// Returns the number of transforms in the stream.
+		size_t Count() const;
+		// Changes the number of transforms in the stream.
+		void Resize(size_t count);
+
+		// Batch version of Matrix::Decompose, with the same sign conventions.
+		// Matrices with a zero scale get an identity rotation; returns how many there were.
+		static size_t Decompose(std::vector<Matrix> const& matrices, TransformStream& result);
+		// Builds Matrix::CreateScale(scale) * Matrix::CreateFromQuaternion(rotation) * Matrix::CreateTranslation(translation)
+		// for each transform, writing the nonzero terms directly instead of multiplying matrices.
+		static void Compose(TransformStream const& transforms, std::vector<Matrix>& result);
+		// Composes only the transforms whose dirty flag is set and clears the flags; returns how many were composed.
+		// Flags missing at the end of the dirty array count as set.
+		static size_t Compose(TransformStream const& transforms, std::vector<byte>& dirty, std::vector<Matrix>& result);
+
+		// Quantizes each transform, with translationStep and scaleStep the fixed-point resolution of translation and scale.
+		static void Quantize(TransformStream const& transforms, double translationStep, double scaleStep, std::vector<QuantizedTransform>& result);
+		// Restores the transforms written by Quantize with the same steps. Rotations are renormalized.
+		static void Dequantize(std::vector<QuantizedTransform> const& quantized, double translationStep, double scaleStep, TransformStream& result);
+	};
+
+	//-----------------------------------//
+	//-----		$ RECTANGLESTREAM	-----//
+	//-----------------------------------//
+
+	// Rectangles for UI layout and dirty-region tracking, tested against one rectangle or point at a time.
+	// The kernels use the same edge rules as Rectangle: right and bottom edges are exclusive.
+	struct RectangleStream {
+		std::vector<i32> X;
+		std::vector<i32> Y;
+		std::vector<i32> Width;
+		std::vector<i32> Height;
+
+		RectangleStream();
+		// Creates a stream with count empty rectangles.
+		RectangleStream(size_t count);
+		// Creates a stream from an array of Rectangle.
+		RectangleStream(std::vector<Rectangle> const& values);
+
+		// Returns the number of rectangles in the stream.
+		size_t Count() const;
+		// Changes the number of rectangles in the stream.
+		void Resize(size_t count);
+		// Allocates room for count rectangles, so adding up to that many does not allocate.
+		void Reserve(size_t count);
+		// Gets the rectangle at index.
+		Rectangle Get(size_t index) const;
+		// Sets the rectangle at index.
+		void Set(size_t index, Rectangle const& value);
+		// Adds a rectangle at the end of the stream.
+		void Add(Rectangle const& value);
+		// Copies the stream to an array of Rectangle, resizing the destination.
+		void CopyTo(std::vector<Rectangle>& destinationArray) const;
+
+		// Batch version of Rectangle::Intersects(Rectangle): sets result[i] to 1 where the rectangle
+		// intersects value and to 0 elsewhere, and returns how many intersect.
+		static size_t Intersects(RectangleStream const& rectangles, Rectangle const& value, std::vector<byte>& result);
+		// Batch version of Rectangle::Contains(Point): sets result[i] to 1 where the rectangle
+		// contains the point and to 0 elsewhere, and returns how many contain it.
+		static size_t Contains(RectangleStream const& rectangles, Point const& value, std::vector<byte>& result);
+		// Batch version of Rectangle::Intersects(Rectangle, Rectangle) against one viewport.
+		// Rectangles outside the viewport become Rectangle::Empty().
+		static void Clip(RectangleStream const& rectangles, Rectangle const& viewport, RectangleStream& result);
+		// Returns the union of all the rectangles, as folding Rectangle::Union over the stream,
+		// or Rectangle::Empty() for an empty stream.
+		static Rectangle Union(RectangleStream const& rectangles);
+		// Merges intersecting rectangles into their union until none intersect, so the result covers every
+		// input pixel with no pixel covered twice. Rectangles without area are dropped.
+		static void Merge(RectangleStream const& rectangles, RectangleStream& result);
+	};
+}
+
+#endif
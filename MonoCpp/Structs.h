@@ -1,14 +1,17 @@
 #ifndef VECTORS_H
 #define VECTORS_H
 
+#include <memory_resource>
 #include <vector>
 #include "CSharp.h"
+#include "MathHelper.h"
 
 namespace Xna {	
 
 	struct Point;
 	struct Quaternion;
 	struct Matrix;
+	struct AffineMatrix;
 	struct Plane;
 	
 	//-------------------------------//
@@ -19,69 +22,73 @@ namespace Xna {
 		double X;
 		double Y;
 
-		Vector2();
-		Vector2(double x, double y);
-		Vector2(double value);
-
-		Vector2 operator- ();
-		friend Vector2 operator+ (Vector2, Vector2);
-		friend Vector2 operator- (Vector2, Vector2);
-		friend Vector2 operator* (Vector2, Vector2);
-		friend Vector2 operator* (Vector2, double);
-		friend Vector2 operator* (double, Vector2);
-		friend Vector2 operator/ (Vector2, Vector2);
-		friend Vector2 operator/ (Vector2, double);
-		friend Vector2 operator== (Vector2, Vector2);
-		friend Vector2 operator!= (Vector2, Vector2);
-
-		static Vector2 Zero();
-		static Vector2 One();
-		static Vector2 UnitX();
-		static Vector2 UnitY();
-
-		static Vector2 Add(Vector2 const& value1, Vector2 const& value2);
+		constexpr Vector2();
+		constexpr Vector2(double x, double y);
+		constexpr Vector2(double value);
+
+		constexpr Vector2 operator- ();
+		friend constexpr Vector2 operator+ (Vector2, Vector2);
+		friend constexpr Vector2 operator- (Vector2, Vector2);
+		friend constexpr Vector2 operator* (Vector2, Vector2);
+		friend constexpr Vector2 operator* (Vector2, double);
+		friend constexpr Vector2 operator* (double, Vector2);
+		friend constexpr Vector2 operator/ (Vector2, Vector2);
+		friend constexpr Vector2 operator/ (Vector2, double);
+		friend constexpr bool operator== (Vector2, Vector2);
+		friend constexpr bool operator!= (Vector2, Vector2);
+
+		static constexpr Vector2 Zero();
+		static constexpr Vector2 One();
+		static constexpr Vector2 UnitX();
+		static constexpr Vector2 UnitY();
+
+		static constexpr Vector2 Add(Vector2 const& value1, Vector2 const& value2);
 		static Vector2 Barycentric(Vector2 const& value1, Vector2 const& value2, Vector2 const& value3, double amount1, double amount2);
 		static Vector2 CatmullRom(Vector2 const& value1, Vector2 const& value2, Vector2 const& value3, Vector2 const& value4, double amount);
 		static Vector2 Ceiling(Vector2 const& value);
-		static Vector2 Clamp(Vector2 const& value1, Vector2 const& value2, Vector2 const& value3);
+		static constexpr Vector2 Clamp(Vector2 const& value1, Vector2 const& value2, Vector2 const& value3);
 		static double Distance(Vector2 const& value1, Vector2 const& value2);
-		static double DistanceSquared(Vector2 const& value1, Vector2 const& value2);
-		static Vector2 Divide(Vector2 const& value1, Vector2 const& value2);
-		static Vector2 Divide(Vector2 const& value, double divider);
-		static double Dot(Vector2 const& value1, Vector2 const& value2);
+		static double Distance(Vector2 const& value1, Vector2 const& value2, MathPrecision precision);
+		static constexpr double DistanceSquared(Vector2 const& value1, Vector2 const& value2);
+		static constexpr Vector2 Divide(Vector2 const& value1, Vector2 const& value2);
+		static constexpr Vector2 Divide(Vector2 const& value, double divider);
+		static constexpr double Dot(Vector2 const& value1, Vector2 const& value2);
 		static Vector2 Floor(Vector2 const& value);
 		static Vector2 Hermite(Vector2 const& value1, Vector2 const& tangent1, Vector2 const& value2, Vector2 const& tangent2, double amount);
-		static Vector2 Lerp(Vector2 const& value1, Vector2 const& value2, double amount);
-		static Vector2 LerpPrecise(Vector2 const& value1, Vector2 const& value2, double amount);
-		static Vector2 Max(Vector2 const& value1, Vector2 const& value2);
-		static Vector2 Min(Vector2 const& value1, Vector2 const& value2);
-		static Vector2 Multiply(Vector2 const& value1, Vector2 const& value2);
-		static Vector2 Multiply(Vector2 const& value, double scaleFactor);
-		static Vector2 Negate(Vector2 const& value);
+		static constexpr Vector2 Lerp(Vector2 const& value1, Vector2 const& value2, double amount);
+		static constexpr Vector2 LerpPrecise(Vector2 const& value1, Vector2 const& value2, double amount);
+		static constexpr Vector2 Max(Vector2 const& value1, Vector2 const& value2);
+		static constexpr Vector2 Min(Vector2 const& value1, Vector2 const& value2);
+		static constexpr Vector2 Multiply(Vector2 const& value1, Vector2 const& value2);
+		static constexpr Vector2 Multiply(Vector2 const& value, double scaleFactor);
+		static constexpr Vector2 Negate(Vector2 const& value);
 		static Vector2 Normalize(Vector2 const& value);
+		static Vector2 Normalize(Vector2 const& value, MathPrecision precision);
 		static Vector2 Reflect(Vector2 const& value1, Vector2 const& value2);
 		static Vector2 Round(Vector2 const& value);
 		static Vector2 SmoothStep(Vector2 const& value1, Vector2 const& value2, double amount);
-		static Vector2 Subtract(Vector2 const& value1, Vector2 const& value2);
+		static constexpr Vector2 Subtract(Vector2 const& value1, Vector2 const& value2);
 		static Vector2 Transform(Vector2 const& position, Matrix const& matrix);
 		static Vector2 Transform(Vector2 const& value, Quaternion const& rotation);
-		static void Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2> destinationArray, size_t destinationIndex, size_t length);
-		static void Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Quaternion const& rotation, std::vector<Vector2> destinationArray, size_t destinationIndex, size_t length);
-		static void Transform(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2> destinationArray);
-		static void Transform(std::vector<Vector2> const& sourceArray, Quaternion const& rotation, std::vector<Vector2> destinationArray);
+		static void Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Quaternion const& rotation, std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		// The whole-array overloads resize the destination to the source.
+		static void Transform(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2>& destinationArray);
+		static void Transform(std::vector<Vector2> const& sourceArray, Quaternion const& rotation, std::vector<Vector2>& destinationArray);
 		static Vector2 TransformNormal(Vector2 const& normal, Matrix const& matrix);
-		static void TransformNormal(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2> destinationArray, size_t destinationIndex, size_t length);
-		static void TransformNormal(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2> destinationArray);
+		static void TransformNormal(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length);
+		static void TransformNormal(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2>& destinationArray);
 
 		void Ceiling();
 		void Floor();
 		double Length() const;
-		double LengthSquared() const;
+		double Length(MathPrecision precision) const;
+		constexpr double LengthSquared() const;
 		void Normalize();
 		void Round();
 		Point ToPoint() const;
 		void Deconstruct(double&, double&) const;
-		bool Equals(Vector2 const& other) const;
+		constexpr bool Equals(Vector2 const& other) const;
 	};
 
 	//-------------------------------//
@@ -93,58 +100,60 @@ namespace Xna {
 		double Y;
 		double Z;
 
-		Vector3();
-		Vector3(double x, double y, double z);
-		Vector3(double value);
-		Vector3(Vector2 value, double z);
+		constexpr Vector3();
+		constexpr Vector3(double x, double y, double z);
+		constexpr Vector3(double value);
+		constexpr Vector3(Vector2 value, double z);
 
-		Vector3 operator- () const;
+		constexpr Vector3 operator- () const;
 
-		friend Vector3 operator- (Vector3, Vector3);
-		friend Vector3 operator+ (Vector3, Vector3);
-		friend Vector3 operator* (Vector3, Vector3);
-		friend Vector3 operator* (Vector3, double);
-		friend Vector3 operator* (double, Vector3);
-		friend Vector3 operator/ (Vector3, Vector3);
-		friend Vector3 operator/ (Vector3, double);
-		friend bool operator== (Vector3, Vector3);
-		friend bool operator!= (Vector3, Vector3);
+		friend constexpr Vector3 operator- (Vector3, Vector3);
+		friend constexpr Vector3 operator+ (Vector3, Vector3);
+		friend constexpr Vector3 operator* (Vector3, Vector3);
+		friend constexpr Vector3 operator* (Vector3, double);
+		friend constexpr Vector3 operator* (double, Vector3);
+		friend constexpr Vector3 operator/ (Vector3, Vector3);
+		friend constexpr Vector3 operator/ (Vector3, double);
+		friend constexpr bool operator== (Vector3, Vector3);
+		friend constexpr bool operator!= (Vector3, Vector3);
 
 		// Returns a <see cref="Vector4"/> with components 0, 0, 0, 0.
-		static Vector3 Zero();
-		static Vector3 One();
-		static Vector3 UnitX();
-		static Vector3 UnitY();
-		static Vector3 UnitZ();
-		static Vector3 Up();
-		static Vector3 Down();
-		static Vector3 Right();
-		static Vector3 Left();
-		static Vector3 Forward();
-		static Vector3 Backward();
-
-		static Vector3 Add(Vector3 const& value1, Vector3 const& value2);
-		static Vector3 Divide(Vector3 const& value1, Vector3 const& value2);
-		static Vector3 Divide(Vector3 const& value1, double divider);
-		static Vector3 Subtract(Vector3 const& value1, Vector3 const& value2);
-		static Vector3 Multiply(Vector3 const& value1, Vector3 const& value2);
-		static Vector3 Multiply(Vector3 const& value1, double scaleFactor);
+		static constexpr Vector3 Zero();
+		static constexpr Vector3 One();
+		static constexpr Vector3 UnitX();
+		static constexpr Vector3 UnitY();
+		static constexpr Vector3 UnitZ();
+		static constexpr Vector3 Up();
+		static constexpr Vector3 Down();
+		static constexpr Vector3 Right();
+		static constexpr Vector3 Left();
+		static constexpr Vector3 Forward();
+		static constexpr Vector3 Backward();
+
+		static constexpr Vector3 Add(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Divide(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Divide(Vector3 const& value1, double divider);
+		static constexpr Vector3 Subtract(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Multiply(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Multiply(Vector3 const& value1, double scaleFactor);
 		static Vector3 Barycentric(Vector3 const& value1, Vector3 const& value2, Vector3 const& value3, double amount1, double amount2);
 		static Vector3 CatmullRom(Vector3 const& value1, Vector3 const& value2, Vector3 const& value3, Vector3 const& value4, double amount);
 		static Vector3 Ceiling(Vector3 const& value);
-		static Vector3 Clamp(Vector3 const& value1, Vector3 const& min, Vector3 const& max);
-		static Vector3 Cross(Vector3 const& value1, Vector3 const& value2);
-		static double Dot(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Clamp(Vector3 const& value1, Vector3 const& min, Vector3 const& max);
+		static constexpr Vector3 Cross(Vector3 const& value1, Vector3 const& value2);
+		static constexpr double Dot(Vector3 const& value1, Vector3 const& value2);
 		static double Distance(Vector3 const& value1, Vector3 const& value2);
-		static double DistanceSquared(Vector3 const& value1, Vector3 const& value2);
+		static double Distance(Vector3 const& value1, Vector3 const& value2, MathPrecision precision);
+		static constexpr double DistanceSquared(Vector3 const& value1, Vector3 const& value2);
 		static Vector3 Floor(Vector3 const& value);
 		static Vector3 Hermite(Vector3 const& value1, Vector3 const& tangent1, Vector3 const& value2, Vector3 const& tangent2, double amount);
 		static Vector3 Normalize(Vector3 const& value);
-		static Vector3 Lerp(Vector3 const& value1, Vector3 const& value2, double amount);
-		static Vector3 LerpPrecise(Vector3 const& value1, Vector3 const& value2, double amount);
-		static Vector3 Max(Vector3 const& value1, Vector3 const& value2);
-		static Vector3 Min(Vector3 const& value1, Vector3 const& value2);
-		static Vector3 Negate(Vector3 const& value);
+		static Vector3 Normalize(Vector3 const& value, MathPrecision precision);
+		static constexpr Vector3 Lerp(Vector3 const& value1, Vector3 const& value2, double amount);
+		static constexpr Vector3 LerpPrecise(Vector3 const& value1, Vector3 const& value2, double amount);
+		static constexpr Vector3 Max(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Min(Vector3 const& value1, Vector3 const& value2);
+		static constexpr Vector3 Negate(Vector3 const& value);
 		static Vector3 Reflect(Vector3 const& vector, Vector3 const& normal);
 		static Vector3 Round(Vector3 const& value);
 		static Vector3 SmoothStep(Vector3 const& value1, Vector3 const& value2, double amount);
@@ -162,10 +171,11 @@ namespace Xna {
 		void Ceiling();
 		void Normalize();
 		double Length() const;
-		double LengthSquared() const;
+		double Length(MathPrecision precision) const;
+		constexpr double LengthSquared() const;
 		void Floor();
 		void Deconstruct(double& x, double& y, double& z) const;
-		bool Equals(Vector3 const& other) const;
+		constexpr bool Equals(Vector3 const& other) const;
 	};
 
 	//-------------------------------//
@@ -184,42 +194,42 @@ namespace Xna {
 		double W;
 
 		// Constructs a 3d vector with X, Y, Z and W = 0.
-		Vector4();
+		constexpr Vector4();
 		// Constructs a 3d vector with X, Y, Z and W from four values.
-		Vector4(double x, double y, double z, double w);
+		constexpr Vector4(double x, double y, double z, double w);
 		// Constructs a 3d vector with X and Z from Vector2 and Z and W from the scalars.
-		Vector4(Vector2 value, double z, double w);
+		constexpr Vector4(Vector2 value, double z, double w);
 		// Constructs a 3d vector with X, Y, Z from Vector3 and W from a scalar.
-		Vector4(Vector3 value, double w);
+		constexpr Vector4(Vector3 value, double w);
 		// Constructs a 4d vector with X, Y, Z and W set to the same value.
-		Vector4(double value);
-
-		Vector4 operator- () const;
-		friend Vector4 operator- (Vector4, Vector4);
-		friend Vector4 operator+ (Vector4, Vector4);
-		friend Vector4 operator* (Vector4, Vector4);
-		friend Vector4 operator* (Vector4, double);
-		friend Vector4 operator* (double, Vector4);
-		friend Vector4 operator/ (Vector4, Vector4);
-		friend Vector4 operator/ (Vector4, i32);
-		friend bool operator== (Vector4, Vector4);
-		friend bool operator!= (Vector4, Vector4);
+		constexpr Vector4(double value);
+
+		constexpr Vector4 operator- () const;
+		friend constexpr Vector4 operator- (Vector4, Vector4);
+		friend constexpr Vector4 operator+ (Vector4, Vector4);
+		friend constexpr Vector4 operator* (Vector4, Vector4);
+		friend constexpr Vector4 operator* (Vector4, double);
+		friend constexpr Vector4 operator* (double, Vector4);
+		friend constexpr Vector4 operator/ (Vector4, Vector4);
+		friend constexpr Vector4 operator/ (Vector4, i32);
+		friend constexpr bool operator== (Vector4, Vector4);
+		friend constexpr bool operator!= (Vector4, Vector4);
 
 		// Returns a Vector4 with components 0, 0, 0, 0.
-		static Vector4 Zero();
+		static constexpr Vector4 Zero();
 		// Returns a Vector4 with components 1, 0, 0, 0.
-		static Vector4 One();
+		static constexpr Vector4 One();
 		// Returns a Vector4 with components 1, 0, 0, 0.
-		static Vector4 UnitX();
+		static constexpr Vector4 UnitX();
 		// Returns a Vector4 with components 0, 1, 0, 0.
-		static Vector4 UnitY();
+		static constexpr Vector4 UnitY();
 		// Returns a Vector4 with components 0, 0, 1, 0.
-		static Vector4 UnitZ();
+		static constexpr Vector4 UnitZ();
 		// Returns a Vector4 with components 0, 0, 0, 1.
-		static Vector4 UnitW();
+		static constexpr Vector4 UnitW();
 
 		// Performs vector addition on <paramref name="value1 and <paramref name="value2.
-		static Vector4 Add(Vector4 const& value1, Vector4 const& value2);
+		static constexpr Vector4 Add(Vector4 const& value1, Vector4 const& value2);
 		// Creates a new Vector4 that contains the cartesian coordinates of a vector specified in barycentric coordinates and relative to 4d-triangle.
 		Vector4 Barycentric(Vector4 const& value1, Vector4 const& value2, Vector4 const& value3, double amount1, double amount2);
 		// Creates a new Vector4 that contains CatmullRom interpolation of the specified vectors.
@@ -227,43 +237,47 @@ namespace Xna {
 		// Round the members of this Vector4 towards positive infinity.
 		static Vector4 Ceiling(Vector4 const& value);
 		// Clamps the specified value within a range.
-		static Vector4 Clamp(Vector4 const& value1, Vector4 const& min, Vector4 const& max);
+		static constexpr Vector4 Clamp(Vector4 const& value1, Vector4 const& min, Vector4 const& max);
 		// Returns the distance between two vectors.
 		static double Distance(Vector4 const& value1, Vector4 const& value2);
+		// Returns the distance between two vectors with the selected sqrt precision.
+		static double Distance(Vector4 const& value1, Vector4 const& value2, MathPrecision precision);
 		// Returns the squared distance between two vectors.
-		static double DistanceSquared(Vector4 const& value1, Vector4 const& value2);
+		static constexpr double DistanceSquared(Vector4 const& value1, Vector4 const& value2);
 		// Divides the components of a Vector4 by the components of another Vector4.
-		static Vector4 Divide(Vector4 const& value1, Vector4 const& value2);
+		static constexpr Vector4 Divide(Vector4 const& value1, Vector4 const& value2);
 		// Divides the components of a Vector4 by a scalar.
-		static Vector4 Divide(Vector4 const& value1, double divider);
+		static constexpr Vector4 Divide(Vector4 const& value1, double divider);
 		// Returns a dot product of two vectors.
-		static double Dot(Vector4 const& value1, Vector4 const& value2);
+		static constexpr double Dot(Vector4 const& value1, Vector4 const& value2);
 		// Creates a new Vector4 that contains members from another vector rounded towards negative infinity.
 		static Vector4 Floor(Vector4 const& value);
 		// Creates a new Vector4 that contains hermite spline interpolation.
 		static Vector4 Hermite(Vector4 const& value1, Vector4 const& tangent1, Vector4 const& value2, Vector4 const& tangent2, double amount);
 		// Creates a new Vector4 that contains linear interpolation of the specified vectors.
-		static Vector4 Lerp(Vector4 const& value1, Vector4 const& value2, double amount);
+		static constexpr Vector4 Lerp(Vector4 const& value1, Vector4 const& value2, double amount);
 		// Creates a new Vector4 that contains linear interpolation of the specified vectors.		
-		static Vector4 LerpPrecise(Vector4 const& value1, Vector4 const& value2, double amount);
+		static constexpr Vector4 LerpPrecise(Vector4 const& value1, Vector4 const& value2, double amount);
 		// Creates a new Vector4 that contains a maximal values from the two vectors.
-		static Vector4 Max(Vector4 const& value1, Vector4 const& value2);
+		static constexpr Vector4 Max(Vector4 const& value1, Vector4 const& value2);
 		// Creates a new Vector4 that contains a minimal values from the two vectors.
-		static Vector4 Min(Vector4 const& value1, Vector4 const& value2);
+		static constexpr Vector4 Min(Vector4 const& value1, Vector4 const& value2);
 		// Creates a new Vector4 that contains a multiplication of two vectors.
-		static Vector4 Multiply(Vector4 const& value1, Vector4 const& value2);
+		static constexpr Vector4 Multiply(Vector4 const& value1, Vector4 const& value2);
 		// Creates a new Vector4 that contains a multiplication of Vector4 and a scalar.
-		static Vector4 Multiply(Vector4 const& value1, double scaleFactor);
+		static constexpr Vector4 Multiply(Vector4 const& value1, double scaleFactor);
 		// Creates a new Vector4 that contains the specified vector inversion.
-		static Vector4 Negate(Vector4 const& value);
+		static constexpr Vector4 Negate(Vector4 const& value);
 		// Creates a new Vector4 that contains a normalized values from another vector.
 		static Vector4 Normalize(Vector4 const& value);
+		// Creates a new Vector4 that contains a normalized values from another vector with the selected sqrt precision.
+		static Vector4 Normalize(Vector4 const& value, MathPrecision precision);
 		// Creates a new Vector4 that contains members from another vector rounded to the nearest integer value.
 		static Vector4 Round(Vector4 const& value);
 		// Creates a new Vector4 that contains cubic interpolation of the specified vectors.
 		static Vector4 SmoothStep(Vector4 const& value1, Vector4 value2, double amount);
 		// Creates a new Vector4 that contains subtraction of on Vector4 from a another.
-		static Vector4 Subtract(Vector4 const& value1, Vector4 const& value2);
+		static constexpr Vector4 Subtract(Vector4 const& value1, Vector4 const& value2);
 		// Creates a new Vector4 that contains a transformation of 2d-vector by the specified Matrix.
 		static Vector4 Transform(Vector2 const& value, Matrix const& matrix);
 		// Creates a new Vector4 that contains a transformation of 3d-vector by the specified Matrix.
@@ -281,15 +295,17 @@ namespace Xna {
 		void Floor();
 		// Returns the length of this Vector4.
 		double Length() const;
+		// Returns the length of this Vector4 with the selected sqrt precision.
+		double Length(MathPrecision precision) const;
 		// Returns the squared length of this Vector4.
-		double LengthSquared() const;
+		constexpr double LengthSquared() const;
 		// Turns this Vector4 to a unit vector with the same direction.
 		void Normalize();
 		// Round the members of this Vector4 to the nearest integer value.
 		void Round();
 		void Deconstruct(double& x, double& y, double& z, double& w) const;
 		// Compares whether current instance is equal to specified Vector4.
-		bool Equals(Vector4 const& other) const;
+		constexpr bool Equals(Vector4 const& other) const;
 
 
 
@@ -311,26 +327,26 @@ namespace Xna {
 		i32 X;
 		i32 Y;
 
-		Point(i32 x, i32 y);
-		Point(i32 value);
+		constexpr Point(i32 x, i32 y);
+		constexpr Point(i32 value);
 
-		friend Point operator+ (Point value1, Point value2);
-		friend Point operator- (Point value1, Point value2);
-		friend Point operator* (Point value1, Point value2);
-		friend Point operator/ (Point value1, Point value2);
-		friend Point operator== (Point value1, Point value2);
-		friend Point operator!= (Point value1, Point value2);
+		friend constexpr Point operator+ (Point value1, Point value2);
+		friend constexpr Point operator- (Point value1, Point value2);
+		friend constexpr Point operator* (Point value1, Point value2);
+		friend constexpr Point operator/ (Point value1, Point value2);
+		friend constexpr bool operator== (Point value1, Point value2);
+		friend constexpr bool operator!= (Point value1, Point value2);
 
 		//Returns a point with coordinates 0, 0.
-		static Point Zero();
+		static constexpr Point Zero();
 
 		//Gets a vector2 representation for this object.		
-		Vector2 ToVector2() const;
+		constexpr Vector2 ToVector2() const;
 
 		//Deconstruction method for point.
 		void Deconstruct(i32& x, i32& y) const;
 		//Compares whether current instance is equal to specified point.
-		bool Equals(Point const& other) const;
+		constexpr bool Equals(Point const& other) const;
 	};
 
 	//-------------------------------//
@@ -344,15 +360,15 @@ namespace Xna {
 		i32 Width;
 		i32 Height;
 
-		Rectangle();
-		Rectangle(i32 x, i32 y, i32 width, i32 height);
-		Rectangle(Point location, Point size);
+		constexpr Rectangle();
+		constexpr Rectangle(i32 x, i32 y, i32 width, i32 height);
+		constexpr Rectangle(Point location, Point size);
 
-		friend bool operator== (Rectangle, Rectangle);
-		friend bool operator!= (Rectangle, Rectangle);
+		friend constexpr bool operator== (Rectangle, Rectangle);
+		friend constexpr bool operator!= (Rectangle, Rectangle);
 
 		// Returns a rectangle with X=0, Y=0, Width=0, Height=0.
-		static Rectangle Empty();
+		static constexpr Rectangle Empty();
 
 		//Creates a new rectangle that contains overlapping region of two other rectangles.
 		static Rectangle Intersects(Rectangle const&, Rectangle const&);
@@ -361,39 +377,39 @@ namespace Xna {
 		static Rectangle Union(Rectangle const&, Rectangle const&);
 
 		//Returns the x coordinate of the left edge.
-		i32 Left() const;
+		constexpr i32 Left() const;
 		//Returns the x coordinate of the right edge.
-		i32 Right() const;
+		constexpr i32 Right() const;
 		//Returns the y coordinate of the top edge.
-		i32 Top() const;
+		constexpr i32 Top() const;
 		//Returns the y coordinate of the bottom edge.
-		i32 Bottom() const;
+		constexpr i32 Bottom() const;
 		//If this rectangle is with X=0, Y=0, Width=0, Height=0.
-		bool IsEmpty() const;
+		constexpr bool IsEmpty() const;
 
 		//The top-left coordinate.
-		Point Location() const;
+		constexpr Point Location() const;
 		void Location(Point const& value);
 
 		//The width-height coordinates.
-		Point Size() const;
+		constexpr Point Size() const;
 		void Size(Point const& value);
 
 		//A point located in the center of this rectangle.
-		Point Center() const;
+		constexpr Point Center() const;
 
 		//Gets whether or not the provided coordinates lie within the bounds.
-		bool Contains(i32 x, i32 y) const;
-		bool Contains(double x, double y) const;
-		bool Contains(Point const& value) const;
-		bool Contains(Rectangle const& value) const;
+		constexpr bool Contains(i32 x, i32 y) const;
+		constexpr bool Contains(double x, double y) const;
+		constexpr bool Contains(Point const& value) const;
+		constexpr bool Contains(Rectangle const& value) const;
 
 		//Adjusts the edges of this rectangle by specified horizontal and vertical amounts.
 		void Inflate(i32 horizontalAmount, i32 verticalAmount);
 		void Inflate(double horizontalAmount, double verticalAmount);
 
 		//Gets whether or not the other rectangle intersects with this rectangle.
-		bool Intersects(Rectangle const& value) const;
+		constexpr bool Intersects(Rectangle const& value) const;
 
 		//Changes the location of this rectangle..
 		void Offset(i32 offsetX, i32 offsetY);
@@ -404,7 +420,7 @@ namespace Xna {
 		//Deconstruction method for rectangle.
 		void Deconstruct(long& x, long& y, long& width, long& height) const;
 		//Compares whether current rectangle is equal to specified rectangle.
-		bool Equals(Rectangle const& other) const;
+		constexpr bool Equals(Rectangle const& other) const;
 	};
 
 	//-------------------------------//
@@ -417,43 +433,47 @@ namespace Xna {
 		double Z;
 		double W;
 
-		Quaternion();
-		Quaternion(double x, double y, double z, double w);
-		Quaternion(Vector3 value, double w);
-		Quaternion(Vector4 value);
+		constexpr Quaternion();
+		constexpr Quaternion(double x, double y, double z, double w);
+		constexpr Quaternion(Vector3 value, double w);
+		constexpr Quaternion(Vector4 value);
 
 		Quaternion operator -(Quaternion quaternion);
-		friend Quaternion operator +(Quaternion quaternion1, Quaternion quaternion2);
-		friend Quaternion operator /(Quaternion quaternion1, Quaternion quaternion2);
-		friend bool operator ==(Quaternion quaternion1, Quaternion quaternion2);
-		friend bool operator !=(Quaternion quaternion1, Quaternion quaternion2);
-		friend Quaternion operator *(Quaternion quaternion1, Quaternion quaternion2);
-		friend Quaternion operator -(Quaternion quaternion1, Quaternion quaternion2);
-
-		static Quaternion Identity();
-		static Quaternion Add(Quaternion const& quaternion1, Quaternion const& quaternion2);
-		static Quaternion Concatenate(Quaternion const& value1, Quaternion const& value2);
-		static Quaternion Conjugate(Quaternion const& value);
+		friend constexpr Quaternion operator +(Quaternion quaternion1, Quaternion quaternion2);
+		friend constexpr Quaternion operator /(Quaternion quaternion1, Quaternion quaternion2);
+		friend constexpr bool operator ==(Quaternion quaternion1, Quaternion quaternion2);
+		friend constexpr bool operator !=(Quaternion quaternion1, Quaternion quaternion2);
+		friend constexpr Quaternion operator *(Quaternion quaternion1, Quaternion quaternion2);
+		friend constexpr Quaternion operator -(Quaternion quaternion1, Quaternion quaternion2);
+
+		static constexpr Quaternion Identity();
+		static constexpr Quaternion Add(Quaternion const& quaternion1, Quaternion const& quaternion2);
+		static constexpr Quaternion Concatenate(Quaternion const& value1, Quaternion const& value2);
+		static constexpr Quaternion Conjugate(Quaternion const& value);
 		static Quaternion CreateFromAxisAngle(Vector3 const& axis, double angle);
+		static Quaternion CreateFromAxisAngle(Vector3 const& axis, double angle, MathPrecision precision);
 		static Quaternion CreateFromRotationMatrix(Matrix const& matrix);
 		static Quaternion CreateFromYawPitchRoll(double yaw, double pitch, double roll);
-		static Quaternion Divide(Quaternion const& quaternion1, Quaternion const& quaternion2);
-		static double Dot(Quaternion const& quaternion1, Quaternion const& quaternion2);
+		static Quaternion CreateFromYawPitchRoll(double yaw, double pitch, double roll, MathPrecision precision);
+		static constexpr Quaternion Divide(Quaternion const& quaternion1, Quaternion const& quaternion2);
+		static constexpr double Dot(Quaternion const& quaternion1, Quaternion const& quaternion2);
 		static Quaternion Inverse(Quaternion const& quaternion);
 		static Quaternion Lerp(Quaternion const& quaternion1, Quaternion const& quaternion2, double amount);
 		static Quaternion Slerp(Quaternion const& quaternion1, Quaternion const& quaternion2, double amount);
-		static Quaternion Subtract(Quaternion const& quaternion1, Quaternion const& quaternion2);
-		static Quaternion Multiply(Quaternion const& quaternion1, Quaternion const& quaternion2);
-		static Quaternion Multiply(Quaternion const& quaternion1, double scaleFactor);
-		static Quaternion Negate(Quaternion const& quaternion);
+		static constexpr Quaternion Subtract(Quaternion const& quaternion1, Quaternion const& quaternion2);
+		static constexpr Quaternion Multiply(Quaternion const& quaternion1, Quaternion const& quaternion2);
+		static constexpr Quaternion Multiply(Quaternion const& quaternion1, double scaleFactor);
+		static constexpr Quaternion Negate(Quaternion const& quaternion);
 		static Quaternion Normalize(Quaternion const& quaternion);
+		static Quaternion Normalize(Quaternion const& quaternion, MathPrecision precision);
 
-		void Conjugate();
+		constexpr void Conjugate();
 		double Length() const;
-		double LengthSquared() const;
+		double Length(MathPrecision precision) const;
+		constexpr double LengthSquared() const;
 		void Normalize();
 		Vector4 ToVector4() const;
-		bool Equals(Quaternion const& other) const;
+		constexpr bool Equals(Quaternion const& other) const;
 	};
 
 	//-------------------------------//
@@ -481,34 +501,39 @@ namespace Xna {
 		double M43;
 		double M44;
 
-		Matrix();
+		constexpr Matrix();
 
-		Matrix(double m11, double m12, double m13, double m14, double m21, double m22, double m23, double m24, double m31,
+		constexpr Matrix(double m11, double m12, double m13, double m14, double m21, double m22, double m23, double m24, double m31,
 			double m32, double m33, double m34, double m41, double m42, double m43, double m44);
 
-		Matrix(Vector4 row1, Vector4 row2, Vector4 row3, Vector4 row4);
+		constexpr Matrix(Vector4 row1, Vector4 row2, Vector4 row3, Vector4 row4);
 
 		//Se for um nmero fora de 0 a 15 retornar M11.
 		double& operator[] (size_t index);
 		double& operator[] (Point row_col);
 		Matrix operator- (Matrix matrix);
-		friend Matrix operator+ (Matrix matrix1, Matrix matrix2);
-		friend Matrix operator- (Matrix matrix1, Matrix matrix2);
-		friend Matrix operator/ (Matrix matrix1, Matrix matrix2);
-		friend Matrix operator/ (Matrix matrix, double divider);
-		friend bool operator== (Matrix matrix1, Matrix matrix2);
-		friend bool operator!= (Matrix matrix1, Matrix matrix2);
-		friend Matrix operator* (Matrix matrix1, Matrix matrix2);
-		friend Matrix operator* (Matrix matrix, double scaleFactor);
-
-		static Matrix Identity();
-		static Matrix Add(Matrix const& matrix1, Matrix const& matrix2);
+		friend constexpr Matrix operator+ (Matrix matrix1, Matrix matrix2);
+		friend constexpr Matrix operator- (Matrix matrix1, Matrix matrix2);
+		friend constexpr Matrix operator/ (Matrix matrix1, Matrix matrix2);
+		friend constexpr Matrix operator/ (Matrix matrix, double divider);
+		friend constexpr bool operator== (Matrix matrix1, Matrix matrix2);
+		friend constexpr bool operator!= (Matrix matrix1, Matrix matrix2);
+		friend constexpr Matrix operator* (Matrix matrix1, Matrix matrix2);
+		friend constexpr Matrix operator* (Matrix matrix, double scaleFactor);
+
+		static constexpr Matrix Identity();
+		static constexpr Matrix Add(Matrix const& matrix1, Matrix const& matrix2);
+		// Creates a matrix that scales uniformly, rotates around rotationCenter and then translates.
+		static Matrix CreateAffineTransformation(double scaling, Vector3 const& rotationCenter, Quaternion const& rotation, Vector3 const& translation);
 		static Matrix CreateBillboard(Vector3 const& objectPosition, Vector3 const& cameraPosition,
 			Vector3 const& cameraUpVector, Vector3 const& cameraForwardVector);
 		static Matrix CreateConstrainedBillboard(Vector3 objectPosition, Vector3 cameraPosition,
 			Vector3 rotateAxis, Vector3 cameraForwardVector, Vector3 objectForwardVector);
 		static Matrix CreateFromAxisAngle(Vector3 const& axis, double const& angle);
 		static Matrix CreateFromQuaternion(Quaternion const& quaternion);
+		// Creates CreateScale(scale) * CreateFromQuaternion(rotation) * CreateTranslation(translation)
+		// by writing the terms directly instead of multiplying the three matrices.
+		static Matrix CreateFromTRS(Vector3 const& translation, Quaternion const& rotation, Vector3 const& scale);
 		static Matrix CreateFromYawPitchRoll(double yaw, double pitch, double roll);
 		static Matrix CreateLookAt(Vector3 const& cameraPosition, Vector3 const& cameraTarget, Vector3 const& cameraUpVector);
 		static Matrix CreateOrthographic(double width, double height, double zNearPlane, double zFarPlane);
@@ -516,27 +541,34 @@ namespace Xna {
 		static Matrix CreatePerspective(double width, double height, double nearPlaneDistance, double farPlaneDistance);
 		static Matrix CreatePerspectiveOffCenter(Rectangle const& viewingVolume, double nearPlaneDistance, double farPlaneDistance);
 		static Matrix CreatePerspectiveOffCenter(double left, double right, double bottom, double top, double nearPlaneDistance, double farPlaneDistance);
-		static Matrix CreateRotationX(double radians);
-		static Matrix CreateRotationY(double radians);
-		static Matrix CreateRotationZ(double radians);
-		static Matrix CreateScale(double scale);
-		static Matrix CreateScale(double xScale, double yScale, double zScale);
-		static Matrix CreateScale(Vector3 const& scales);
+		static constexpr Matrix CreateRotationX(double radians);
+		static Matrix CreateRotationX(double radians, MathPrecision precision);
+		static constexpr Matrix CreateRotationY(double radians);
+		static Matrix CreateRotationY(double radians, MathPrecision precision);
+		static constexpr Matrix CreateRotationZ(double radians);
+		static Matrix CreateRotationZ(double radians, MathPrecision precision);
+		static constexpr Matrix CreateScale(double scale);
+		static constexpr Matrix CreateScale(double xScale, double yScale, double zScale);
+		static constexpr Matrix CreateScale(Vector3 const& scales);
 		static Matrix CreateShadow(Vector3 const& lightDirection, Plane const& plane);
-		static Matrix CreateTranslation(double xPosition, double yPosition, double zPosition);
-		static Matrix CreateTranslation(Vector3 const& position);
+		static constexpr Matrix CreateTranslation(double xPosition, double yPosition, double zPosition);
+		static constexpr Matrix CreateTranslation(Vector3 const& position);
 		static Matrix CreateReflection(Plane const& value);
 		static Matrix CreateWorld(Vector3 const& position, Vector3 const& forward, Vector3 const& up);
-		static Matrix Divide(Matrix const& matrix1, Matrix const& matrix2);
-		static Matrix Divide(Matrix const& matrix1, double divider);
+		static constexpr Matrix Divide(Matrix const& matrix1, Matrix const& matrix2);
+		static constexpr Matrix Divide(Matrix const& matrix1, double divider);
 		static Matrix Invert(Matrix const& matrix);
 		static Matrix Lerp(Matrix const& matrix1, Matrix const& matrix2, double amount);
-		static Matrix Multiply(Matrix const& matrix1, Matrix const& matrix2);
-		static Matrix Multiply(Matrix const& matrix1, double scaleFactor);
+		static constexpr Matrix Multiply(Matrix const& matrix1, Matrix const& matrix2);
+		static constexpr Matrix Multiply(Matrix const& matrix1, double scaleFactor);
 		static std::vector<double> ToDoubleArray(Matrix const& matrix);
-		static Matrix Negate(Matrix const& matrix);
-		static Matrix Subtract(Matrix const& matrix1, Matrix const& matrix2);
-		static Matrix Transpose(Matrix const& matrix);
+		// Returns the 16 elements of the matrix, allocated from the resource.
+		static std::pmr::vector<double> ToDoubleArray(Matrix const& matrix, std::pmr::memory_resource* resource);
+		// Copies the 16 elements of the matrix to the array, resizing it.
+		static void ToDoubleArray(Matrix const& matrix, std::vector<double>& result);
+		static constexpr Matrix Negate(Matrix const& matrix);
+		static constexpr Matrix Subtract(Matrix const& matrix1, Matrix const& matrix2);
+		static constexpr Matrix Transpose(Matrix const& matrix);
 
 		Vector3 Backward() const;
 		Vector3 Down() const;
@@ -555,8 +587,1422 @@ namespace Xna {
 		void Up(Vector3 value);
 		bool Decompose(Vector3& scale, Quaternion& rotation, Vector3& translation) const;
 		double Determinant() const;
-		bool Equals(Matrix const& other) const;
+		constexpr bool Equals(Matrix const& other) const;
 	};	
+
+	//-------------------------------//
+	//-----		$ AFFINEMATRIX	-----//	
+	//-------------------------------//
+
+	// A Matrix whose last column is (0, 0, 0, 1), stored without it.
+	// Multiply, Invert and Transform skip the projective terms: a product takes
+	// 36 multiplications instead of the 64 of Matrix.
+	struct AffineMatrix {
+		double M11;
+		double M12;
+		double M13;
+
+		double M21;
+		double M22;
+		double M23;
+
+		double M31;
+		double M32;
+		double M33;
+
+		double M41;
+		double M42;
+		double M43;
+
+		constexpr AffineMatrix();
+
+		constexpr AffineMatrix(double m11, double m12, double m13, double m21, double m22, double m23,
+			double m31, double m32, double m33, double m41, double m42, double m43);
+
+		// Drops the last column of the matrix, which is assumed to be (0, 0, 0, 1).
+		constexpr AffineMatrix(Matrix const& matrix);
+
+		friend constexpr AffineMatrix operator* (AffineMatrix const& matrix1, AffineMatrix const& matrix2);
+		friend constexpr bool operator== (AffineMatrix const& matrix1, AffineMatrix const& matrix2);
+		friend constexpr bool operator!= (AffineMatrix const& matrix1, AffineMatrix const& matrix2);
+
+		static constexpr AffineMatrix Identity();
+		// Creates the affine form of Matrix::CreateFromTRS.
+		static AffineMatrix CreateFromTRS(Vector3 const& translation, Quaternion const& rotation, Vector3 const& scale);
+		static AffineMatrix Invert(AffineMatrix const& matrix);
+		static constexpr AffineMatrix Multiply(AffineMatrix const& matrix1, AffineMatrix const& matrix2);
+		static constexpr Vector3 Transform(Vector3 const& position, AffineMatrix const& matrix);
+		static void Transform(std::vector<Vector3> const& sourceArray, AffineMatrix const& matrix, std::vector<Vector3>& destinationArray);
+		static constexpr Vector3 TransformNormal(Vector3 const& normal, AffineMatrix const& matrix);
+
+		constexpr Vector3 Translation() const;
+		constexpr double Determinant() const;
+		constexpr Matrix ToMatrix() const;
+		constexpr bool Equals(AffineMatrix const& other) const;
+	};
+
+	//-------------------------------//
+	//-----		$ INLINE		-----//	
+	//-------------------------------//
+
+	// Definitions of the constexpr and inline members declared above. They live in the header so
+	// constant transforms and lookup tables can be built at compile time and the trivial
+	// operations inline into callers in other translation units.
+
+	//----- Vector2
+
+	constexpr Vector2::Vector2() : X(0), Y(0) {}
+
+	constexpr Vector2::Vector2(double x, double y) : X(x), Y(y) {}
+
+	constexpr Vector2::Vector2(double value) : X(value), Y(value) {}
+
+	constexpr Vector2 Vector2::operator- () {
+		return Vector2::Negate(*this);
+	}
+
+	constexpr Vector2 operator+ (Vector2 value1, Vector2 value2) {
+		return Vector2::Add(value1, value2);
+	}
+
+	constexpr Vector2 operator- (Vector2 value1, Vector2 value2) {
+		return Vector2::Subtract(value1, value2);
+	}
+
+	constexpr Vector2 operator* (Vector2 value1, Vector2 value2) {
+		return Vector2::Multiply(value1, value2);
+	}
+
+	constexpr Vector2 operator* (Vector2 value, double scaleFactor) {
+		return Vector2::Multiply(value, scaleFactor);
+	}
+
+	constexpr Vector2 operator* (double scaleFactor, Vector2 value) {
+		return Vector2::Multiply(value, scaleFactor);
+	}
+
+	constexpr Vector2 operator/ (Vector2 value, Vector2 divider) {
+		return Vector2::Divide(value, divider);
+	}
+
+	constexpr Vector2 operator/ (Vector2 value, double divider) {
+		return Vector2::Divide(value, divider);
+	}
+
+	constexpr Vector2 Vector2::Zero() {
+		return Vector2(0);
+	}
+
+	constexpr Vector2 Vector2::One() {
+		return Vector2(1.0, 1.0);
+	}
+
+	constexpr Vector2 Vector2::UnitX() {
+		return Vector2(1.0, 0.0);
+	}
+
+	constexpr Vector2 Vector2::UnitY() {
+		return Vector2(0, 1.0);
+	}
+
+	constexpr Vector2 Vector2::Add(Vector2 const& value1, Vector2 const& value2) {
+		return Vector2(
+			value1.X + value2.X,
+			value1.Y + value2.Y);
+	}
+
+	constexpr Vector2 Vector2::Subtract(Vector2 const& value1, Vector2 const& value2)
+	{
+		return Vector2(
+			value1.X - value2.X,
+			value1.Y - value2.Y);
+	}
+
+	constexpr Vector2 Vector2::Multiply(Vector2 const& value1, Vector2 const& value2)
+	{
+		return Vector2(
+			value1.X * value2.X,
+			value1.Y * value2.Y);
+	}
+
+	constexpr Vector2 Vector2::Multiply(Vector2 const& value1, double scaleFactor)
+	{
+		return Vector2(
+			value1.X * scaleFactor,
+			value1.Y * scaleFactor);
+	}
+
+	constexpr Vector2 Vector2::Divide(Vector2 const& value1, Vector2 const& value2) {
+		return Vector2(
+			value1.X / value2.X,
+			value1.Y / value2.Y);
+	}
+
+	constexpr Vector2 Vector2::Divide(Vector2 const& value1, double divider) {
+		double factor = 1. / divider;
+		return Vector2(
+			value1.X * factor,
+			value1.Y * factor);
+	}
+
+	constexpr double Vector2::DistanceSquared(Vector2 const& value1, Vector2 const& value2) {
+		return
+			(value1.X - value2.X) * (value1.X - value2.X) +
+			(value1.Y - value2.Y) * (value1.Y - value2.Y);
+	}
+
+	constexpr double Vector2::Dot(Vector2 const& value1, Vector2 const& value2) {
+		return (value1.X * value2.X) + (value1.Y * value2.Y);
+	}
+
+	constexpr Vector2 Vector2::Negate(Vector2 const& value)
+	{
+		return Vector2(-value.X, -value.Y);
+	}
+
+	constexpr double Vector2::LengthSquared() const {
+		return (X * X) + (Y * Y);
+	}
+
+	constexpr bool operator== (Vector2 a, Vector2 b) {
+		return a.Equals(b);
+	}
+
+	constexpr bool operator!= (Vector2 a, Vector2 b) {
+		return !a.Equals(b);
+	}
+
+	constexpr Vector2 Vector2::Clamp(Vector2 const& value1, Vector2 const& min, Vector2 const& max) {
+		return Vector2(
+			MathHelper::Clamp(value1.X, min.X, max.X),
+			MathHelper::Clamp(value1.Y, min.Y, max.Y));
+	}
+
+	inline double Vector2::Distance(Vector2 const& value1, Vector2 const& value2) {
+		return MathHelper::Sqrt(DistanceSquared(value1, value2));
+	}
+
+	constexpr Vector2 Vector2::Lerp(Vector2 const& value1, Vector2 const& value2, double amount) {
+		return Vector2(
+			MathHelper::Lerp(value1.X, value2.X, amount),
+			MathHelper::Lerp(value1.Y, value2.Y, amount));
+	}
+
+	constexpr Vector2 Vector2::LerpPrecise(Vector2 const& value1, Vector2  const& value2, double amount)
+	{
+		return Vector2(
+			MathHelper::LerpPrecise(value1.X, value2.X, amount),
+			MathHelper::LerpPrecise(value1.Y, value2.Y, amount));
+	}
+
+	constexpr Vector2 Vector2::Max(Vector2 const& value1, Vector2 const& value2)
+	{
+		return Vector2(
+			MathHelper::Max(value1.X, value2.X),
+			MathHelper::Max(value1.Y, value2.Y));
+	}
+
+	constexpr Vector2 Vector2::Min(Vector2 const& value1, Vector2 const& value2)
+	{
+		return Vector2(
+			MathHelper::Min(value1.X, value2.X),
+			MathHelper::Min(value1.Y, value2.Y));
+	}
+
+	inline double Vector2::Length() const {
+		return MathHelper::Sqrt((X * X) + (Y * Y));
+	}
+
+	constexpr bool Vector2::Equals(Vector2 const& other) const {
+		return (X == other.X) && (Y == other.Y);
+	}
+
+	//----- Vector3
+
+	constexpr Vector3::Vector3() :
+		X(0), Y(0), Z(0) {}
+
+	constexpr Vector3::Vector3(double x, double y, double z) :
+		X(x), Y(y), Z(z) {}
+
+	constexpr Vector3::Vector3(double value) :
+		X(value), Y(value), Z(value) {}
+
+	constexpr Vector3::Vector3(Vector2 value, double z) :
+		X(value.X), Y(value.Y), Z(z) {}
+
+	constexpr Vector3 Vector3::operator- () const {
+		return Vector3(-X, -Y, -Z);
+	}
+
+	constexpr Vector3 operator- (Vector3 value1, Vector3 value2) {
+		return Vector3::Subtract(value1, value2);
+	}
+
+	constexpr Vector3 operator+ (Vector3 value1, Vector3 value2) {
+		return Vector3::Add(value1, value2);
+	}
+
+	constexpr Vector3 operator* (Vector3 value1, Vector3 value2) {
+		return Vector3::Multiply(value1, value2);
+	}
+
+	constexpr Vector3 operator* (double scaleFactor, Vector3 value) {
+		return Vector3::Multiply(value, scaleFactor);
+	}
+
+	constexpr Vector3 operator* (Vector3 value, double scaleFactor) {
+		return Vector3::Multiply(value, scaleFactor);
+	}
+
+	constexpr Vector3 operator/ (Vector3 value1, Vector3 value2) {
+		return Vector3::Divide(value1, value2);
+	}
+
+	constexpr Vector3 operator/ (Vector3 value, double divider) {
+		return Vector3::Divide(value, divider);
+	}
+
+	constexpr Vector3 Vector3::Zero() { return Vector3(0); }
+
+	constexpr Vector3 Vector3::One() { return Vector3(1.); }
+
+	constexpr Vector3 Vector3::UnitX() { return Vector3(1., 0, 0); }
+
+	constexpr Vector3 Vector3::UnitY() { return Vector3(0, 1., 0); }
+
+	constexpr Vector3 Vector3::UnitZ() { return Vector3(0, 0, 1.); }
+
+	constexpr Vector3 Vector3::Up() { return Vector3(0, 1., 0); }
+
+	constexpr Vector3 Vector3::Down() { return Vector3(0, -1., 0); }
+
+	constexpr Vector3 Vector3::Right() { return Vector3(1., 0, 0); }
+
+	constexpr Vector3 Vector3::Left() { return Vector3(-1., 0, 0); }
+
+	constexpr Vector3 Vector3::Forward() { return Vector3(0, 0, -1.); }
+
+	constexpr Vector3 Vector3::Backward() { return Vector3(0, 0, 1.); }
+
+	constexpr Vector3 Vector3::Add(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			value1.X + value2.X,
+			value1.Y + value2.Y,
+			value1.Z + value2.Z);
+	}
+
+	constexpr Vector3 Vector3::Subtract(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			value1.X - value2.X,
+			value1.Y - value2.Y,
+			value1.Z - value2.Z);
+	}
+
+	constexpr Vector3 Vector3::Divide(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			value1.X / value2.X,
+			value1.Y / value2.Y,
+			value1.Z / value2.Z);
+	}
+
+	constexpr Vector3 Vector3::Divide(Vector3 const& value1, double divider) {
+		double factor = 1. / divider;
+		return Vector3(
+			value1.X * factor,
+			value1.Y * factor,
+			value1.Z * factor);
+	}
+
+	constexpr Vector3 Vector3::Multiply(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			value1.X * value2.X,
+			value1.Y * value2.Y,
+			value1.Z * value2.Z);
+	}
+
+	constexpr Vector3 Vector3::Multiply(Vector3 const& value1, double scaleFactor) {
+		return Vector3(
+			value1.X * scaleFactor,
+			value1.Y * scaleFactor,
+			value1.Z * scaleFactor);
+	}
+
+	constexpr Vector3 Vector3::Cross(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			value1.Y * value2.Z - value2.Y * value1.Z,
+			-(value1.X * value2.Z - value2.X * value1.Z),
+			value1.X * value2.Y - value2.X * value1.Y);
+	}
+
+	constexpr double Vector3::Dot(Vector3 const& value1, Vector3 const& value2) {
+		return
+			value1.X * value2.X +
+			value1.Y * value2.Y +
+			value1.Z * value2.Z;
+	}
+
+	constexpr double Vector3::DistanceSquared(Vector3 const& value1, Vector3 const& value2) {
+		return
+			(value1.X - value2.X) * (value1.X - value2.X) +
+			(value1.Y - value2.Y) * (value1.Y - value2.Y) +
+			(value1.Z - value2.Z) * (value1.Z - value2.Z);
+	}
+
+	constexpr Vector3 Vector3::Negate(Vector3 const& value) {
+		return Vector3(-value.X, -value.Y, -value.Z);
+	}
+
+	constexpr double Vector3::LengthSquared() const {
+		return (X * X) + (Y * Y) + (Z * Z);
+	}
+
+	constexpr bool operator== (Vector3 value1, Vector3 value2) {
+		return value1.Equals(value2);
+	}
+
+	constexpr bool operator!= (Vector3 value1, Vector3 value2) {
+		return !value1.Equals(value2);
+	}
+
+	constexpr Vector3 Vector3::Clamp(Vector3 const& value1, Vector3 const& min, Vector3 const& max) {
+		return Vector3(
+			MathHelper::Clamp(value1.X, min.X, max.X),
+			MathHelper::Clamp(value1.Y, min.Y, max.Y),
+			MathHelper::Clamp(value1.Z, min.Z, max.Z));
+	}
+
+	inline double Vector3::Distance(Vector3 const& value1, Vector3 const& value2) {
+		return MathHelper::Sqrt(DistanceSquared(value1, value2));
+	}
+
+	constexpr Vector3 Vector3::Lerp(Vector3 const& value1, Vector3 const& value2, double amount) {
+		return Vector3(
+			MathHelper::Lerp(value1.X, value2.X, amount),
+			MathHelper::Lerp(value1.Y, value2.Y, amount),
+			MathHelper::Lerp(value1.Z, value2.Z, amount));
+	}
+
+	constexpr Vector3 Vector3::LerpPrecise(Vector3 const& value1, Vector3 const& value2, double amount) {
+		return Vector3(
+			MathHelper::LerpPrecise(value1.X, value2.X, amount),
+			MathHelper::LerpPrecise(value1.Y, value2.Y, amount),
+			MathHelper::LerpPrecise(value1.Z, value2.Z, amount));
+	}
+
+	constexpr Vector3 Vector3::Max(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			MathHelper::Max(value1.X, value2.X),
+			MathHelper::Max(value1.Y, value2.Y),
+			MathHelper::Max(value1.Z, value2.Z));
+	}
+
+	constexpr Vector3 Vector3::Min(Vector3 const& value1, Vector3 const& value2) {
+		return Vector3(
+			MathHelper::Min(value1.X, value2.X),
+			MathHelper::Min(value1.Y, value2.Y),
+			MathHelper::Min(value1.Z, value2.Z));
+	}
+
+	inline double Vector3::Length() const {
+		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z));
+	}
+
+	constexpr bool Vector3::Equals(Vector3 const& other) const {
+		return X == other.X
+			&& Y == other.Y
+			&& Z == other.Z;
+	}
+
+	//----- Vector4
+
+	constexpr Vector4::Vector4() :
+		X(0), Y(0), Z(0), W(0) {}
+
+	constexpr Vector4::Vector4(double x, double y, double z, double w) :
+		X(x), Y(y), Z(z), W(w) {}
+
+	constexpr Vector4::Vector4(Vector2 value, double z, double w) :
+		X(value.X), Y(value.Y), Z(z), W(w) {}
+
+	constexpr Vector4::Vector4(Vector3 value, double w) :
+		X(value.X), Y(value.Y), Z(value.Z), W(w) {}
+
+	constexpr Vector4::Vector4(double value) :
+		X(value), Y(value), Z(value), W(value) {}
+
+	constexpr Vector4 Vector4::operator- () const {
+		return Vector4::Negate((*this));
+	}
+
+	constexpr Vector4 operator- (Vector4 value1, Vector4 value2) {
+		return Vector4::Subtract(value1, value2);
+	}
+
+	constexpr Vector4 operator+ (Vector4 value1, Vector4 value2) {
+		return Vector4::Add(value1, value2);
+	}
+
+	constexpr Vector4 operator* (Vector4 value1, Vector4 value2) {
+		return Vector4::Multiply(value1, value2);
+	}
+
+	constexpr Vector4 operator* (Vector4 value, double scaleFactor) {
+		return Vector4::Multiply(value, scaleFactor);
+	}
+
+	constexpr Vector4 operator* (double scaleFactor, Vector4 value) {
+		return Vector4::Multiply(value, scaleFactor);
+	}
+
+	constexpr Vector4 operator/ (Vector4 value1, Vector4 value2) {
+		return Vector4::Divide(value1, value2);
+	}
+
+	constexpr Vector4 operator/ (Vector4 value1, i32 divider) {
+		return Vector4::Divide(value1, divider);
+	}
+
+	constexpr Vector4 Vector4::Zero() { return Vector4(0); }
+
+	constexpr Vector4 Vector4::One() { return Vector4(1.); }
+
+	constexpr Vector4 Vector4::UnitX() { return Vector4(1., 0, 0, 0); }
+
+	constexpr Vector4 Vector4::UnitY() { return Vector4(0, 1., 0, 0); }
+
+	constexpr Vector4 Vector4::UnitZ() { return Vector4(0, 0, 1., 0); }
+
+	constexpr Vector4 Vector4::UnitW() { return Vector4(0, 0, 0, 1.); }
+
+	constexpr Vector4 Vector4::Add(Vector4 const& value1, Vector4 const& value2) {
+		return Vector4(
+			value1.X + value2.X,
+			value1.Y + value2.Y,
+			value1.Z + value2.Z,
+			value1.W + value2.W);
+	}
+
+	constexpr Vector4 Vector4::Subtract(Vector4 const& value1, Vector4 const& value2) {
+		return Vector4(
+			value1.X - value2.X,
+			value1.Y - value2.Y,
+			value1.Z - value2.Z,
+			value1.W - value2.W);
+	}
+
+	constexpr Vector4 Vector4::Multiply(Vector4 const& value1, Vector4 const& value2) {
+		return Vector4(
+			value1.X * value2.X,
+			value1.Y * value2.Y,
+			value1.Z * value2.Z,
+			value1.W * value2.W);
+	}
+
+	constexpr Vector4 Vector4::Multiply(Vector4 const& value1, double scaleFactor) {
+		return Vector4(
+			value1.X * scaleFactor,
+			value1.Y * scaleFactor,
+			value1.Z * scaleFactor,
+			value1.W * scaleFactor);
+	}
+
+	constexpr Vector4 Vector4::Divide(Vector4 const& value1, Vector4 const& value2) {
+		return Vector4(
+			value1.X / value2.X,
+			value1.Y / value2.Y,
+			value1.Z / value2.Z,
+			value1.W / value2.W);
+	}
+
+	constexpr Vector4 Vector4::Divide(Vector4 const& value1, double divider) {
+		double factor = 1. / divider;
+		return Vector4(
+			value1.X * factor,
+			value1.Y * factor,
+			value1.Z * factor,
+			value1.W * factor);
+	}
+
+	constexpr double Vector4::DistanceSquared(Vector4 const& value1, Vector4 const& value2) {
+		return
+			(value1.W - value2.W) * (value1.W - value2.W) +
+			(value1.X - value2.X) * (value1.X - value2.X) +
+			(value1.Y - value2.Y) * (value1.Y - value2.Y) +
+			(value1.Z - value2.Z) * (value1.Z - value2.Z);
+	}
+
+	constexpr double Vector4::Dot(Vector4 const& value1, Vector4 const& value2) {
+		return
+			value1.X * value2.X +
+			value1.Y * value2.Y +
+			value1.Z * value2.Z +
+			value1.W * value2.W;
+	}
+
+	constexpr Vector4 Vector4::Negate(Vector4 const& value) {
+		return Vector4(-value.X, -value.Y, -value.Z, -value.W);
+	}
+
+	constexpr double Vector4::LengthSquared() const {
+		return (X * X) + (Y * Y) + (Z * Z) + (W * W);
+	}
+
+	constexpr bool operator== (Vector4 value1, Vector4 value2) {
+		return value1.Equals(value2);
+	}
+
+	constexpr bool operator!= (Vector4 value1, Vector4 value2) {
+		return !value1.Equals(value2);
+	}
+
+	constexpr Vector4 Vector4::Clamp(Vector4 const& value1, Vector4 const& min, Vector4 const& max) {
+		return Vector4(
+			MathHelper::Clamp(value1.X, min.X, max.X),
+			MathHelper::Clamp(value1.Y, min.Y, max.Y),
+			MathHelper::Clamp(value1.Z, min.Z, max.Z),
+			MathHelper::Clamp(value1.W, min.W, max.W));
+	}
+
+	inline double Vector4::Distance(Vector4 const& value1, Vector4 const& value2) {
+		return MathHelper::Sqrt(DistanceSquared(value1, value2));
+	}
+
+	constexpr Vector4 Vector4::Lerp(Vector4 const& value1, Vector4 const& value2, double amount) {
+		return Vector4(
+			MathHelper::Lerp(value1.X, value2.X, amount),
+			MathHelper::Lerp(value1.Y, value2.Y, amount),
+			MathHelper::Lerp(value1.Z, value2.Z, amount),
+			MathHelper::Lerp(value1.W, value2.W, amount));
+	}
+
+	constexpr Vector4 Vector4::LerpPrecise(Vector4 const& value1, Vector4 const& value2, double amount) {
+		return Vector4(
+			MathHelper::LerpPrecise(value1.X, value2.X, amount),
+			MathHelper::LerpPrecise(value1.Y, value2.Y, amount),
+			MathHelper::LerpPrecise(value1.Z, value2.Z, amount),
+			MathHelper::LerpPrecise(value1.W, value2.W, amount));
+	}
+
+	constexpr Vector4 Vector4::Max(Vector4 const& value1, Vector4 const& value2) {
+		return Vector4(
+			MathHelper::Max(value1.X, value2.X),
+			MathHelper::Max(value1.Y, value2.Y),
+			MathHelper::Max(value1.Z, value2.Z),
+			MathHelper::Max(value1.W, value2.W));
+	}
+
+	constexpr Vector4 Vector4::Min(Vector4 const& value1, Vector4 const& value2) {
+		return Vector4(
+			MathHelper::Min(value1.X, value2.X),
+			MathHelper::Min(value1.Y, value2.Y),
+			MathHelper::Min(value1.Z, value2.Z),
+			MathHelper::Min(value1.W, value2.W));
+	}
+
+	inline double Vector4::Length() const {
+		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
+	}
+
+	constexpr bool Vector4::Equals(Vector4 const& other) const {
+		return W == other.W
+			&& X == other.X
+			&& Y == other.Y
+			&& Z == other.Z;
+	}
+
+	//----- Point
+
+	constexpr Point::Point(i32 x, i32 y): X(x), Y(y) {}
+
+	constexpr Point::Point(i32 value): X(value), Y(value) {}
+
+	constexpr Point operator+ (Point value1, Point value2) {
+		return Point(value1.X + value2.X, value1.Y + value2.Y);
+	}
+
+	constexpr Point operator- (Point value1, Point value2) {
+		return Point(value1.X - value2.X, value1.Y - value2.Y);
+	}
+
+	constexpr Point operator* (Point value1, Point value2) {
+		return Point(value1.X * value2.X, value1.Y * value2.Y);
+	}
+
+	constexpr Point operator/ (Point source, Point divisor) {
+		return Point(source.X / divisor.X, source.Y / divisor.Y);
+	}
+
+	constexpr Point Point::Zero() {
+		return Point(0);
+	}	
+
+	constexpr bool operator== (Point a, Point b) {
+		return a.Equals(b);
+	}
+
+	constexpr bool operator!= (Point a, Point b) {
+		return !a.Equals(b);
+	}
+
+	constexpr Vector2 Point::ToVector2() const {
+		double x = static_cast<double>(X);
+		double y = static_cast<double>(Y);
+		return Vector2(x, y);
+	}
+
+	constexpr bool Point::Equals(Point const& other) const {
+		return X == other.X && Y == other.Y;
+	}
+
+	//----- Rectangle
+
+	constexpr Rectangle::Rectangle(): X(0), Y(0), Width(0), Height(0) {}
+
+	constexpr Rectangle::Rectangle(i32 x, i32 y, i32 width, i32 height) :
+		X(x), Y(y), Width(width), Height(height) {}
+
+	constexpr Rectangle::Rectangle(Point location, Point size) :
+		X(location.X), Y(location.Y),
+		Width(size.X), Height(size.Y) {}
+
+	constexpr Rectangle Rectangle::Empty() { 
+		return Rectangle(0, 0, 0, 0); 
+	}
+
+	constexpr i32 Rectangle::Left() const {
+		return X;
+	}
+
+	constexpr i32 Rectangle::Right() const {
+		return X + Width;
+	}
+
+	constexpr i32 Rectangle::Top() const {
+		return Y;
+	}
+
+	constexpr i32 Rectangle::Bottom() const {
+		return Y + Height;
+	}
+
+	constexpr bool Rectangle::IsEmpty() const {
+		return Width == 0
+			&& Height == 0
+			&& X == 0
+			&& Y == 0;
+	}
+
+	constexpr bool operator== (Rectangle a, Rectangle b) {
+		return a.Equals(b);
+	}
+
+	constexpr bool operator!= (Rectangle a, Rectangle b) {
+		return !a.Equals(b);
+	}
+
+	constexpr Point Rectangle::Location() const {
+		return Point(X, Y);
+	}
+
+	constexpr Point Rectangle::Size() const {
+		return Point(Width, Height);
+	}
+
+	constexpr Point Rectangle::Center() const {
+		return Point(X + (Width / 2), Y + (Height / 2));
+	}
+
+	constexpr bool Rectangle::Contains(i32 x, i32 y) const {
+		return (X <= x && x < (X + Width))
+			&& (Y <= y && y < (Y + Height));
+	}
+
+	constexpr bool Rectangle::Contains(double x, double y) const {
+		i32 _x = static_cast<long>(x);
+		i32 _y = static_cast<long>(y);
+		
+		return Contains(_x, _y);
+	}
+
+	constexpr bool Rectangle::Contains(Point const& value) const {
+		return Contains(value.X, value.Y);
+	}
+
+	constexpr bool Rectangle::Contains(Rectangle const& value) const {
+		return ((((X <= value.X) && ((value.X + value.Width) <= (X + Width))) 
+			&& (Y <= value.Y)) && ((value.Y + value.Height) <= (Y + Height)));
+	}
+
+	constexpr bool Rectangle::Intersects(Rectangle const& value) const {
+		return value.Left() < Right() 
+			&& Left() < value.Right()
+			&& value.Top() < Bottom()
+			&& Top() < value.Bottom();
+	}
+
+	constexpr bool Rectangle::Equals(Rectangle const& other) const {
+		return ((X == other.X)
+			&& (Y == other.Y)
+			&& (Width == other.Width)
+			&& (Height == other.Height));
+	}
+
+	//----- Quaternion
+
+	constexpr Quaternion::Quaternion() :
+		X(0), Y(0), Z(0), W(0) {}
+
+	constexpr Quaternion::Quaternion(double x, double y, double z, double w) :
+		X(x), Y(y), Z(z), W(w) {}
+
+	constexpr Quaternion::Quaternion(Vector3 value, double w) :
+		X(value.X), Y(value.Y), Z(value.Z), W(w) {}
+
+	constexpr Quaternion::Quaternion(Vector4 value) :
+		X(value.X), Y(value.Y), Z(value.Z), W(value.W) {}
+
+	constexpr Quaternion operator +(Quaternion quaternion1, Quaternion quaternion2) {
+		return Quaternion::Add(quaternion1, quaternion2);
+	}
+
+	constexpr Quaternion operator /(Quaternion quaternion1, Quaternion quaternion2) {
+		return Quaternion::Divide(quaternion1, quaternion2);
+	}
+
+	constexpr Quaternion operator *(Quaternion quaternion1, Quaternion quaternion2) {
+		return Quaternion::Multiply(quaternion1, quaternion2);
+	}
+
+	constexpr Quaternion operator -(Quaternion quaternion1, Quaternion quaternion2) {
+		return Quaternion::Subtract(quaternion1, quaternion2);
+	}
+
+	constexpr Quaternion Quaternion::Identity() { return Quaternion(0, 0, 0, 1); }
+
+	constexpr Quaternion Quaternion::Add(Quaternion const& quaternion1, Quaternion const& quaternion2) {
+		return Quaternion(
+			quaternion1.X + quaternion2.X,
+			quaternion1.Y + quaternion2.Y,
+			quaternion1.Z + quaternion2.Z,
+			quaternion1.W + quaternion2.W);
+	}
+
+	constexpr Quaternion Quaternion::Concatenate(Quaternion const& value1, Quaternion const& value2) {
+		Quaternion quaternion;
+
+		double x1 = value1.X;
+		double y1 = value1.Y;
+		double z1 = value1.Z;
+		double w1 = value1.W;
+
+		double x2 = value2.X;
+		double y2 = value2.Y;
+		double z2 = value2.Z;
+		double w2 = value2.W;
+
+		quaternion.X = ((x2 * w1) + (x1 * w2)) + ((y2 * z1) - (z2 * y1));
+		quaternion.Y = ((y2 * w1) + (y1 * w2)) + ((z2 * x1) - (x2 * z1));
+		quaternion.Z = ((z2 * w1) + (z1 * w2)) + ((x2 * y1) - (y2 * x1));
+		quaternion.W = (w2 * w1) - (((x2 * x1) + (y2 * y1)) + (z2 * z1));
+
+		return quaternion;
+	}
+
+	constexpr Quaternion Quaternion::Conjugate(Quaternion const& value) {
+		return Quaternion(-value.X, -value.Y, -value.Z, value.W);
+	}
+
+	constexpr Quaternion Quaternion::Divide(Quaternion const& quaternion1, Quaternion const& quaternion2) {
+		Quaternion quaternion;
+		double x = quaternion1.X;
+		double y = quaternion1.Y;
+		double z = quaternion1.Z;
+		double w = quaternion1.W;
+		double num14 = (((quaternion2.X * quaternion2.X) + (quaternion2.Y * quaternion2.Y)) + (quaternion2.Z * quaternion2.Z)) + (quaternion2.W * quaternion2.W);
+		double num5 = 1.0 / num14;
+		double num4 = -quaternion2.X * num5;
+		double num3 = -quaternion2.Y * num5;
+		double num2 = -quaternion2.Z * num5;
+		double num = quaternion2.W * num5;
+		double num13 = (y * num2) - (z * num3);
+		double num12 = (z * num4) - (x * num2);
+		double num11 = (x * num3) - (y * num4);
+		double num10 = ((x * num4) + (y * num3)) + (z * num2);
+		quaternion.X = ((x * num) + (num4 * w)) + num13;
+		quaternion.Y = ((y * num) + (num3 * w)) + num12;
+		quaternion.Z = ((z * num) + (num2 * w)) + num11;
+		quaternion.W = (w * num) - num10;
+		return quaternion;
+	}
+
+	constexpr double Quaternion::Dot(Quaternion const& quaternion1, Quaternion const& quaternion2) {
+		return ((((quaternion1.X * quaternion2.X) + (quaternion1.Y * quaternion2.Y)) + (quaternion1.Z * quaternion2.Z)) + (quaternion1.W * quaternion2.W));
+	}
+
+	constexpr Quaternion Quaternion::Subtract(Quaternion const& quaternion1, Quaternion const& quaternion2) {
+		Quaternion quaternion;
+		quaternion.X = quaternion1.X - quaternion2.X;
+		quaternion.Y = quaternion1.Y - quaternion2.Y;
+		quaternion.Z = quaternion1.Z - quaternion2.Z;
+		quaternion.W = quaternion1.W - quaternion2.W;
+		return quaternion;
+	}
+
+	constexpr Quaternion Quaternion::Multiply(Quaternion const& quaternion1, Quaternion const& quaternion2) {
+		Quaternion quaternion;
+		double x = quaternion1.X;
+		double y = quaternion1.Y;
+		double z = quaternion1.Z;
+		double w = quaternion1.W;
+		double num4 = quaternion2.X;
+		double num3 = quaternion2.Y;
+		double num2 = quaternion2.Z;
+		double num = quaternion2.W;
+		double num12 = (y * num2) - (z * num3);
+		double num11 = (z * num4) - (x * num2);
+		double num10 = (x * num3) - (y * num4);
+		double num9 = ((x * num4) + (y * num3)) + (z * num2);
+		quaternion.X = ((x * num) + (num4 * w)) + num12;
+		quaternion.Y = ((y * num) + (num3 * w)) + num11;
+		quaternion.Z = ((z * num) + (num2 * w)) + num10;
+		quaternion.W = (w * num) - num9;
+		return quaternion;
+	}
+
+	constexpr Quaternion Quaternion::Multiply(Quaternion const& quaternion1, double scaleFactor) {
+		Quaternion quaternion;
+		quaternion.X = quaternion1.X * scaleFactor;
+		quaternion.Y = quaternion1.Y * scaleFactor;
+		quaternion.Z = quaternion1.Z * scaleFactor;
+		quaternion.W = quaternion1.W * scaleFactor;
+		return quaternion;
+	}
+
+	constexpr Quaternion Quaternion::Negate(Quaternion const& quaternion) {
+		return Quaternion(-quaternion.X, -quaternion.Y, -quaternion.Z, -quaternion.W);
+	}
+
+	constexpr void Quaternion::Conjugate() {
+		Quaternion value = Quaternion::Conjugate(*this);
+		X = value.X;
+		Y = value.Y;
+		Z = value.Z;
+		W = value.W;
+	}
+
+	constexpr double Quaternion::LengthSquared() const {
+		return (X * X) + (Y * Y) + (Z * Z) + (W * W);
+	}
+
+	constexpr bool operator ==(Quaternion quaternion1, Quaternion quaternion2) {
+		return quaternion1.Equals(quaternion2);
+	}
+
+	constexpr bool operator !=(Quaternion quaternion1, Quaternion quaternion2) {
+		return !quaternion1.Equals(quaternion2);
+	}
+
+	inline double Quaternion::Length() const {
+		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
+	}
+
+	constexpr bool Quaternion::Equals(Quaternion const& other) const {
+		return 
+			X == other.X &&
+			Y == other.Y &&
+			Z == other.Z &&
+			W == other.W;
+	}
+
+	//----- Matrix
+
+	constexpr Matrix::Matrix() :
+		M11(0), M12(0), M13(0), M14(0),
+		M21(0), M22(0), M23(0), M24(0),
+		M31(0), M32(0), M33(0), M34(0),
+		M41(0), M42(0), M43(0), M44(0) {}
+
+	constexpr Matrix::Matrix(double m11, double m12, double m13, double m14, double m21, double m22, double m23, double m24, double m31,
+		double m32, double m33, double m34, double m41, double m42, double m43, double m44) :
+		M11(m11), M12(m12), M13(m13), M14(m14),
+		M21(m21), M22(m22), M23(m23), M24(m24),
+		M31(m31), M32(m32), M33(m33), M34(m34),
+		M41(m41), M42(m42), M43(m43), M44(m44) {}
+
+	constexpr Matrix::Matrix(Vector4 row1, Vector4 row2, Vector4 row3, Vector4 row4) :
+		M11(row1.X), M12(row1.Y), M13(row1.Z), M14(row1.W),
+		M21(row2.X), M22(row2.Y), M23(row2.Z), M24(row2.W),
+		M31(row3.X), M32(row3.Y), M33(row3.Z), M34(row3.W),
+		M41(row4.X), M42(row4.Y), M43(row4.Z), M44(row4.W) {}
+
+	constexpr Matrix operator+ (Matrix matrix1, Matrix matrix2) {
+		return Matrix::Add(matrix1, matrix2);
+	}
+
+	constexpr Matrix operator- (Matrix matrix1, Matrix matrix2) {
+		return Matrix::Subtract(matrix1, matrix2);
+	}
+
+	constexpr Matrix operator/ (Matrix matrix1, Matrix matrix2) {
+		return Matrix::Divide(matrix1, matrix2);
+	}
+
+	constexpr Matrix operator/ (Matrix matrix, double divider) {
+		return Matrix::Divide(matrix, divider);
+	}
+
+	constexpr Matrix operator* (Matrix matrix1, Matrix matrix2) {
+		return Matrix::Multiply(matrix1, matrix2);
+	}
+
+	constexpr Matrix operator* (Matrix matrix, double scaleFactor) {
+		return Matrix::Multiply(matrix, scaleFactor);
+	}
+
+	constexpr Matrix Matrix::Identity() {
+		return Matrix(
+			1, 0, 0, 0,
+			0, 1, 0, 0,
+			0, 0, 1, 0,
+			0, 0, 0, 1);
+	}
+
+	constexpr Matrix Matrix::Add(Matrix const& matrix1, Matrix const& matrix2) {
+		Matrix result = matrix1;
+		
+		result.M11 += matrix2.M11;
+		result.M12 += matrix2.M12;
+		result.M13 += matrix2.M13;
+		result.M14 += matrix2.M14;
+		result.M21 += matrix2.M21;
+		result.M22 += matrix2.M22;
+		result.M23 += matrix2.M23;
+		result.M24 += matrix2.M24;
+		result.M31 += matrix2.M31;
+		result.M32 += matrix2.M32;
+		result.M33 += matrix2.M33;
+		result.M34 += matrix2.M34;
+		result.M41 += matrix2.M41;
+		result.M42 += matrix2.M42;
+		result.M43 += matrix2.M43;
+		result.M44 += matrix2.M44;
+		return result;
+	}
+
+	constexpr Matrix Matrix::CreateRotationX(double radians) {
+		Matrix result = Matrix::Identity();
+
+		double val1 = MathHelper::ConstexprCos(radians);
+		double val2 = MathHelper::ConstexprSin(radians);
+
+		result.M22 = val1;
+		result.M23 = val2;
+		result.M32 = -val2;
+		result.M33 = val1;
+
+		return result;
+	}
+
+	constexpr Matrix Matrix::CreateRotationY(double radians) {
+		Matrix result = Matrix::Identity();
+
+		double val1 = MathHelper::ConstexprCos(radians);
+		double val2 = MathHelper::ConstexprSin(radians);
+
+		result.M11 = val1;
+		result.M13 = -val2;
+		result.M31 = val2;
+		result.M33 = val1;
+
+		return result;
+	}
+
+	constexpr Matrix Matrix::CreateRotationZ(double radians) {
+		Matrix result = Matrix::Identity();
+
+		double val1 = MathHelper::ConstexprCos(radians);
+		double val2 = MathHelper::ConstexprSin(radians);
+
+		result.M11 = val1;
+		result.M12 = val2;
+		result.M21 = -val2;
+		result.M22 = val1;
+
+		return result;
+	}
+
+	constexpr Matrix Matrix::CreateScale(double scale) {
+		return CreateScale(scale, scale, scale);
+	}
+
+	constexpr Matrix Matrix::CreateScale(double xScale, double yScale, double zScale) {
+
+		Matrix result;
+
+		result.M11 = xScale;
+		result.M12 = 0;
+		result.M13 = 0;
+		result.M14 = 0;
+		result.M21 = 0;
+		result.M22 = yScale;
+		result.M23 = 0;
+		result.M24 = 0;
+		result.M31 = 0;
+		result.M32 = 0;
+		result.M33 = zScale;
+		result.M34 = 0;
+		result.M41 = 0;
+		result.M42 = 0;
+		result.M43 = 0;
+		result.M44 = 1;
+
+		return result;
+	}
+
+	constexpr Matrix Matrix::CreateScale(Vector3 const& scales) {
+
+		Matrix result;
+
+		result.M11 = scales.X;
+		result.M12 = 0;
+		result.M13 = 0;
+		result.M14 = 0;
+		result.M21 = 0;
+		result.M22 = scales.Y;
+		result.M23 = 0;
+		result.M24 = 0;
+		result.M31 = 0;
+		result.M32 = 0;
+		result.M33 = scales.Z;
+		result.M34 = 0;
+		result.M41 = 0;
+		result.M42 = 0;
+		result.M43 = 0;
+		result.M44 = 1;
+
+		return result;
+	}
+
+	constexpr Matrix Matrix::CreateTranslation(double xPosition, double yPosition, double zPosition) {
+		return Matrix::CreateTranslation(Vector3(xPosition, yPosition, zPosition));
+	}
+
+	constexpr Matrix Matrix::CreateTranslation(Vector3 const& position) {
+		Matrix result;
+		result.M11 = 1;
+		result.M12 = 0;
+		result.M13 = 0;
+		result.M14 = 0;
+		result.M21 = 0;
+		result.M22 = 1;
+		result.M23 = 0;
+		result.M24 = 0;
+		result.M31 = 0;
+		result.M32 = 0;
+		result.M33 = 1;
+		result.M34 = 0;
+		result.M41 = position.X;
+		result.M42 = position.Y;
+		result.M43 = position.Z;
+		result.M44 = 1;
+
+		return result;
+	}
+
+	constexpr Matrix Matrix::Divide(Matrix const& matrix1, Matrix const& matrix2) {
+		Matrix result;
+
+		result.M11 = matrix1.M11 / matrix2.M11;
+		result.M12 = matrix1.M12 / matrix2.M12;
+		result.M13 = matrix1.M13 / matrix2.M13;
+		result.M14 = matrix1.M14 / matrix2.M14;
+		result.M21 = matrix1.M21 / matrix2.M21;
+		result.M22 = matrix1.M22 / matrix2.M22;
+		result.M23 = matrix1.M23 / matrix2.M23;
+		result.M24 = matrix1.M24 / matrix2.M24;
+		result.M31 = matrix1.M31 / matrix2.M31;
+		result.M32 = matrix1.M32 / matrix2.M32;
+		result.M33 = matrix1.M33 / matrix2.M33;
+		result.M34 = matrix1.M34 / matrix2.M34;
+		result.M41 = matrix1.M41 / matrix2.M41;
+		result.M42 = matrix1.M42 / matrix2.M42;
+		result.M43 = matrix1.M43 / matrix2.M43;
+		result.M44 = matrix1.M44 / matrix2.M44;
+		return result;
+	}
+
+	constexpr Matrix Matrix::Divide(Matrix const& matrix1, double divider) {
+		Matrix result;
+		
+		double num = 1.0 / divider;
+		result.M11 = matrix1.M11 * num;
+		result.M12 = matrix1.M12 * num;
+		result.M13 = matrix1.M13 * num;
+		result.M14 = matrix1.M14 * num;
+		result.M21 = matrix1.M21 * num;
+		result.M22 = matrix1.M22 * num;
+		result.M23 = matrix1.M23 * num;
+		result.M24 = matrix1.M24 * num;
+		result.M31 = matrix1.M31 * num;
+		result.M32 = matrix1.M32 * num;
+		result.M33 = matrix1.M33 * num;
+		result.M34 = matrix1.M34 * num;
+		result.M41 = matrix1.M41 * num;
+		result.M42 = matrix1.M42 * num;
+		result.M43 = matrix1.M43 * num;
+		result.M44 = matrix1.M44 * num;
+		return result;
+	}
+
+	constexpr Matrix Matrix::Multiply(Matrix const& matrix1, Matrix const& matrix2) {
+		double m11 = (((matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21)) + (matrix1.M13 * matrix2.M31)) + (matrix1.M14 * matrix2.M41);
+		double m12 = (((matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22)) + (matrix1.M13 * matrix2.M32)) + (matrix1.M14 * matrix2.M42);
+		double m13 = (((matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23)) + (matrix1.M13 * matrix2.M33)) + (matrix1.M14 * matrix2.M43);
+		double m14 = (((matrix1.M11 * matrix2.M14) + (matrix1.M12 * matrix2.M24)) + (matrix1.M13 * matrix2.M34)) + (matrix1.M14 * matrix2.M44);
+		double m21 = (((matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21)) + (matrix1.M23 * matrix2.M31)) + (matrix1.M24 * matrix2.M41);
+		double m22 = (((matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22)) + (matrix1.M23 * matrix2.M32)) + (matrix1.M24 * matrix2.M42);
+		double m23 = (((matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23)) + (matrix1.M23 * matrix2.M33)) + (matrix1.M24 * matrix2.M43);
+		double m24 = (((matrix1.M21 * matrix2.M14) + (matrix1.M22 * matrix2.M24)) + (matrix1.M23 * matrix2.M34)) + (matrix1.M24 * matrix2.M44);
+		double m31 = (((matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21)) + (matrix1.M33 * matrix2.M31)) + (matrix1.M34 * matrix2.M41);
+		double m32 = (((matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22)) + (matrix1.M33 * matrix2.M32)) + (matrix1.M34 * matrix2.M42);
+		double m33 = (((matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23)) + (matrix1.M33 * matrix2.M33)) + (matrix1.M34 * matrix2.M43);
+		double m34 = (((matrix1.M31 * matrix2.M14) + (matrix1.M32 * matrix2.M24)) + (matrix1.M33 * matrix2.M34)) + (matrix1.M34 * matrix2.M44);
+		double m41 = (((matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21)) + (matrix1.M43 * matrix2.M31)) + (matrix1.M44 * matrix2.M41);
+		double m42 = (((matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22)) + (matrix1.M43 * matrix2.M32)) + (matrix1.M44 * matrix2.M42);
+		double m43 = (((matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23)) + (matrix1.M43 * matrix2.M33)) + (matrix1.M44 * matrix2.M43);
+		double m44 = (((matrix1.M41 * matrix2.M14) + (matrix1.M42 * matrix2.M24)) + (matrix1.M43 * matrix2.M34)) + (matrix1.M44 * matrix2.M44);
+		
+		Matrix result;
+		result.M11 = m11;
+		result.M12 = m12;
+		result.M13 = m13;
+		result.M14 = m14;
+		result.M21 = m21;
+		result.M22 = m22;
+		result.M23 = m23;
+		result.M24 = m24;
+		result.M31 = m31;
+		result.M32 = m32;
+		result.M33 = m33;
+		result.M34 = m34;
+		result.M41 = m41;
+		result.M42 = m42;
+		result.M43 = m43;
+		result.M44 = m44;
+		return result;
+	}
+
+	constexpr Matrix Matrix::Multiply(Matrix const& matrix, double scaleFactor) {
+		Matrix result = matrix;
+
+		result.M11 *= scaleFactor;
+		result.M12 *= scaleFactor;
+		result.M13 *= scaleFactor;
+		result.M14 *= scaleFactor;
+		result.M21 *= scaleFactor;
+		result.M22 *= scaleFactor;
+		result.M23 *= scaleFactor;
+		result.M24 *= scaleFactor;
+		result.M31 *= scaleFactor;
+		result.M32 *= scaleFactor;
+		result.M33 *= scaleFactor;
+		result.M34 *= scaleFactor;
+		result.M41 *= scaleFactor;
+		result.M42 *= scaleFactor;
+		result.M43 *= scaleFactor;
+		result.M44 *= scaleFactor;
+		return result;
+	}
+
+	constexpr Matrix Matrix::Negate(Matrix const& matrix) {
+		Matrix result;
+		
+		result.M11 = -matrix.M11;
+		result.M12 = -matrix.M12;
+		result.M13 = -matrix.M13;
+		result.M14 = -matrix.M14;
+		result.M21 = -matrix.M21;
+		result.M22 = -matrix.M22;
+		result.M23 = -matrix.M23;
+		result.M24 = -matrix.M24;
+		result.M31 = -matrix.M31;
+		result.M32 = -matrix.M32;
+		result.M33 = -matrix.M33;
+		result.M34 = -matrix.M34;
+		result.M41 = -matrix.M41;
+		result.M42 = -matrix.M42;
+		result.M43 = -matrix.M43;
+		result.M44 = -matrix.M44;
+		return result;
+	}
+
+	constexpr Matrix Matrix::Subtract(Matrix const& matrix1, Matrix const& matrix2) {
+
+		Matrix result;
+
+		result.M11 = matrix1.M11 - matrix2.M11;
+		result.M12 = matrix1.M12 - matrix2.M12;
+		result.M13 = matrix1.M13 - matrix2.M13;
+		result.M14 = matrix1.M14 - matrix2.M14;
+		result.M21 = matrix1.M21 - matrix2.M21;
+		result.M22 = matrix1.M22 - matrix2.M22;
+		result.M23 = matrix1.M23 - matrix2.M23;
+		result.M24 = matrix1.M24 - matrix2.M24;
+		result.M31 = matrix1.M31 - matrix2.M31;
+		result.M32 = matrix1.M32 - matrix2.M32;
+		result.M33 = matrix1.M33 - matrix2.M33;
+		result.M34 = matrix1.M34 - matrix2.M34;
+		result.M41 = matrix1.M41 - matrix2.M41;
+		result.M42 = matrix1.M42 - matrix2.M42;
+		result.M43 = matrix1.M43 - matrix2.M43;
+		result.M44 = matrix1.M44 - matrix2.M44;
+		return result;
+	}
+
+	constexpr Matrix Matrix::Transpose(Matrix const& matrix) {
+		Matrix ret;
+
+		ret.M11 = matrix.M11;
+		ret.M12 = matrix.M21;
+		ret.M13 = matrix.M31;
+		ret.M14 = matrix.M41;
+
+		ret.M21 = matrix.M12;
+		ret.M22 = matrix.M22;
+		ret.M23 = matrix.M32;
+		ret.M24 = matrix.M42;
+
+		ret.M31 = matrix.M13;
+		ret.M32 = matrix.M23;
+		ret.M33 = matrix.M33;
+		ret.M34 = matrix.M43;
+
+		ret.M41 = matrix.M14;
+		ret.M42 = matrix.M24;
+		ret.M43 = matrix.M34;
+		ret.M44 = matrix.M44;
+
+		return ret;
+	}	
+	constexpr bool operator== (Matrix matrix1, Matrix matrix2) {
+		return matrix1.Equals(matrix2);
+	}
+
+	constexpr bool operator!= (Matrix matrix1, Matrix matrix2) {
+		return !matrix1.Equals(matrix2);
+	}
+
+	constexpr bool Matrix::Equals(Matrix const& other) const {
+		return (M11 == other.M11)
+			&& (M22 == other.M22)
+			&& (M33 == other.M33)
+			&& (M44 == other.M44)
+			&& (M12 == other.M12)
+			&& (M13 == other.M13)
+			&& (M14 == other.M14)
+			&& (M21 == other.M21)
+			&& (M23 == other.M23)
+			&& (M24 == other.M24)
+			&& (M31 == other.M31)
+			&& (M32 == other.M32)
+			&& (M34 == other.M34) 
+			&& (M41 == other.M41)
+			&& (M42 == other.M42)
+			&& (M43 == other.M43);
+	}
+
+	//----- AffineMatrix
+
+	constexpr AffineMatrix::AffineMatrix() :
+		M11(0), M12(0), M13(0),
+		M21(0), M22(0), M23(0),
+		M31(0), M32(0), M33(0),
+		M41(0), M42(0), M43(0) {}
+
+	constexpr AffineMatrix::AffineMatrix(double m11, double m12, double m13, double m21, double m22, double m23,
+		double m31, double m32, double m33, double m41, double m42, double m43) :
+		M11(m11), M12(m12), M13(m13),
+		M21(m21), M22(m22), M23(m23),
+		M31(m31), M32(m32), M33(m33),
+		M41(m41), M42(m42), M43(m43) {}
+
+	constexpr AffineMatrix::AffineMatrix(Matrix const& matrix) :
+		M11(matrix.M11), M12(matrix.M12), M13(matrix.M13),
+		M21(matrix.M21), M22(matrix.M22), M23(matrix.M23),
+		M31(matrix.M31), M32(matrix.M32), M33(matrix.M33),
+		M41(matrix.M41), M42(matrix.M42), M43(matrix.M43) {}
+
+	constexpr AffineMatrix operator* (AffineMatrix const& matrix1, AffineMatrix const& matrix2) {
+		return AffineMatrix::Multiply(matrix1, matrix2);
+	}
+
+	constexpr bool operator== (AffineMatrix const& matrix1, AffineMatrix const& matrix2) {
+		return matrix1.Equals(matrix2);
+	}
+
+	constexpr bool operator!= (AffineMatrix const& matrix1, AffineMatrix const& matrix2) {
+		return !matrix1.Equals(matrix2);
+	}
+
+	constexpr AffineMatrix AffineMatrix::Identity() {
+		return AffineMatrix(1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0);
+	}
+
+	constexpr AffineMatrix AffineMatrix::Multiply(AffineMatrix const& matrix1, AffineMatrix const& matrix2) {
+		return AffineMatrix(
+			(matrix1.M11 * matrix2.M11) + (matrix1.M12 * matrix2.M21) + (matrix1.M13 * matrix2.M31),
+			(matrix1.M11 * matrix2.M12) + (matrix1.M12 * matrix2.M22) + (matrix1.M13 * matrix2.M32),
+			(matrix1.M11 * matrix2.M13) + (matrix1.M12 * matrix2.M23) + (matrix1.M13 * matrix2.M33),
+			(matrix1.M21 * matrix2.M11) + (matrix1.M22 * matrix2.M21) + (matrix1.M23 * matrix2.M31),
+			(matrix1.M21 * matrix2.M12) + (matrix1.M22 * matrix2.M22) + (matrix1.M23 * matrix2.M32),
+			(matrix1.M21 * matrix2.M13) + (matrix1.M22 * matrix2.M23) + (matrix1.M23 * matrix2.M33),
+			(matrix1.M31 * matrix2.M11) + (matrix1.M32 * matrix2.M21) + (matrix1.M33 * matrix2.M31),
+			(matrix1.M31 * matrix2.M12) + (matrix1.M32 * matrix2.M22) + (matrix1.M33 * matrix2.M32),
+			(matrix1.M31 * matrix2.M13) + (matrix1.M32 * matrix2.M23) + (matrix1.M33 * matrix2.M33),
+			(matrix1.M41 * matrix2.M11) + (matrix1.M42 * matrix2.M21) + (matrix1.M43 * matrix2.M31) + matrix2.M41,
+			(matrix1.M41 * matrix2.M12) + (matrix1.M42 * matrix2.M22) + (matrix1.M43 * matrix2.M32) + matrix2.M42,
+			(matrix1.M41 * matrix2.M13) + (matrix1.M42 * matrix2.M23) + (matrix1.M43 * matrix2.M33) + matrix2.M43);
+	}
+
+	constexpr Vector3 AffineMatrix::Transform(Vector3 const& position, AffineMatrix const& matrix) {
+		return Vector3(
+			(position.X * matrix.M11) + (position.Y * matrix.M21) + (position.Z * matrix.M31) + matrix.M41,
+			(position.X * matrix.M12) + (position.Y * matrix.M22) + (position.Z * matrix.M32) + matrix.M42,
+			(position.X * matrix.M13) + (position.Y * matrix.M23) + (position.Z * matrix.M33) + matrix.M43);
+	}
+
+	constexpr Vector3 AffineMatrix::TransformNormal(Vector3 const& normal, AffineMatrix const& matrix) {
+		return Vector3(
+			(normal.X * matrix.M11) + (normal.Y * matrix.M21) + (normal.Z * matrix.M31),
+			(normal.X * matrix.M12) + (normal.Y * matrix.M22) + (normal.Z * matrix.M32),
+			(normal.X * matrix.M13) + (normal.Y * matrix.M23) + (normal.Z * matrix.M33));
+	}
+
+	constexpr Vector3 AffineMatrix::Translation() const {
+		return Vector3(M41, M42, M43);
+	}
+
+	constexpr double AffineMatrix::Determinant() const {
+		return M11 * (M22 * M33 - M23 * M32)
+			- M12 * (M21 * M33 - M23 * M31)
+			+ M13 * (M21 * M32 - M22 * M31);
+	}
+
+	constexpr Matrix AffineMatrix::ToMatrix() const {
+		return Matrix(
+			M11, M12, M13, 0,
+			M21, M22, M23, 0,
+			M31, M32, M33, 0,
+			M41, M42, M43, 1);
+	}
+
+	constexpr bool AffineMatrix::Equals(AffineMatrix const& other) const {
+		return (M11 == other.M11) && (M12 == other.M12) && (M13 == other.M13)
+			&& (M21 == other.M21) && (M22 == other.M22) && (M23 == other.M23)
+			&& (M31 == other.M31) && (M32 == other.M32) && (M33 == other.M33)
+			&& (M41 == other.M41) && (M42 == other.M42) && (M43 == other.M43);
+	}
 }
 
 #endif
\ No newline at end of file
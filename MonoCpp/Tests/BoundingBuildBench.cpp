@@ -0,0 +1,115 @@
+// Times the bounding volume builders over a mesh-sized point cloud in points per second: the array
+// and Vector3Stream versions of BoundingBox::CreateFromPoints and of BoundingSphere::CreateFromPoints
+// in both fits. Each box must equal the componentwise bounds and each sphere must enclose every point.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Space3d.h"
+#include "Streams.h"
+
+// Large enough for the stream builders to split across threads.
+static constexpr size_t Count = 1 << 21;
+static constexpr i32 Rounds = 10;
+
+static volatile double sink;
+static i32 failures = 0;
+
+// Returns the best throughput of all rounds, in points per second.
+template <typename F>
+static double pointsPerSecond(F const& body) {
+	double best = 0;
+
+	for (i32 round = 0; round < Rounds; ++round) {
+		const auto start = std::chrono::steady_clock::now();
+		body();
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::fmax(best, Count / elapsed.count());
+	}
+
+	return best;
+}
+
+static void checkBox(const char* name, Xna::BoundingBox const& box, Xna::BoundingBox const& expected, double throughput) {
+	std::printf("%-30s %8.1f Mpoints/s\n", name, throughput / 1e6);
+
+	if (box.Min != expected.Min || box.Max != expected.Max) {
+		std::printf("%-30s FAILED: the box differs from the componentwise bounds\n", name);
+		++failures;
+	}
+}
+
+static void checkSphere(const char* name, Xna::BoundingSphere const& sphere, std::vector<Xna::Vector3> const& points, double throughput) {
+	std::printf("%-30s %8.1f Mpoints/s  radius %.4f\n", name, throughput / 1e6, sphere.Radius);
+
+	for (size_t i = 0; i < points.size(); ++i) {
+		if (Xna::Vector3::Distance(points[i], sphere.Center) > sphere.Radius * (1 + 1e-12)) {
+			std::printf("%-30s FAILED: point %zu is outside the sphere\n", name, i);
+			++failures;
+			return;
+		}
+	}
+}
+
+int main() {
+	std::mt19937 random(31);
+	std::normal_distribution<double> coordinate(0, 1);
+	std::vector<Xna::Vector3> points(Count);
+	Xna::Vector3Stream stream(Count);
+
+	// A blob stretched along x, like an elongated mesh.
+	for (size_t i = 0; i < Count; ++i) {
+		points[i] = Xna::Vector3(3 * coordinate(random), coordinate(random), 0.5 * coordinate(random));
+		stream.Set(i, points[i]);
+	}
+
+	Xna::BoundingBox expected(points[0], points[0]);
+
+	for (size_t i = 1; i < Count; ++i) {
+		expected.Min = Xna::Vector3::Min(expected.Min, points[i]);
+		expected.Max = Xna::Vector3::Max(expected.Max, points[i]);
+	}
+
+	Xna::BoundingBox box;
+	Xna::BoundingSphere sphere;
+	double throughput;
+
+	throughput = pointsPerSecond([&] {
+		box = Xna::BoundingBox::CreateFromPoints(points.data(), points.size());
+		sink = box.Max.X;
+	});
+	checkBox("BoundingBox array", box, expected, throughput);
+
+	throughput = pointsPerSecond([&] {
+		box = Xna::BoundingBox::CreateFromPoints(stream);
+		sink = box.Max.X;
+	});
+	checkBox("BoundingBox stream", box, expected, throughput);
+
+	throughput = pointsPerSecond([&] {
+		sphere = Xna::BoundingSphere::CreateFromPoints(points.data(), points.size(), Xna::BoundingSphereFit::Fast);
+		sink = sphere.Radius;
+	});
+	checkSphere("BoundingSphere array fast", sphere, points, throughput);
+
+	throughput = pointsPerSecond([&] {
+		sphere = Xna::BoundingSphere::CreateFromPoints(points.data(), points.size(), Xna::BoundingSphereFit::Tight);
+		sink = sphere.Radius;
+	});
+	checkSphere("BoundingSphere array tight", sphere, points, throughput);
+
+	throughput = pointsPerSecond([&] {
+		sphere = Xna::BoundingSphere::CreateFromPoints(stream, Xna::BoundingSphereFit::Fast);
+		sink = sphere.Radius;
+	});
+	checkSphere("BoundingSphere stream fast", sphere, points, throughput);
+
+	throughput = pointsPerSecond([&] {
+		sphere = Xna::BoundingSphere::CreateFromPoints(stream, Xna::BoundingSphereFit::Tight);
+		sink = sphere.Radius;
+	});
+	checkSphere("BoundingSphere stream tight", sphere, points, throughput);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+// Times BoundingSphere::CreateFromPoints, BoundingBox::CreateFromPoints and a loop of Vector3 operators,
+// which make a few math calls per point. Build it with and without MONOCPP_UNITY_BUILD and compare
+// the timings to see the call overhead the unity build removes.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Space3d.h"
+
+static constexpr size_t Count = 1 << 16;
+static constexpr i32 Rounds = 50;
+
+static volatile double sink;
+
+// Returns the best time of all rounds, in nanoseconds per point.
+template <typename F>
+static double nanosecondsPerPoint(F const& body) {
+	double best = 1e300;
+
+	for (i32 round = 0; round < Rounds; ++round) {
+		const auto start = std::chrono::steady_clock::now();
+		body();
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::fmin(best, elapsed.count() / Count);
+	}
+
+	return best;
+}
+
+int main() {
+	std::mt19937 random(29);
+	std::uniform_real_distribution<double> coordinate(-1000, 1000);
+	std::vector<Xna::Vector3> points(Count);
+
+	for (size_t i = 0; i < Count; ++i)
+		points[i] = Xna::Vector3(coordinate(random), coordinate(random), coordinate(random));
+
+	Xna::BoundingSphere sphere;
+	Xna::BoundingBox box;
+	double minX = 1e300, minY = 1e300, minZ = 1e300;
+	double maxX = -1e300, maxY = -1e300, maxZ = -1e300;
+
+	const double sphereTime = nanosecondsPerPoint([&] {
+		sphere = Xna::BoundingSphere::CreateFromPoints(points.data(), points.size());
+		sink = sphere.Radius;
+	});
+
+	const double boxTime = nanosecondsPerPoint([&] {
+		box = Xna::BoundingBox::CreateFromPoints(points.data(), points.size());
+		sink = box.Max.X;
+	});
+
+	const double operatorTime = nanosecondsPerPoint([&] {
+		Xna::Vector3 sum;
+		double squares = 0;
+
+		for (size_t i = 0; i < Count; ++i) {
+			sum = sum + points[i];
+			squares += Xna::Vector3::Dot(points[i], points[i]);
+		}
+
+		sink = sum.X + squares;
+	});
+
+	std::printf("BoundingSphere::CreateFromPoints  %6.2f ns/point\n", sphereTime);
+	std::printf("BoundingBox::CreateFromPoints     %6.2f ns/point\n", boxTime);
+	std::printf("Vector3 operator+ and Dot         %6.2f ns/point\n", operatorTime);
+
+	for (size_t i = 0; i < Count; ++i) {
+		minX = std::fmin(minX, points[i].X);
+		minY = std::fmin(minY, points[i].Y);
+		minZ = std::fmin(minZ, points[i].Z);
+		maxX = std::fmax(maxX, points[i].X);
+		maxY = std::fmax(maxY, points[i].Y);
+		maxZ = std::fmax(maxZ, points[i].Z);
+	}
+
+	i32 failures = 0;
+
+	if (box.Min != Xna::Vector3(minX, minY, minZ) || box.Max != Xna::Vector3(maxX, maxY, maxZ)) {
+		std::printf("BoundingBox::CreateFromPoints FAILED: the box differs from the componentwise bounds\n");
+		++failures;
+	}
+
+	for (size_t i = 0; i < Count; ++i) {
+		if (Xna::Vector3::Distance(points[i], sphere.Center) > sphere.Radius * (1 + 1e-12)) {
+			std::printf("BoundingSphere::CreateFromPoints FAILED: point %zu is outside the sphere\n", i);
+			++failures;
+			break;
+		}
+	}
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,173 @@
+// Checks the MathHelper::Fast* functions against <cmath> over random inputs, asserting the error
+// bounds stated in MathHelper.h and the special values, and times their array versions against
+// the same loops over std::sin, 1 / std::sqrt, std::sqrt and std::atan2.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include "MathHelper.h"
+
+static constexpr size_t Count = 1 << 20;
+static constexpr i32 Rounds = 20;
+static constexpr double Infinity = std::numeric_limits<double>::infinity();
+
+static volatile double sink;
+static i32 failures = 0;
+
+static void check(const char* name, double error, double bound) {
+	std::printf("%-22s max error %.3g, bound %.3g\n", name, error, bound);
+
+	if (!(error <= bound)) {
+		std::printf("%-22s FAILED\n", name);
+		++failures;
+	}
+}
+
+static void expect(const char* name, double value, double expected) {
+	const bool same = std::isnan(expected) ? std::isnan(value) : (value == expected && std::signbit(value) == std::signbit(expected));
+
+	if (!same) {
+		std::printf("%-22s FAILED: %g instead of %g\n", name, value, expected);
+		++failures;
+	}
+}
+
+// Returns the best time of all rounds, in nanoseconds per value.
+template <typename F>
+static double nanosecondsPerValue(F const& body) {
+	double best = 1e300;
+
+	for (i32 round = 0; round < Rounds; ++round) {
+		const auto start = std::chrono::steady_clock::now();
+		body();
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::fmin(best, elapsed.count() / Count);
+	}
+
+	return best;
+}
+
+int main() {
+	std::mt19937 random(27);
+	std::uniform_real_distribution<double> angle(-1e5, 1e5);
+	std::uniform_real_distribution<double> exponent(-1074, 1023);
+	std::uniform_real_distribution<double> mantissa(1, 2);
+	std::uniform_real_distribution<double> coordinate(-1e3, 1e3);
+
+	std::vector<double> angles(Count);
+	std::vector<double> positives(Count);
+	std::vector<double> lengths(Count);
+	std::vector<double> y(Count);
+	std::vector<double> x(Count);
+	std::vector<double> fast;
+	std::vector<double> exact(Count);
+
+	for (size_t i = 0; i < Count; ++i) {
+		angles[i] = angle(random);
+		// Spread over every binade, subnormals included.
+		positives[i] = std::ldexp(mantissa(random), static_cast<i32>(exponent(random)));
+		// What lengths and distances look like. Subnormals are left out of the timings: both sides stall on them.
+		lengths[i] = std::ldexp(mantissa(random), static_cast<i32>(exponent(random)) / 32);
+		y[i] = coordinate(random);
+		x[i] = coordinate(random);
+	}
+
+	double error;
+
+	Xna::MathHelper::FastSin(angles, fast);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, std::fabs(fast[i] - std::sin(angles[i])));
+	check("FastSin absolute", error, 5.3e-12);
+
+	Xna::MathHelper::FastCos(angles, fast);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, std::fabs(fast[i] - std::cos(angles[i])));
+	check("FastCos absolute", error, 5.3e-12);
+
+	Xna::MathHelper::FastRsqrt(positives, fast);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i) {
+		const double reference = 1 / std::sqrt(positives[i]);
+		error = std::fmax(error, std::fabs(fast[i] - reference) / reference);
+	}
+	check("FastRsqrt relative", error, 2.3e-16);
+
+	Xna::MathHelper::FastSqrt(positives, fast);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i) {
+		const double reference = std::sqrt(positives[i]);
+		error = std::fmax(error, std::fabs(fast[i] - reference) / reference);
+	}
+	check("FastSqrt relative", error, 0);
+
+	Xna::MathHelper::FastAtan2(y, x, fast);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, std::fabs(fast[i] - std::atan2(y[i], x[i])));
+	check("FastAtan2 absolute", error, 9e-10);
+
+	expect("FastRsqrt(+0)", Xna::MathHelper::FastRsqrt(0.0), Infinity);
+	expect("FastRsqrt(-0)", Xna::MathHelper::FastRsqrt(-0.0), -Infinity);
+	expect("FastRsqrt(+inf)", Xna::MathHelper::FastRsqrt(Infinity), 0);
+	expect("FastRsqrt(-1)", Xna::MathHelper::FastRsqrt(-1), std::nan(""));
+	expect("FastSqrt(+0)", Xna::MathHelper::FastSqrt(0.0), 0.0);
+	expect("FastSqrt(+inf)", Xna::MathHelper::FastSqrt(Infinity), Infinity);
+	expect("FastSqrt(-1)", Xna::MathHelper::FastSqrt(-1), std::nan(""));
+	expect("FastSqrt(nan)", Xna::MathHelper::FastSqrt(std::nan("")), std::nan(""));
+
+	for (const double zeroY : { 0.0, -0.0 }) {
+		for (const double zeroX : { 0.0, -0.0 })
+			expect("FastAtan2(zero, zero)", Xna::MathHelper::FastAtan2(zeroY, zeroX), std::atan2(zeroY, zeroX));
+
+		expect("FastAtan2(zero, -1)", Xna::MathHelper::FastAtan2(zeroY, -1), std::atan2(zeroY, -1));
+		expect("FastAtan2(zero, 1)", Xna::MathHelper::FastAtan2(zeroY, 1), std::atan2(zeroY, 1));
+	}
+
+	std::printf("\n                       <cmath>     fast\n");
+
+	const auto compare = [](const char* name, double reference, double approximation) {
+		std::printf("%-22s %6.2f ns  %6.2f ns  x%.2f\n", name, reference, approximation, reference / approximation);
+	};
+
+	compare("Sin", nanosecondsPerValue([&] {
+		for (size_t i = 0; i < Count; ++i)
+			exact[i] = std::sin(angles[i]);
+		sink = exact[Count - 1];
+	}), nanosecondsPerValue([&] {
+		Xna::MathHelper::FastSin(angles, fast);
+		sink = fast[Count - 1];
+	}));
+
+	compare("Rsqrt", nanosecondsPerValue([&] {
+		for (size_t i = 0; i < Count; ++i)
+			exact[i] = 1 / std::sqrt(lengths[i]);
+		sink = exact[Count - 1];
+	}), nanosecondsPerValue([&] {
+		Xna::MathHelper::FastRsqrt(lengths, fast);
+		sink = fast[Count - 1];
+	}));
+
+	compare("Sqrt", nanosecondsPerValue([&] {
+		for (size_t i = 0; i < Count; ++i)
+			exact[i] = std::sqrt(lengths[i]);
+		sink = exact[Count - 1];
+	}), nanosecondsPerValue([&] {
+		Xna::MathHelper::FastSqrt(lengths, fast);
+		sink = fast[Count - 1];
+	}));
+
+	compare("Atan2", nanosecondsPerValue([&] {
+		for (size_t i = 0; i < Count; ++i)
+			exact[i] = std::atan2(y[i], x[i]);
+		sink = exact[Count - 1];
+	}), nanosecondsPerValue([&] {
+		Xna::MathHelper::FastAtan2(y, x, fast);
+		sink = fast[Count - 1];
+	}));
+
+	return failures == 0 ? 0 : 1;
+}
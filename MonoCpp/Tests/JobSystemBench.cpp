@@ -0,0 +1,68 @@
+// Times JobSystem::For over a batch of slerps and rotations with 1 to N threads, N being the
+// hardware threads, and checks that every thread count gives the serial results.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include "JobSystem.h"
+#include "Parallel.h"
+#include "Structs.h"
+
+static constexpr size_t Count = 1 << 18;
+static constexpr i32 Rounds = 10;
+
+int main() {
+	std::mt19937 random(41);
+	std::uniform_real_distribution<double> component(-1, 1);
+
+	std::vector<Xna::Quaternion> first(Count);
+	std::vector<Xna::Quaternion> second(Count);
+	std::vector<Xna::Vector3> points(Count);
+	std::vector<Xna::Vector3> expected(Count);
+	std::vector<Xna::Vector3> result(Count);
+
+	for (size_t i = 0; i < Count; ++i) {
+		first[i] = Xna::Quaternion::Normalize(Xna::Quaternion(component(random), component(random), component(random), component(random)));
+		second[i] = Xna::Quaternion::Normalize(Xna::Quaternion(component(random), component(random), component(random), component(random)));
+		points[i] = Xna::Vector3(component(random), component(random), component(random));
+	}
+
+	const auto body = [&](size_t, size_t begin, size_t end) {
+		for (size_t i = begin; i < end; ++i)
+			result[i] = Xna::Vector3::Transform(points[i], Xna::Quaternion::Slerp(first[i], second[i], 0.25));
+	};
+
+	const size_t threads = std::max<size_t>(2, std::thread::hardware_concurrency());
+	double serial = 0;
+	i32 failures = 0;
+
+	std::printf("threads  ms      speedup\n");
+
+	for (size_t count = 1; count <= threads; ++count) {
+		Xna::JobSystem jobs(count - 1);
+		double best = 1e300;
+
+		for (i32 round = 0; round < Rounds; ++round) {
+			const auto start = std::chrono::steady_clock::now();
+			jobs.For(Count, Xna::Parallel::DefaultChunkSize, body);
+			const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+			best = std::fmin(best, elapsed.count());
+		}
+
+		if (count == 1) {
+			serial = best;
+			expected = result;
+		}
+		else if (result != expected) {
+			std::printf("%zu threads FAILED: the results differ from one thread\n", count);
+			++failures;
+		}
+
+		std::printf("%7zu  %6.2f  x%.2f\n", count, best, serial / best);
+	}
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+// Checks that a cached LineOfSight answer is dropped by a change in a cell its segment crosses and kept
+// through changes elsewhere in the box the segment spans, and that cached and traced answers match
+// a test against every occluder while occluders move, including segments leaving the world.
+
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "LineOfSight.h"
+#include "MathHelper.h"
+
+static i32 failures = 0;
+
+static void expect(const char* name, bool passed) {
+	if (!passed) {
+		std::printf("%s FAILED\n", name);
+		++failures;
+	}
+}
+
+static bool clear(std::vector<Xna::BoundingBox> const& boxes, Xna::Vector3 const& from, Xna::Vector3 const& to) {
+	const Xna::Ray ray(from, to - from);
+
+	for (Xna::BoundingBox const& box : boxes) {
+		const double t = ray.Intersects(box);
+
+		if (!Xna::MathHelper::IsNan(t) && t <= 1.0)
+			return false;
+	}
+
+	return true;
+}
+
+static Xna::BoundingBox around(Xna::Vector3 const& center, double extent) {
+	return Xna::BoundingBox(center - Xna::Vector3(extent, extent, extent), center + Xna::Vector3(extent, extent, extent));
+}
+
+int main() {
+	// 16 cells of 4 along each axis.
+	Xna::LineOfSight sight(Xna::BoundingBox(Xna::Vector3(0, 0, 0), Xna::Vector3(64, 64, 64)), 4, 0.01);
+
+	// The diagonal spans the whole grid, but crosses few of its cells.
+	const Xna::Vector3 from(2, 2, 2);
+	const Xna::Vector3 to(62, 62, 62);
+	const Xna::Vector3 onPath(30, 30, 30);
+	const Xna::Vector3 offPath(58, 6, 30);
+
+	expect("empty world is clear", sight.Query(from, to));
+	expect("first query is traced", sight.Misses() == 1 && sight.Hits() == 0);
+	expect("second query is cached", sight.Query(from, to) && sight.Hits() == 1);
+
+	sight.Invalidate(around(offPath, 0.5));
+	expect("invalidating off the path keeps the answer", sight.Query(from, to) && sight.Hits() == 2 && sight.Misses() == 1);
+
+	sight.Invalidate(around(onPath, 0.5));
+	expect("invalidating on the path drops the answer", sight.Query(from, to) && sight.Hits() == 2 && sight.Misses() == 2);
+
+	const u32 aside = sight.AddOccluder(around(offPath, 1));
+	expect("occluder off the path keeps the answer", sight.Query(from, to) && sight.Hits() == 3 && sight.Misses() == 2);
+	expect("reversed pair shares the answer", sight.Query(to, from) && sight.Hits() == 4);
+
+	const u32 wall = sight.AddOccluder(around(onPath, 1));
+	expect("occluder on the path blocks", !sight.Query(from, to) && sight.Misses() == 3);
+	expect("blocked answer is cached", !sight.Query(from, to) && sight.Hits() == 5);
+
+	sight.MoveOccluder(aside, around(offPath + Xna::Vector3(0, 4, 0), 1));
+	expect("moving an occluder off the path keeps the block", !sight.Query(from, to) && sight.Hits() == 6 && sight.Misses() == 3);
+
+	sight.RemoveOccluder(wall);
+	expect("removing the blocker clears", sight.Query(from, to) && sight.Misses() == 4);
+
+	// Random occluders and segments, some with endpoints outside the world, against the brute-force answer.
+	std::mt19937 random(40);
+	std::uniform_real_distribution<double> position(-8, 72);
+	std::uniform_real_distribution<double> extent(0.5, 6);
+
+	auto randomBox = [&]() {
+		const Xna::Vector3 center(position(random), position(random), position(random));
+		const Xna::Vector3 half(extent(random), extent(random), extent(random));
+		return Xna::BoundingBox(center - half, center + half);
+	};
+
+	sight.RemoveOccluder(aside);
+	std::vector<Xna::BoundingBox> boxes;
+	std::vector<u32> ids;
+
+	for (i32 i = 0; i < 60; ++i) {
+		boxes.push_back(randomBox());
+		ids.push_back(sight.AddOccluder(boxes.back()));
+	}
+
+	std::vector<Xna::SightQuery> queries;
+
+	for (i32 i = 0; i < 2000; ++i) {
+		queries.push_back(Xna::SightQuery{
+			Xna::Vector3(position(random), position(random), position(random)),
+			Xna::Vector3(position(random), position(random), position(random)) });
+	}
+
+	// Some segments stay inside one cell or run along an axis.
+	queries.push_back(Xna::SightQuery{ Xna::Vector3(9, 9, 9), Xna::Vector3(10, 11, 9.5) });
+	queries.push_back(Xna::SightQuery{ Xna::Vector3(-6, 20, 20), Xna::Vector3(70, 20, 20) });
+	queries.push_back(Xna::SightQuery{ Xna::Vector3(33, -5, 41), Xna::Vector3(33, 69, 41) });
+
+	std::vector<byte> result;
+	i32 wrong = 0;
+
+	for (i32 round = 0; round < 30; ++round) {
+		for (i32 m = 0; m < 3; ++m) {
+			const size_t k = random() % boxes.size();
+			boxes[k] = randomBox();
+			sight.MoveOccluder(ids[k], boxes[k]);
+		}
+
+		sight.Query(queries, result);
+
+		for (size_t i = 0; i < queries.size(); ++i) {
+			const bool expected = clear(boxes, queries[i].From, queries[i].To);
+			wrong += (result[i] != 0) != expected;
+			wrong += sight.Query(queries[i].To, queries[i].From) != expected;
+			wrong += sight.Trace(queries[i].From, queries[i].To) != expected;
+		}
+	}
+
+	std::printf("random segments: %d wrong, %llu hits, %llu misses\n", wrong,
+		static_cast<unsigned long long>(sight.Hits()), static_cast<unsigned long long>(sight.Misses()));
+	expect("random segments match the brute-force answer", wrong == 0);
+	expect("random segments reuse cached answers", sight.Hits() > sight.Misses());
+
+	return failures == 0 ? 0 : 1;
+}
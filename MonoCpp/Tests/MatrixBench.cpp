@@ -0,0 +1,140 @@
+// Times building a world matrix with Matrix::CreateFromTRS and AffineMatrix::CreateFromTRS against
+// the product of scale, rotation and translation matrices, and the affine multiply and invert
+// against the 4x4 ones, checking that each pair gives the same matrices.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Structs.h"
+
+static constexpr size_t Count = 4096;
+static constexpr i32 Rounds = 200;
+static constexpr double Tolerance = 1e-9;
+
+static volatile double sink;
+static i32 failures = 0;
+
+// Returns the best time of all rounds, in nanoseconds per matrix.
+template <typename F>
+static double nanosecondsPerMatrix(F const& body) {
+	double best = 1e300;
+
+	for (i32 round = 0; round < Rounds; ++round) {
+		const auto start = std::chrono::steady_clock::now();
+		body();
+		const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::fmin(best, elapsed.count() / Count);
+	}
+
+	return best;
+}
+
+static double errorOf(Xna::Matrix const& a, Xna::Matrix const& b) {
+	const std::vector<double> x = Xna::Matrix::ToDoubleArray(a);
+	const std::vector<double> y = Xna::Matrix::ToDoubleArray(b);
+	double error = 0;
+
+	for (size_t i = 0; i < x.size(); ++i)
+		error = std::fmax(error, std::fabs(x[i] - y[i]) / std::fmax(1.0, std::fabs(y[i])));
+
+	return error;
+}
+
+static void report(const char* name, double reference, double fused, double error) {
+	std::printf("%-10s %7.2f ns  %7.2f ns  x%.2f  max error %.3g\n", name, reference, fused, reference / fused, error);
+
+	if (!(error <= Tolerance)) {
+		std::printf("%-10s FAILED, tolerance %.3g\n", name, Tolerance);
+		++failures;
+	}
+}
+
+int main() {
+	std::mt19937 random(36);
+	std::uniform_real_distribution<double> component(-1, 1);
+	std::uniform_real_distribution<double> scale(0.5, 2);
+
+	std::vector<Xna::Vector3> translations(Count);
+	std::vector<Xna::Quaternion> rotations(Count);
+	std::vector<Xna::Vector3> scales(Count);
+
+	for (size_t i = 0; i < Count; ++i) {
+		translations[i] = Xna::Vector3(component(random), component(random), component(random)) * 100;
+		rotations[i] = Xna::Quaternion::Normalize(Xna::Quaternion(component(random), component(random), component(random), component(random)));
+		scales[i] = Xna::Vector3(scale(random), scale(random), scale(random));
+	}
+
+	std::vector<Xna::Matrix> multiplied(Count);
+	std::vector<Xna::Matrix> fused(Count);
+	std::vector<Xna::AffineMatrix> affine(Count);
+	std::vector<Xna::Matrix> products(Count);
+	std::vector<Xna::AffineMatrix> affineProducts(Count);
+	double error;
+
+	std::printf("           4x4         fused/affine\n");
+
+	const double multipliedTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			multiplied[i] = Xna::Matrix::CreateScale(scales[i]) * Xna::Matrix::CreateFromQuaternion(rotations[i]) * Xna::Matrix::CreateTranslation(translations[i]);
+		sink = multiplied[Count - 1].M41;
+	});
+
+	const double fusedTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			fused[i] = Xna::Matrix::CreateFromTRS(translations[i], rotations[i], scales[i]);
+		sink = fused[Count - 1].M41;
+	});
+
+	const double affineTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			affine[i] = Xna::AffineMatrix::CreateFromTRS(translations[i], rotations[i], scales[i]);
+		sink = affine[Count - 1].M41;
+	});
+
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(fused[i], multiplied[i]));
+	report("TRS", multipliedTime, fusedTime, error);
+
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(affine[i].ToMatrix(), multiplied[i]));
+	report("TRS affine", multipliedTime, affineTime, error);
+
+	const double multiplyTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			products[i] = Xna::Matrix::Multiply(multiplied[i], multiplied[Count - 1 - i]);
+		sink = products[Count - 1].M41;
+	});
+
+	const double affineMultiplyTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			affineProducts[i] = Xna::AffineMatrix::Multiply(affine[i], affine[Count - 1 - i]);
+		sink = affineProducts[Count - 1].M41;
+	});
+
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(affineProducts[i].ToMatrix(), products[i]));
+	report("Multiply", multiplyTime, affineMultiplyTime, error);
+
+	const double invertTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			products[i] = Xna::Matrix::Invert(multiplied[i]);
+		sink = products[Count - 1].M41;
+	});
+
+	const double affineInvertTime = nanosecondsPerMatrix([&] {
+		for (size_t i = 0; i < Count; ++i)
+			affineProducts[i] = Xna::AffineMatrix::Invert(affine[i]);
+		sink = affineProducts[Count - 1].M41;
+	});
+
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(affineProducts[i].ToMatrix(), products[i]));
+	report("Invert", invertTime, affineInvertTime, error);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+// Checks OrientedBoundingBox::Intersects between boxes: separated, touching and overlapping pairs on face
+// axes, a pair that only a cross product of edge directions separates, nearly parallel boxes, whose edge
+// cross products degenerate, and random pairs against a separating axis test on the projected corners.
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "MathHelper.h"
+#include "Space3d.h"
+
+static i32 failures = 0;
+
+static void expect(const char* name, bool passed) {
+	if (!passed) {
+		std::printf("%s FAILED\n", name);
+		++failures;
+	}
+}
+
+// Tests both orders, which must agree.
+static bool intersects(Xna::OrientedBoundingBox const& a, Xna::OrientedBoundingBox const& b) {
+	const bool ab = a.Intersects(b);
+
+	if (ab != b.Intersects(a)) {
+		std::printf("order of the boxes FAILED\n");
+		++failures;
+	}
+
+	return ab;
+}
+
+static Xna::OrientedBoundingBox cube(Xna::Vector3 const& center, Xna::Quaternion const& orientation) {
+	return Xna::OrientedBoundingBox(center, Xna::Vector3(1, 1, 1), orientation);
+}
+
+// The gap between the projections of the corners on an axis: positive when the axis separates them.
+static double gapOn(std::vector<Xna::Vector3> const& cornersA, std::vector<Xna::Vector3> const& cornersB, Xna::Vector3 const& axis) {
+	const Xna::Vector3 direction = Xna::Vector3::Normalize(axis);
+	double minA = 1e300, maxA = -1e300, minB = 1e300, maxB = -1e300;
+
+	for (i32 k = 0; k < Xna::OrientedBoundingBox::CornerCount; ++k) {
+		const double pa = Xna::Vector3::Dot(cornersA[k], direction);
+		const double pb = Xna::Vector3::Dot(cornersB[k], direction);
+		minA = std::fmin(minA, pa);
+		maxA = std::fmax(maxA, pa);
+		minB = std::fmin(minB, pb);
+		maxB = std::fmax(maxB, pb);
+	}
+
+	return std::fmax(minB - maxA, minA - maxB);
+}
+
+// The largest gap on the 6 face axes, or with edges also on the 9 cross products of an edge of each box:
+// positive when an axis separates the boxes, negative by the least overlap otherwise.
+static double gap(Xna::OrientedBoundingBox const& a, Xna::OrientedBoundingBox const& b, bool edges) {
+	std::vector<Xna::Vector3> cornersA;
+	std::vector<Xna::Vector3> cornersB;
+	a.GetCorners(cornersA);
+	b.GetCorners(cornersB);
+
+	Xna::Vector3 axes[15];
+	a.GetAxes(axes[0], axes[1], axes[2]);
+	b.GetAxes(axes[3], axes[4], axes[5]);
+
+	for (i32 i = 0; i < 3; ++i)
+		for (i32 j = 0; j < 3; ++j)
+			axes[6 + i * 3 + j] = Xna::Vector3::Cross(axes[i], axes[3 + j]);
+
+	double largest = -1e300;
+
+	for (i32 i = 0; i < (edges ? 15 : 6); ++i) {
+		// Edges too close to parallel give no direction of their own.
+		if (axes[i].Length() < 1e-6)
+			continue;
+
+		largest = std::fmax(largest, gapOn(cornersA, cornersB, axes[i]));
+	}
+
+	return largest;
+}
+
+int main() {
+	const Xna::Quaternion identity = Xna::Quaternion::Identity();
+	const Xna::Vector3 unitY(0, 1, 0);
+	const Xna::Vector3 unitZ(0, 0, 1);
+	const Xna::OrientedBoundingBox origin = cube(Xna::Vector3(0, 0, 0), identity);
+
+	// Face axes of aligned cubes, whose faces meet at a distance of 2.
+	expect("aligned separated", !intersects(origin, cube(Xna::Vector3(2.001, 0, 0), identity)));
+	expect("aligned touching", intersects(origin, cube(Xna::Vector3(2, 0, 0), identity)));
+	expect("aligned overlapping", intersects(origin, cube(Xna::Vector3(1.999, 0.5, -0.5), identity)));
+	expect("aligned touching at a corner", intersects(origin, cube(Xna::Vector3(2, 2, 2), identity)));
+	expect("aligned separated past a corner", !intersects(origin, cube(Xna::Vector3(2, 2, 2.001), identity)));
+
+	// A face axis of a turned cube: its corner reaches sqrt(2) along x.
+	const Xna::Quaternion turnedZ = Xna::Quaternion::CreateFromAxisAngle(unitZ, Xna::MathHelper::PiOver4);
+	const double corner = 1 + std::sqrt(2.0);
+	expect("turned separated", !intersects(origin, cube(Xna::Vector3(corner + 1e-6, 0, 0), turnedZ)));
+	expect("turned touching", intersects(origin, cube(Xna::Vector3(corner - 1e-12, 0, 0), turnedZ)));
+	expect("turned overlapping", intersects(origin, cube(Xna::Vector3(corner - 0.1, 0.3, 0), turnedZ)));
+
+	// A cube turned about y points an edge along y at +x, one turned about z an edge along z at -x.
+	// The edges cross where the cubes first meet, so only y cross z, the x axis, separates the cubes
+	// when the centers are more than 2 sqrt(2) apart: every face axis still sees the cubes overlap.
+	const Xna::OrientedBoundingBox edgeA = cube(Xna::Vector3(0, 0, 0), Xna::Quaternion::CreateFromAxisAngle(unitY, Xna::MathHelper::PiOver4));
+	const double edges = 2 * std::sqrt(2.0);
+	const Xna::OrientedBoundingBox edgeSeparated = cube(Xna::Vector3(edges + 1e-6, 0, 0), turnedZ);
+	expect("edge axis is the only separating axis", gap(edgeA, edgeSeparated, true) > 0 && gap(edgeA, edgeSeparated, false) < 0);
+	expect("edge separated", !intersects(edgeA, edgeSeparated));
+	expect("edge touching", intersects(edgeA, cube(Xna::Vector3(edges - 1e-12, 0, 0), turnedZ)));
+	expect("edge overlapping", intersects(edgeA, cube(Xna::Vector3(edges - 0.01, 0, 0), turnedZ)));
+	expect("edge offset past the crossing", !intersects(edgeA, cube(Xna::Vector3(edges - 0.01, 0, 2.1), turnedZ)));
+
+	// Nearly parallel boxes: the cross products of their matching axes are almost zero and must
+	// neither separate overlapping boxes nor join separated ones.
+	for (double angle : { 1e-15, 1e-12, 1e-9, 1e-6 }) {
+		const Xna::Quaternion tilt = Xna::Quaternion::CreateFromAxisAngle(Xna::Vector3::Normalize(Xna::Vector3(1, 2, 3)), angle);
+		char name[64];
+
+		std::snprintf(name, sizeof(name), "nearly parallel by %g overlapping", angle);
+		expect(name, intersects(origin, cube(Xna::Vector3(1.5, 0.3, -1.2), tilt)));
+		std::snprintf(name, sizeof(name), "nearly parallel by %g barely overlapping", angle);
+		expect(name, intersects(origin, cube(Xna::Vector3(2 - 1e-5, 0, 0), tilt)));
+		std::snprintf(name, sizeof(name), "nearly parallel by %g separated", angle);
+		expect(name, !intersects(origin, cube(Xna::Vector3(2 + 1e-5, 0, 0), tilt)));
+		std::snprintf(name, sizeof(name), "nearly parallel by %g separated diagonally", angle);
+		expect(name, !intersects(origin, cube(Xna::Vector3(1.5, 2 + 1e-5, 1.5), tilt)));
+	}
+
+	// Random boxes against the corner projections, leaving out pairs within rounding of touching.
+	std::mt19937 random(48);
+	std::uniform_real_distribution<double> unit(-1, 1);
+	std::uniform_real_distribution<double> extent(0.1, 2);
+	i32 compared = 0;
+	i32 edgeOnly = 0;
+	i32 wrong = 0;
+
+	for (i32 i = 0; i < 200000; ++i) {
+		const Xna::OrientedBoundingBox a(Xna::Vector3(0, 0, 0), Xna::Vector3(extent(random), extent(random), extent(random)),
+			Xna::Quaternion::Normalize(Xna::Quaternion(unit(random), unit(random), unit(random), unit(random))));
+		const Xna::OrientedBoundingBox b(Xna::Vector3(3 * unit(random), 3 * unit(random), 3 * unit(random)),
+			Xna::Vector3(extent(random), extent(random), extent(random)),
+			Xna::Quaternion::Normalize(Xna::Quaternion(unit(random), unit(random), unit(random), unit(random))));
+
+		const double g = gap(a, b, true);
+
+		if (std::abs(g) < 1e-9)
+			continue;
+
+		++compared;
+		wrong += intersects(a, b) != (g < 0);
+		edgeOnly += g > 0 && gap(a, b, false) < 0;
+	}
+
+	std::printf("random pairs: %d compared, %d separated only by an edge axis, %d wrong\n", compared, edgeOnly, wrong);
+	expect("random pairs match the corner projections", wrong == 0);
+	expect("random pairs include edge axis separations", edgeOnly > 0);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,205 @@
+// Round-trips random values through the packed types and asserts the error bounds documented in
+// PackedVector.h, plus the binary16 edge cases: zeros, subnormals, overflow, infinity and NaN.
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <random>
+#include "PackedVector.h"
+
+static constexpr size_t Count = 1 << 18;
+static constexpr double Infinity = std::numeric_limits<double>::infinity();
+static constexpr double DegreesPerRadian = 57.295779513082320876798154814105;
+
+static i32 failures = 0;
+
+static void check(const char* name, double error, double bound) {
+	std::printf("%-30s max error %.4g, bound %.4g\n", name, error, bound);
+
+	if (!(error <= bound)) {
+		std::printf("%-30s FAILED\n", name);
+		++failures;
+	}
+}
+
+static void expect(const char* name, bool passed) {
+	if (!passed) {
+		std::printf("%-30s FAILED\n", name);
+		++failures;
+	}
+}
+
+static bool sameDouble(double a, double b) {
+	return a == b && std::signbit(a) == std::signbit(b);
+}
+
+static void checkHalfSingle(std::mt19937& random) {
+	std::uniform_real_distribution<double> mantissa(1, 2);
+	std::uniform_int_distribution<i32> normalExponent(-14, 15);
+	std::uniform_real_distribution<double> subnormal(-0x1p-14, 0x1p-14);
+	double relative = 0;
+	double absolute = 0;
+
+	for (size_t i = 0; i < Count; ++i) {
+		const double normal = std::ldexp(mantissa(random), normalExponent(random)) * (i % 2 == 0 ? 1 : -1);
+
+		if (std::fabs(normal) <= 65504)
+			relative = std::fmax(relative, std::fabs(Xna::HalfSingle::Unpack(Xna::HalfSingle::Pack(normal)) - normal) / std::fabs(normal));
+
+		const double small = subnormal(random);
+		absolute = std::fmax(absolute, std::fabs(Xna::HalfSingle::Unpack(Xna::HalfSingle::Pack(small)) - small));
+	}
+
+	check("HalfSingle normal relative", relative, 0x1p-11);
+	check("HalfSingle subnormal absolute", absolute, 0x1p-25);
+
+	expect("HalfSingle 1", Xna::HalfSingle::Pack(1.0) == 0x3C00);
+	expect("HalfSingle +0", Xna::HalfSingle::Pack(0.0) == 0x0000);
+	expect("HalfSingle -0", Xna::HalfSingle::Pack(-0.0) == 0x8000 && sameDouble(Xna::HalfSingle::Unpack(0x8000), -0.0));
+	expect("HalfSingle largest", Xna::HalfSingle::Pack(65504.0) == 0x7BFF && Xna::HalfSingle::Unpack(0x7BFF) == 65504.0);
+	expect("HalfSingle below overflow", Xna::HalfSingle::Pack(65519.0) == 0x7BFF);
+	expect("HalfSingle overflow", Xna::HalfSingle::Pack(65520.0) == 0x7C00 && Xna::HalfSingle::Pack(-1e10) == 0xFC00);
+	expect("HalfSingle smallest normal", Xna::HalfSingle::Pack(0x1p-14) == 0x0400 && Xna::HalfSingle::Unpack(0x0400) == 0x1p-14);
+	expect("HalfSingle largest subnormal", Xna::HalfSingle::Pack(0x3FFp-24) == 0x03FF && Xna::HalfSingle::Unpack(0x03FF) == 0x3FFp-24);
+	expect("HalfSingle smallest subnormal", Xna::HalfSingle::Pack(0x1p-24) == 0x0001 && Xna::HalfSingle::Unpack(0x0001) == 0x1p-24);
+	expect("HalfSingle tie to even zero", Xna::HalfSingle::Pack(0x1p-25) == 0x0000);
+	expect("HalfSingle above tie", Xna::HalfSingle::Pack(0x1.8p-25) == 0x0001);
+	expect("HalfSingle underflow", Xna::HalfSingle::Pack(-0x1p-30) == 0x8000);
+	expect("HalfSingle +infinity", Xna::HalfSingle::Pack(Infinity) == 0x7C00 && Xna::HalfSingle::Unpack(0x7C00) == Infinity);
+	expect("HalfSingle -infinity", Xna::HalfSingle::Pack(-Infinity) == 0xFC00 && Xna::HalfSingle::Unpack(0xFC00) == -Infinity);
+
+	const u16 nan = Xna::HalfSingle::Pack(std::numeric_limits<double>::quiet_NaN());
+	expect("HalfSingle NaN", (nan & 0x7C00) == 0x7C00 && (nan & 0x03FF) != 0 && std::isnan(Xna::HalfSingle::Unpack(nan)));
+}
+
+static void checkPackedQuaternion(std::mt19937& random) {
+	std::uniform_real_distribution<double> component(-1, 1);
+	std::uniform_real_distribution<double> jitter(-0.01, 0.01);
+	std::vector<Xna::Quaternion> values(Count);
+	std::vector<Xna::PackedQuaternion> packed;
+	std::vector<Xna::Quaternion> unpacked;
+
+	for (size_t i = 0; i < Count; ++i) {
+		// Every other one near the worst case of four components of about 0.5.
+		const double x = i % 2 == 0 ? component(random) : 0.5 + jitter(random);
+		const double y = i % 2 == 0 ? component(random) : -0.5 + jitter(random);
+		const double z = i % 2 == 0 ? component(random) : 0.5 + jitter(random);
+		const double w = i % 2 == 0 ? component(random) : 0.5 + jitter(random);
+		values[i] = Xna::Quaternion::Normalize(Xna::Quaternion(x, y, z, w));
+	}
+
+	Xna::PackedQuaternion::Pack(values, packed);
+	Xna::PackedQuaternion::Unpack(packed, unpacked);
+
+	double stored = 0;
+	double rebuilt = 0;
+	double degrees = 0;
+
+	for (size_t i = 0; i < Count; ++i) {
+		const Xna::Quaternion& a = values[i];
+		Xna::Quaternion b = unpacked[i];
+		const double dot = a.X * b.X + a.Y * b.Y + a.Z * b.Z + a.W * b.W;
+
+		// q and -q are the same rotation; compare with the one on the same side.
+		if (dot < 0)
+			b = Xna::Quaternion(-b.X, -b.Y, -b.Z, -b.W);
+
+		const double errors[4] = { std::fabs(a.X - b.X), std::fabs(a.Y - b.Y), std::fabs(a.Z - b.Z), std::fabs(a.W - b.W) };
+		const double magnitudes[4] = { std::fabs(a.X), std::fabs(a.Y), std::fabs(a.Z), std::fabs(a.W) };
+		size_t largest = 0;
+
+		for (size_t c = 1; c < 4; ++c) {
+			if (magnitudes[c] > magnitudes[largest])
+				largest = c;
+		}
+
+		for (size_t c = 0; c < 4; ++c) {
+			if (c == largest)
+				rebuilt = std::fmax(rebuilt, errors[c]);
+			else
+				stored = std::fmax(stored, errors[c]);
+		}
+
+		const double cosine = std::fabs(dot) / std::sqrt(b.LengthSquared());
+		degrees = std::fmax(degrees, 2 * std::acos(std::fmin(1.0, cosine)) * DegreesPerRadian);
+	}
+
+	check("PackedQuaternion stored", stored, 0.0007);
+	check("PackedQuaternion rebuilt", rebuilt, 0.0021);
+	check("PackedQuaternion degrees", degrees, 0.28);
+}
+
+static void checkPackedNormal(std::mt19937& random) {
+	std::normal_distribution<double> component(0, 1);
+	std::vector<Xna::Vector3> values(Count);
+	std::vector<Xna::PackedNormal> packed;
+	std::vector<Xna::Vector3> unpacked;
+
+	for (size_t i = 0; i < Count; ++i)
+		values[i] = Xna::Vector3::Normalize(Xna::Vector3(component(random), component(random), component(random)));
+
+	// The axes and the octahedron edges, where the fold meets.
+	values[0] = Xna::Vector3(0, 0, -1);
+	values[1] = Xna::Vector3(0, 0, 1);
+	values[2] = Xna::Vector3::Normalize(Xna::Vector3(1, -1, 0));
+
+	Xna::PackedNormal::Pack(values, packed);
+	Xna::PackedNormal::Unpack(packed, unpacked);
+
+	double degrees = 0;
+
+	for (size_t i = 0; i < Count; ++i) {
+		const double sine = Xna::Vector3::Cross(values[i], unpacked[i]).Length();
+		const double cosine = Xna::Vector3::Dot(values[i], unpacked[i]);
+		degrees = std::fmax(degrees, std::atan2(sine, cosine) * DegreesPerRadian);
+	}
+
+	check("PackedNormal degrees", degrees, 0.004);
+}
+
+static void checkPositionQuantizer(std::mt19937& random) {
+	const Xna::BoundingBox bounds(Xna::Vector3(-512, -8, 0), Xna::Vector3(512, 8, 4096));
+	std::uniform_real_distribution<double> unit(0, 1);
+
+	for (const i32 bits : { 10, 16, Xna::PositionQuantizer::MaxBitsPerAxis }) {
+		const Xna::PositionQuantizer quantizer(bounds, bits);
+		const Xna::Vector3 bound = quantizer.MaxError();
+		const Xna::Vector3 size = bounds.Max - bounds.Min;
+		std::vector<Xna::Vector3> positions(Count);
+		std::vector<u64> packed;
+		std::vector<Xna::Vector3> unpacked;
+
+		for (size_t i = 0; i < Count; ++i)
+			positions[i] = bounds.Min + Xna::Vector3(unit(random) * size.X, unit(random) * size.Y, unit(random) * size.Z);
+
+		positions[0] = bounds.Min;
+		positions[1] = bounds.Max;
+
+		quantizer.Pack(positions, packed);
+		quantizer.Unpack(packed, unpacked);
+
+		// The share of its bound each axis uses, which must stay at or below 1 up to rounding.
+		double share = 0;
+
+		for (size_t i = 0; i < Count; ++i) {
+			share = std::fmax(share, std::fabs(unpacked[i].X - positions[i].X) / bound.X);
+			share = std::fmax(share, std::fabs(unpacked[i].Y - positions[i].Y) / bound.Y);
+			share = std::fmax(share, std::fabs(unpacked[i].Z - positions[i].Z) / bound.Z);
+		}
+
+		char name[64];
+		std::snprintf(name, sizeof(name), "PositionQuantizer %d bits", bits);
+		check(name, share, 1 + 1e-6);
+	}
+}
+
+int main() {
+	std::mt19937 random(34);
+
+	checkHalfSingle(random);
+	checkPackedQuaternion(random);
+	checkPackedNormal(random);
+	checkPositionQuantizer(random);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+// Times ParticleEmitter::Update over a million particles, in particles per second, with few and with
+// half of the particles dying. After every update the live count must match the particles whose age
+// stays under their life, and the survivors must keep their order through the two-pass compaction.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include "ParticleEmitter.h"
+
+// Enough particles for Update to split into chunks on every thread.
+static constexpr size_t Count = 1 << 20;
+static constexpr i32 Rounds = 5;
+
+static i32 failures = 0;
+
+// Updates freshly emitted particles by elapsedSeconds, checking each round against the particles before it.
+static void run(const char* name, Xna::ParticleEmitter& emitter, double elapsedSeconds) {
+	Xna::ParticleStream before;
+	double best = 0;
+	size_t alive = 0;
+	size_t wrong = 0;
+
+	for (i32 round = 0; round < Rounds; ++round) {
+		emitter.Clear();
+		emitter.Emit(Count);
+		before = emitter.Particles();
+
+		const auto start = std::chrono::steady_clock::now();
+		emitter.Update(elapsedSeconds);
+		const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+		best = std::fmax(best, Count / elapsed.count());
+
+		// The survivors in the order of the particles before, each moved by its own velocity.
+		Xna::ParticleStream const& after = emitter.Particles();
+		size_t j = 0;
+
+		for (size_t i = 0; i < before.Count(); ++i) {
+			const double age = before.Age[i] + elapsedSeconds;
+
+			if (!(age < before.Life[i]))
+				continue;
+
+			if (j < after.Count()) {
+				const double vy = before.Velocity.Y[i] + emitter.Acceleration.Y * elapsedSeconds;
+				const double y = before.Position.Y[i] + vy * elapsedSeconds;
+
+				wrong += after.Life[j] != before.Life[i] || after.Age[j] != age
+					|| std::abs(after.Position.Y[j] - y) > 1e-12 || after.Velocity.Y[j] != vy;
+			}
+
+			++j;
+		}
+
+		alive = j;
+
+		if (after.Count() != j) {
+			std::printf("%-24s FAILED: %zu live particles, %zu expected\n", name, after.Count(), j);
+			++failures;
+			return;
+		}
+	}
+
+	std::printf("%-24s %8.1f Mparticles/s  %zu of %zu live\n", name, best / 1e6, alive, Count);
+
+	if (wrong != 0) {
+		std::printf("%-24s FAILED: %zu survivors out of order or wrongly moved\n", name, wrong);
+		++failures;
+	}
+}
+
+int main() {
+	Xna::Curve size;
+	size.Keys().Add(Xna::CurveKey(0, 1));
+	size.Keys().Add(Xna::CurveKey(1, 3));
+	Xna::Curve alpha;
+	alpha.Keys().Add(Xna::CurveKey(0, 1));
+	alpha.Keys().Add(Xna::CurveKey(1, 0));
+	// A constant speed, so a particle moves by its velocity times the elapsed time.
+	Xna::Curve speed;
+	speed.Keys().Add(Xna::CurveKey(0, 1));
+
+	Xna::ParticleEmitter emitter(size, alpha, speed, Count, 256, 45);
+	emitter.Velocity = Xna::Vector3(0, 10, 0);
+	emitter.Spread = 1;
+	emitter.Acceleration = Xna::Vector3(0, -9.8, 0);
+	emitter.MinLife = 0.5;
+	emitter.MaxLife = 2;
+
+	// Lives are spread evenly over [0.5, 2], so these kill about 7% and half of the particles.
+	run("update, few die", emitter, 0.6);
+	run("update, half die", emitter, 1.25);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,122 @@
+// Compares the QuaternionStream kernels with the scalar Quaternion and Vector3 functions they batch.
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Streams.h"
+
+// Prime, so no unroll or vector width of the kernel loops divides it and their remainder loops run too.
+static constexpr size_t Count = 10007;
+// The kernels may reorder operations, so they only match the scalar versions to rounding.
+static constexpr double Tolerance = 1e-12;
+
+static i32 failures = 0;
+
+static void check(const char* name, double error) {
+	std::printf("%-24s max error %.3g\n", name, error);
+
+	if (!(error <= Tolerance)) {
+		std::printf("%-24s FAILED, tolerance %.3g\n", name, Tolerance);
+		++failures;
+	}
+}
+
+static double errorOf(Xna::Quaternion const& a, Xna::Quaternion const& b) {
+	return std::fmax(std::fmax(std::fabs(a.X - b.X), std::fabs(a.Y - b.Y)), std::fmax(std::fabs(a.Z - b.Z), std::fabs(a.W - b.W)));
+}
+
+static double errorOf(Xna::Vector3 const& a, Xna::Vector3 const& b) {
+	return std::fmax(std::fabs(a.X - b.X), std::fmax(std::fabs(a.Y - b.Y), std::fabs(a.Z - b.Z)));
+}
+
+int main() {
+	std::mt19937 random(26);
+	std::uniform_real_distribution<double> component(-1, 1);
+	std::uniform_real_distribution<double> amount(0, 1);
+
+	std::vector<Xna::Quaternion> first(Count);
+	std::vector<Xna::Quaternion> second(Count);
+	std::vector<Xna::Vector3> vectors(Count);
+	std::vector<double> amounts(Count);
+
+	for (size_t i = 0; i < Count; ++i) {
+		first[i] = Xna::Quaternion::Normalize(Xna::Quaternion(component(random), component(random), component(random), component(random)));
+		second[i] = Xna::Quaternion::Normalize(Xna::Quaternion(component(random), component(random), component(random), component(random)));
+		vectors[i] = Xna::Vector3(component(random), component(random), component(random)) * 100;
+		amounts[i] = amount(random);
+	}
+
+	// Nearly equal pairs take the linear path of Slerp.
+	for (size_t i = 0; i < Count; i += 16)
+		second[i] = first[i];
+
+	const Xna::QuaternionStream quaternions1(first);
+	const Xna::QuaternionStream quaternions2(second);
+	Xna::Vector3Stream values(Count);
+
+	for (size_t i = 0; i < Count; ++i)
+		values.Set(i, vectors[i]);
+
+	Xna::QuaternionStream result;
+	Xna::Vector3Stream rotated;
+	double error;
+
+	Xna::QuaternionStream::Multiply(quaternions1, quaternions2, result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Multiply(first[i], second[i])));
+	check("Multiply", error);
+
+	Xna::QuaternionStream::Multiply(quaternions1, second[1], result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Multiply(first[i], second[1])));
+	check("Multiply by one", error);
+
+	std::vector<Xna::Quaternion> scaled(Count);
+	for (size_t i = 0; i < Count; ++i)
+		scaled[i] = Xna::Quaternion::Multiply(first[i], 1 + 10 * amounts[i]);
+	Xna::QuaternionStream::Normalize(Xna::QuaternionStream(scaled), result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Normalize(scaled[i])));
+	check("Normalize", error);
+
+	Xna::QuaternionStream::Lerp(quaternions1, quaternions2, 0.3, result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Lerp(first[i], second[i], 0.3)));
+	check("Lerp", error);
+
+	Xna::QuaternionStream::Lerp(quaternions1, quaternions2, amounts, result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Lerp(first[i], second[i], amounts[i])));
+	check("Lerp per pair", error);
+
+	Xna::QuaternionStream::Slerp(quaternions1, quaternions2, 0.3, result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Slerp(first[i], second[i], 0.3)));
+	check("Slerp", error);
+
+	Xna::QuaternionStream::Slerp(quaternions1, quaternions2, amounts, result);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(result.Get(i), Xna::Quaternion::Slerp(first[i], second[i], amounts[i])));
+	check("Slerp per pair", error);
+
+	Xna::QuaternionStream::Transform(values, quaternions1, rotated);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(rotated.Get(i), Xna::Vector3::Transform(vectors[i], first[i])) / 100);
+	check("Transform", error);
+
+	Xna::QuaternionStream::Transform(values, second[1], rotated);
+	error = 0;
+	for (size_t i = 0; i < Count; ++i)
+		error = std::fmax(error, errorOf(rotated.Get(i), Xna::Vector3::Transform(vectors[i], second[1])) / 100);
+	check("Transform by one", error);
+
+	return failures == 0 ? 0 : 1;
+}
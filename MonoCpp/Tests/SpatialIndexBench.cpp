@@ -0,0 +1,190 @@
+// Times SpatialHash and LooseQuadtree at 100k rectangles: building, moving every item, region
+// and point queries and pair enumeration. Queries are checked against a linear scan, and pairs
+// against an exhaustive sweep that tests every pair whose horizontal ranges overlap.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <utility>
+#include <vector>
+#include "Space2d.h"
+
+static constexpr size_t Count = 100000;
+static constexpr i32 WorldSize = 16384;
+static constexpr size_t Queries = 1000;
+
+using Pairs = std::vector<std::pair<u32, u32>>;
+
+static i32 failures = 0;
+
+template <typename F>
+static double milliseconds(F const& body) {
+	const auto start = std::chrono::steady_clock::now();
+	body();
+	const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+	return elapsed.count();
+}
+
+// Every intersecting pair, lower id first, sorted.
+static Pairs bruteForcePairs(std::vector<Xna::Rectangle> const& bounds, std::vector<u32> const& ids) {
+	std::vector<size_t> order(bounds.size());
+
+	for (size_t i = 0; i < order.size(); ++i)
+		order[i] = i;
+
+	std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return bounds[a].X < bounds[b].X; });
+	Pairs pairs;
+
+	for (size_t i = 0; i < order.size(); ++i) {
+		Xna::Rectangle const& a = bounds[order[i]];
+
+		// Past this, the left edges are at or beyond a's right edge and nothing else can intersect it.
+		for (size_t j = i + 1; j < order.size() && bounds[order[j]].X < a.Right(); ++j) {
+			if (a.Intersects(bounds[order[j]])) {
+				const u32 first = ids[order[i]];
+				const u32 second = ids[order[j]];
+				pairs.emplace_back(std::min(first, second), std::max(first, second));
+			}
+		}
+	}
+
+	std::sort(pairs.begin(), pairs.end());
+	return pairs;
+}
+
+template <typename Index>
+static void run(const char* name, Index& index, std::vector<Xna::Rectangle> bounds, std::vector<Xna::Rectangle> const& moved,
+	std::vector<Xna::Rectangle> const& regions, std::vector<Xna::Point> const& points) {
+
+	std::vector<u32> ids(Count);
+
+	const double insertTime = milliseconds([&] {
+		for (size_t i = 0; i < Count; ++i)
+			ids[i] = index.Insert(bounds[i]);
+	});
+
+	const double moveTime = milliseconds([&] {
+		for (size_t i = 0; i < Count; ++i)
+			index.Move(ids[i], moved[i]);
+	});
+	bounds = moved;
+
+	std::vector<u32> found;
+	size_t regionHits = 0;
+
+	const double regionTime = milliseconds([&] {
+		for (Xna::Rectangle const& region : regions) {
+			found.clear();
+			index.Query(region, found);
+			regionHits += found.size();
+		}
+	});
+
+	size_t pointHits = 0;
+
+	const double pointTime = milliseconds([&] {
+		for (Xna::Point const& point : points) {
+			found.clear();
+			index.Query(point, found);
+			pointHits += found.size();
+		}
+	});
+
+	Pairs pairs;
+	const double pairTime = milliseconds([&] {
+		index.QueryPairs(pairs);
+	});
+
+	std::printf("%-14s insert %7.2f ms  move %7.2f ms  %zu regions %7.2f ms  %zu points %6.2f ms  pairs %7.2f ms (%zu)\n",
+		name, insertTime, moveTime, Queries, regionTime, Queries, pointTime, pairTime, pairs.size());
+
+	// The queries against a linear scan, item by item.
+	size_t expectedRegionHits = 0;
+	bool regionsMatch = true;
+
+	for (Xna::Rectangle const& region : regions) {
+		std::vector<u32> expected;
+		for (size_t i = 0; i < Count; ++i) {
+			if (region.Intersects(bounds[i]))
+				expected.push_back(ids[i]);
+		}
+
+		found.clear();
+		index.Query(region, found);
+		std::sort(expected.begin(), expected.end());
+		std::sort(found.begin(), found.end());
+		regionsMatch &= found == expected;
+		expectedRegionHits += expected.size();
+	}
+
+	bool pointsMatch = true;
+
+	for (Xna::Point const& point : points) {
+		std::vector<u32> expected;
+		for (size_t i = 0; i < Count; ++i) {
+			if (bounds[i].Contains(point))
+				expected.push_back(ids[i]);
+		}
+
+		found.clear();
+		index.Query(point, found);
+		std::sort(expected.begin(), expected.end());
+		std::sort(found.begin(), found.end());
+		pointsMatch &= found == expected;
+	}
+
+	std::sort(pairs.begin(), pairs.end());
+	const Pairs expectedPairs = bruteForcePairs(bounds, ids);
+
+	if (!regionsMatch || regionHits != expectedRegionHits) {
+		std::printf("%-14s FAILED: region queries differ from the linear scan\n", name);
+		++failures;
+	}
+
+	if (!pointsMatch) {
+		std::printf("%-14s FAILED: point queries differ from the linear scan\n", name);
+		++failures;
+	}
+
+	if (pairs != expectedPairs) {
+		std::printf("%-14s FAILED: %zu pairs instead of the %zu of the exhaustive sweep\n", name, pairs.size(), expectedPairs.size());
+		++failures;
+	}
+}
+
+int main() {
+	std::mt19937 random(37);
+	std::uniform_int_distribution<i32> position(0, WorldSize - 1);
+	std::uniform_int_distribution<i32> spriteSize(8, 32);
+	std::uniform_int_distribution<i32> largeSize(64, 1024);
+	std::uniform_int_distribution<i32> step(-16, 16);
+
+	std::vector<Xna::Rectangle> bounds(Count);
+	std::vector<Xna::Rectangle> moved(Count);
+
+	// Mostly sprites, with one large item in a hundred for the mixed sizes the quadtree is for.
+	for (size_t i = 0; i < Count; ++i) {
+		const bool large = i % 100 == 0;
+		const i32 width = large ? largeSize(random) : spriteSize(random);
+		const i32 height = large ? largeSize(random) : spriteSize(random);
+		bounds[i] = Xna::Rectangle(position(random), position(random), width, height);
+		moved[i] = Xna::Rectangle(bounds[i].X + step(random), bounds[i].Y + step(random), width, height);
+	}
+
+	std::vector<Xna::Rectangle> regions(Queries);
+	std::vector<Xna::Point> points;
+
+	for (size_t i = 0; i < Queries; ++i) {
+		regions[i] = Xna::Rectangle(position(random), position(random), 256, 256);
+		points.emplace_back(position(random), position(random));
+	}
+
+	Xna::SpatialHash hash(32);
+	run("SpatialHash", hash, bounds, moved, regions, points);
+
+	Xna::LooseQuadtree tree(Xna::Rectangle(0, 0, WorldSize, WorldSize));
+	run("LooseQuadtree", tree, bounds, moved, regions, points);
+
+	return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,103 @@
+// Checks TransformStore handles: a default handle never matches a transform, removed handles go stale
+// even once their slot is reused, and the packed arrays keep every live transform's values.
+
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "TransformStore.h"
+
+static i32 failures = 0;
+
+static void expect(const char* name, bool passed) {
+	if (!passed) {
+		std::printf("%s FAILED\n", name);
+		++failures;
+	}
+}
+
+int main() {
+	Xna::TransformStore store;
+
+	expect("default handle on an empty store", !store.IsValid(Xna::TransformHandle{}));
+
+	const Xna::TransformHandle first = store.Add(Xna::Vector3(1, 2, 3), Xna::Quaternion::Identity(), Xna::Vector3(1, 1, 1));
+	expect("first handle is valid", store.IsValid(first));
+	expect("first handle has a nonzero generation", first.Generation != 0);
+	expect("default handle with slot 0 live", !store.IsValid(Xna::TransformHandle{}));
+
+	// A default handle must not reach the live transform in slot 0.
+	store.Position(Xna::TransformHandle{}, Xna::Vector3(9, 9, 9));
+	store.Remove(Xna::TransformHandle{});
+	expect("default handle writes nothing", store.Position(first) == Xna::Vector3(1, 2, 3));
+	expect("default handle removes nothing", store.IsValid(first) && store.Count() == 1);
+
+	// Removing makes the handle stale, and the slot it frees goes to the next transform.
+	store.Remove(first);
+	expect("removed handle is stale", !store.IsValid(first));
+
+	const Xna::TransformHandle reused = store.Add(Xna::Vector3(4, 5, 6), Xna::Quaternion::Identity(), Xna::Vector3(1, 1, 1));
+	expect("slot is reused", reused.Index == first.Index);
+	expect("reused slot has a new generation", reused.Generation != first.Generation && reused.Generation != 0);
+	expect("stale handle stays stale after reuse", !store.IsValid(first));
+
+	store.Position(first, Xna::Vector3(7, 7, 7));
+	store.Remove(first);
+	expect("stale handle writes nothing", store.Position(reused) == Xna::Vector3(4, 5, 6));
+	expect("stale handle removes nothing", store.IsValid(reused));
+	expect("stale handle reads the default", store.Position(first) == Xna::Vector3());
+
+	// Random adds and removes against a model of which handles are live and where they are.
+	std::mt19937 random(35);
+	std::vector<Xna::TransformHandle> live{ reused };
+	std::vector<double> tags{ 4 };
+	std::vector<Xna::TransformHandle> dead{ first };
+	bool zeroGeneration = false;
+
+	for (i32 step = 0; step < 100000; ++step) {
+		if (live.empty() || random() % 3 != 0) {
+			const double tag = static_cast<double>(step);
+			const Xna::TransformHandle handle = store.Add(Xna::Vector3(tag, 0, 0), Xna::Quaternion::Identity(), Xna::Vector3(1, 1, 1));
+			zeroGeneration |= handle.Generation == 0;
+			live.push_back(handle);
+			tags.push_back(tag);
+		}
+		else {
+			const size_t victim = random() % live.size();
+			store.Remove(live[victim]);
+			dead.push_back(live[victim]);
+			live[victim] = live.back();
+			tags[victim] = tags.back();
+			live.pop_back();
+			tags.pop_back();
+		}
+
+		if (step % 10000 == 4999) {
+			store.Clear();
+			dead.insert(dead.end(), live.begin(), live.end());
+			live.clear();
+			tags.clear();
+		}
+	}
+
+	expect("generation 0 is never handed out", !zeroGeneration);
+	expect("default handle after reuse", !store.IsValid(Xna::TransformHandle{}));
+	expect("count matches", store.Count() == live.size());
+
+	bool liveValid = true;
+	for (size_t i = 0; i < live.size(); ++i)
+		liveValid &= store.IsValid(live[i]) && store.Position(live[i]).X == tags[i];
+	expect("live handles keep their values", liveValid);
+
+	bool deadStale = true;
+	for (Xna::TransformHandle const& handle : dead)
+		deadStale &= !store.IsValid(handle);
+	expect("every removed handle is stale", deadStale);
+
+	bool packed = true;
+	for (size_t i = 0; i < store.Count(); ++i)
+		packed &= store.Position(store.HandleAt(i)) == store.Transforms().Translation.Get(i);
+	expect("HandleAt matches the packed arrays", packed);
+
+	std::printf("%zu live, %zu removed handles checked\n", live.size(), dead.size());
+	return failures == 0 ? 0 : 1;
+}
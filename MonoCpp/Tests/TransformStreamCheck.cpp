@@ -0,0 +1,122 @@
+// Checks TransformStream::Decompose against Matrix::Decompose, TransformStream::Compose against
+// Matrix::CreateFromTRS, and that composing the decomposed transforms gives the matrices back.
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include "Streams.h"
+
+static constexpr size_t Count = 10007;
+static constexpr double Tolerance = 1e-12;
+
+static i32 failures = 0;
+
+static void check(const char* name, double error) {
+	std::printf("%-24s max error %.3g\n", name, error);
+
+	if (!(error <= Tolerance)) {
+		std::printf("%-24s FAILED, tolerance %.3g\n", name, Tolerance);
+		++failures;
+	}
+}
+
+static double errorOf(Xna::Vector3 const& a, Xna::Vector3 const& b) {
+	return std::fmax(std::fabs(a.X - b.X), std::fmax(std::fabs(a.Y - b.Y), std::fabs(a.Z - b.Z)));
+}
+
+static double errorOf(Xna::Quaternion const& a, Xna::Quaternion const& b) {
+	return std::fmax(std::fmax(std::fabs(a.X - b.X), std::fabs(a.Y - b.Y)), std::fmax(std::fabs(a.Z - b.Z), std::fabs(a.W - b.W)));
+}
+
+static double errorOf(Xna::Matrix const& a, Xna::Matrix const& b) {
+	const std::vector<double> x = Xna::Matrix::ToDoubleArray(a);
+	const std::vector<double> y = Xna::Matrix::ToDoubleArray(b);
+	double error = 0;
+
+	for (size_t i = 0; i < x.size(); ++i)
+		error = std::fmax(error, std::fabs(x[i] - y[i]) / std::fmax(1.0, std::fabs(y[i])));
+
+	return error;
+}
+
+int main() {
+	std::mt19937 random(33);
+	std::uniform_real_distribution<double> component(-1, 1);
+	std::uniform_real_distribution<double> scale(0.25, 4);
+
+	std::vector<Xna::Matrix> matrices(Count);
+	Xna::TransformStream transforms(Count);
+
+	for (size_t i = 0; i < Count; ++i) {
+		const Xna::Vector3 translation = Xna::Vector3(component(random), component(random), component(random)) * 100;
+		const Xna::Quaternion rotation = Xna::Quaternion::Normalize(Xna::Quaternion(component(random), component(random), component(random), component(random)));
+		Xna::Vector3 scales(scale(random), scale(random), scale(random));
+
+		// Some mirrored transforms, to check that the sign conventions match.
+		if (i % 5 == 0)
+			scales.X = -scales.X;
+
+		matrices[i] = Xna::Matrix::CreateFromTRS(translation, rotation, scales);
+		transforms.Translation.Set(i, translation);
+		transforms.Rotation.Set(i, rotation);
+		transforms.Scale.Set(i, scales);
+	}
+
+	// A matrix without scale, which both versions must reject the same way.
+	matrices[7] = Xna::Matrix::CreateScale(0.0);
+
+	std::vector<Xna::Matrix> composed;
+	Xna::TransformStream::Compose(transforms, composed);
+
+	double error = 0;
+	for (size_t i = 0; i < Count; ++i) {
+		if (i != 7)
+			error = std::fmax(error, errorOf(composed[i], matrices[i]));
+	}
+	check("Compose", error);
+
+	Xna::TransformStream decomposed;
+	const size_t failed = Xna::TransformStream::Decompose(matrices, decomposed);
+
+	double scaleError = 0;
+	double rotationError = 0;
+	double translationError = 0;
+	size_t scalarFailed = 0;
+
+	for (size_t i = 0; i < Count; ++i) {
+		Xna::Vector3 scales;
+		Xna::Quaternion rotation;
+		Xna::Vector3 translation;
+
+		if (!matrices[i].Decompose(scales, rotation, translation)) {
+			++scalarFailed;
+			continue;
+		}
+
+		scaleError = std::fmax(scaleError, errorOf(decomposed.Scale.Get(i), scales));
+		rotationError = std::fmax(rotationError, errorOf(decomposed.Rotation.Get(i), rotation));
+		translationError = std::fmax(translationError, errorOf(decomposed.Translation.Get(i), translation) / 100);
+	}
+
+	check("Decompose scale", scaleError);
+	check("Decompose rotation", rotationError);
+	check("Decompose translation", translationError);
+
+	if (failed != scalarFailed) {
+		std::printf("Decompose FAILED: %zu matrices rejected instead of %zu\n", failed, scalarFailed);
+		++failures;
+	}
+
+	Xna::TransformStream::Compose(decomposed, composed);
+
+	// Like Matrix::Decompose, the kernel takes the sign of each scale from the product of a row including
+	// its zero fourth column, so mirrored transforms come back unmirrored and cannot round-trip.
+	error = 0;
+	for (size_t i = 0; i < Count; ++i) {
+		if (i != 7 && i % 5 != 0)
+			error = std::fmax(error, errorOf(composed[i], matrices[i]));
+	}
+	check("Round trip", error);
+
+	return failures == 0 ? 0 : 1;
+}
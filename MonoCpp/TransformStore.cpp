@@ -0,0 +1,175 @@
+#include "TransformStore.h"
+
+namespace Xna {
+
+	TransformStore::TransformStore() {}
+
+	TransformHandle TransformStore::Add(Vector3 const& position, Quaternion const& rotation, Vector3 const& scale) {
+		u32 slot;
+
+		if (!_freeSlots.empty()) {
+			slot = _freeSlots.back();
+			_freeSlots.pop_back();
+		}
+		else {
+			slot = static_cast<u32>(_slots.size());
+			_slots.push_back(Slot{ 0, 1, false });
+		}
+
+		const size_t index = _owners.size();
+		_transforms.Resize(index + 1);
+		_transforms.Translation.Set(index, position);
+		_transforms.Rotation.Set(index, rotation);
+		_transforms.Scale.Set(index, scale);
+		_world.push_back(Matrix::Identity());
+		_dirty.push_back(1);
+		_owners.push_back(slot);
+
+		_slots[slot].Index = static_cast<u32>(index);
+		_slots[slot].Alive = true;
+
+		return TransformHandle{ slot, _slots[slot].Generation };
+	}
+
+	TransformHandle TransformStore::Add() {
+		return Add(Vector3::Zero(), Quaternion::Identity(), Vector3::One());
+	}
+
+	void TransformStore::Remove(TransformHandle handle) {
+		const i64 found = find(handle);
+
+		if (found < 0)
+			return;
+
+		// Move the last transform into the hole so the arrays stay packed.
+		const size_t index = static_cast<size_t>(found);
+		const size_t last = _owners.size() - 1;
+
+		if (index != last) {
+			_transforms.Translation.Set(index, _transforms.Translation.Get(last));
+			_transforms.Rotation.Set(index, _transforms.Rotation.Get(last));
+			_transforms.Scale.Set(index, _transforms.Scale.Get(last));
+			_world[index] = _world[last];
+			_dirty[index] = _dirty[last];
+			_owners[index] = _owners[last];
+			_slots[_owners[index]].Index = static_cast<u32>(index);
+		}
+
+		_transforms.Resize(last);
+		_world.pop_back();
+		_dirty.pop_back();
+		_owners.pop_back();
+
+		Slot& slot = _slots[handle.Index];
+		slot.Alive = false;
+		slot.Generation = nextGeneration(slot.Generation);
+		_freeSlots.push_back(handle.Index);
+	}
+
+	bool TransformStore::IsValid(TransformHandle handle) const {
+		return find(handle) >= 0;
+	}
+
+	void TransformStore::Clear() {
+		for (u32 owner : _owners) {
+			Slot& slot = _slots[owner];
+			slot.Alive = false;
+			slot.Generation = nextGeneration(slot.Generation);
+			_freeSlots.push_back(owner);
+		}
+
+		_transforms.Resize(0);
+		_world.clear();
+		_dirty.clear();
+		_owners.clear();
+	}
+
+	size_t TransformStore::Count() const {
+		return _owners.size();
+	}
+
+	Vector3 TransformStore::Position(TransformHandle handle) const {
+		const i64 index = find(handle);
+		return index < 0 ? Vector3() : _transforms.Translation.Get(static_cast<size_t>(index));
+	}
+
+	void TransformStore::Position(TransformHandle handle, Vector3 const& value) {
+		const i64 index = find(handle);
+
+		if (index < 0)
+			return;
+
+		_transforms.Translation.Set(static_cast<size_t>(index), value);
+		_dirty[static_cast<size_t>(index)] = 1;
+	}
+
+	Quaternion TransformStore::Rotation(TransformHandle handle) const {
+		const i64 index = find(handle);
+		return index < 0 ? Quaternion() : _transforms.Rotation.Get(static_cast<size_t>(index));
+	}
+
+	void TransformStore::Rotation(TransformHandle handle, Quaternion const& value) {
+		const i64 index = find(handle);
+
+		if (index < 0)
+			return;
+
+		_transforms.Rotation.Set(static_cast<size_t>(index), value);
+		_dirty[static_cast<size_t>(index)] = 1;
+	}
+
+	Vector3 TransformStore::Scale(TransformHandle handle) const {
+		const i64 index = find(handle);
+		return index < 0 ? Vector3() : _transforms.Scale.Get(static_cast<size_t>(index));
+	}
+
+	void TransformStore::Scale(TransformHandle handle, Vector3 const& value) {
+		const i64 index = find(handle);
+
+		if (index < 0)
+			return;
+
+		_transforms.Scale.Set(static_cast<size_t>(index), value);
+		_dirty[static_cast<size_t>(index)] = 1;
+	}
+
+	Matrix TransformStore::World(TransformHandle handle) const {
+		const i64 index = find(handle);
+		return index < 0 ? Matrix() : _world[static_cast<size_t>(index)];
+	}
+
+	size_t TransformStore::Update() {
+		return TransformStream::Compose(_transforms, _dirty, _world);
+	}
+
+	TransformStream const& TransformStore::Transforms() const {
+		return _transforms;
+	}
+
+	std::vector<Matrix> const& TransformStore::WorldMatrices() const {
+		return _world;
+	}
+
+	TransformHandle TransformStore::HandleAt(size_t index) const {
+		const u32 slot = _owners[index];
+		return TransformHandle{ slot, _slots[slot].Generation };
+	}
+
+	// Private
+
+	i64 TransformStore::find(TransformHandle handle) const {
+		if (handle.Index >= _slots.size())
+			return -1;
+
+		Slot const& slot = _slots[handle.Index];
+
+		if (!slot.Alive || slot.Generation != handle.Generation)
+			return -1;
+
+		return slot.Index;
+	}
+
+	u32 TransformStore::nextGeneration(u32 generation) {
+		return generation == 0xffffffff ? 1 : generation + 1;
+	}
+}
@@ -0,0 +1,94 @@
+#ifndef TRANSFORMSTORE_H
+#define TRANSFORMSTORE_H
+
+#include <vector>
+#include "CSharp.h"
+#include "Structs.h"
+#include "Streams.h"
+
+namespace Xna {
+
+	// Identifies a transform in a TransformStore.
+	// The generation tells a live transform from a removed one whose slot was reused.
+	// Generation 0 is never given out, so a default TransformHandle refers to no transform.
+	struct TransformHandle {
+		u32 Index = 0;
+		u32 Generation = 0;
+
+		friend constexpr bool operator ==(TransformHandle const& a, TransformHandle const& b) {
+			return a.Index == b.Index && a.Generation == b.Generation;
+		}
+
+		friend constexpr bool operator !=(TransformHandle const& a, TransformHandle const& b) {
+			return !(a == b);
+		}
+	};
+
+	// A pool of position, rotation and scale transforms with a cached world matrix each.
+	// Live transforms are kept packed at the front of SoA arrays, so bulk updates walk
+	// contiguous memory; handles stay valid while transforms are added and removed.
+	// Setters mark the world matrix dirty and Update rebuilds only the dirty ones.
+	// Operations on a removed or unknown handle do nothing and getters return default values.
+	struct TransformStore {
+
+		TransformStore();
+
+		// Adds a transform and returns its handle. Its world matrix is dirty until the next Update.
+		TransformHandle Add(Vector3 const& position, Quaternion const& rotation, Vector3 const& scale);
+		// Adds an identity transform and returns its handle.
+		TransformHandle Add();
+		// Removes a transform; its handle and any copy of it become invalid.
+		void Remove(TransformHandle handle);
+		// Gets whether the handle refers to a live transform.
+		bool IsValid(TransformHandle handle) const;
+		// Removes every transform.
+		void Clear();
+		// Returns the number of live transforms.
+		size_t Count() const;
+
+		Vector3 Position(TransformHandle handle) const;
+		void Position(TransformHandle handle, Vector3 const& value);
+		Quaternion Rotation(TransformHandle handle) const;
+		void Rotation(TransformHandle handle, Quaternion const& value);
+		Vector3 Scale(TransformHandle handle) const;
+		void Scale(TransformHandle handle, Vector3 const& value);
+
+		// Gets the world matrix as of the last Update.
+		Matrix World(TransformHandle handle) const;
+
+		// Rebuilds the world matrix of every dirty transform as
+		// Matrix::CreateScale(scale) * Matrix::CreateFromQuaternion(rotation) * Matrix::CreateTranslation(position),
+		// and returns how many were rebuilt.
+		size_t Update();
+
+		// The live transforms in packed order, for bulk processing. The order changes when transforms are removed.
+		TransformStream const& Transforms() const;
+		// The world matrices in the same order as Transforms.
+		std::vector<Matrix> const& WorldMatrices() const;
+		// Gets the handle of the transform at a packed index.
+		TransformHandle HandleAt(size_t index) const;
+
+	private:
+		// Where a handle's transform lives in the packed arrays.
+		struct Slot {
+			u32 Index;
+			u32 Generation;
+			bool Alive;
+		};
+
+		std::vector<Slot> _slots;
+		std::vector<u32> _freeSlots;
+		// Packed arrays, one entry per live transform.
+		TransformStream _transforms;
+		std::vector<Matrix> _world;
+		std::vector<byte> _dirty;
+		std::vector<u32> _owners;
+
+		// Returns the packed index of the handle, or -1 if it is not live.
+		i64 find(TransformHandle handle) const;
+		// Returns the generation after this one, skipping 0 when it wraps.
+		static u32 nextGeneration(u32 generation);
+	};
+}
+
+#endif
@@ -0,0 +1,211 @@
+#include <cmath>
+#include <limits>
+#include "Streams.h"
+
+namespace Xna {
+
+	static constexpr double RotationScale = 32767.0;
+
+	// Rounds value / step to the nearest integer, clamped to [-limit, limit].
+	static double quantize(double value, double step, double limit) {
+		const double q = std::round(value / step);
+		return q < -limit ? -limit : (q > limit ? limit : q);
+	}
+
+	TransformStream::TransformStream() {}
+
+	TransformStream::TransformStream(size_t count) :
+		Scale(count), Rotation(count), Translation(count) {}
+
+	//----- Members
+
+	size_t TransformStream::Count() const {
+		return Translation.Count();
+	}
+
+	void TransformStream::Resize(size_t count) {
+		Scale.Resize(count);
+		Rotation.Resize(count);
+		Translation.Resize(count);
+	}
+
+	//----- Static
+
+	size_t TransformStream::Decompose(std::vector<Matrix> const& matrices, TransformStream& result) {
+		const size_t count = matrices.size();
+		result.Resize(count);
+
+		const Matrix* m = matrices.data();
+		double* sx = result.Scale.X.data();
+		double* sy = result.Scale.Y.data();
+		double* sz = result.Scale.Z.data();
+		double* tx = result.Translation.X.data();
+		double* ty = result.Translation.Y.data();
+		double* tz = result.Translation.Z.data();
+
+		// Translation and signed scale, free of branches.
+		for (size_t i = 0; i < count; ++i) {
+			tx[i] = m[i].M41;
+			ty[i] = m[i].M42;
+			tz[i] = m[i].M43;
+
+			const double xs = (m[i].M11 * m[i].M12 * m[i].M13 * m[i].M14) < 0 ? -1 : 1;
+			const double ys = (m[i].M21 * m[i].M22 * m[i].M23 * m[i].M24) < 0 ? -1 : 1;
+			const double zs = (m[i].M31 * m[i].M32 * m[i].M33 * m[i].M34) < 0 ? -1 : 1;
+
+			sx[i] = xs * std::sqrt(m[i].M11 * m[i].M11 + m[i].M12 * m[i].M12 + m[i].M13 * m[i].M13);
+			sy[i] = ys * std::sqrt(m[i].M21 * m[i].M21 + m[i].M22 * m[i].M22 + m[i].M23 * m[i].M23);
+			sz[i] = zs * std::sqrt(m[i].M31 * m[i].M31 + m[i].M32 * m[i].M32 + m[i].M33 * m[i].M33);
+		}
+
+		double* rx = result.Rotation.X.data();
+		double* ry = result.Rotation.Y.data();
+		double* rz = result.Rotation.Z.data();
+		double* rw = result.Rotation.W.data();
+		size_t failed = 0;
+
+		// Quaternion::CreateFromRotationMatrix of the rows divided by the scale, without building the matrix.
+		for (size_t i = 0; i < count; ++i) {
+			if (sx[i] == 0.0 || sy[i] == 0.0 || sz[i] == 0.0) {
+				rx[i] = 0;
+				ry[i] = 0;
+				rz[i] = 0;
+				rw[i] = 1;
+				++failed;
+				continue;
+			}
+
+			const double m11 = m[i].M11 / sx[i], m12 = m[i].M12 / sx[i], m13 = m[i].M13 / sx[i];
+			const double m21 = m[i].M21 / sy[i], m22 = m[i].M22 / sy[i], m23 = m[i].M23 / sy[i];
+			const double m31 = m[i].M31 / sz[i], m32 = m[i].M32 / sz[i], m33 = m[i].M33 / sz[i];
+			const double scale = m11 + m22 + m33;
+			double sqrt;
+			double half;
+
+			if (scale > 0.0) {
+				sqrt = std::sqrt(scale + 1.0);
+				rw[i] = sqrt * 0.5;
+				sqrt = 0.5 / sqrt;
+				rx[i] = (m23 - m32) * sqrt;
+				ry[i] = (m31 - m13) * sqrt;
+				rz[i] = (m12 - m21) * sqrt;
+			}
+			else if ((m11 >= m22) && (m11 >= m33)) {
+				sqrt = std::sqrt(1.0 + m11 - m22 - m33);
+				half = 0.5 / sqrt;
+				rx[i] = 0.5 * sqrt;
+				ry[i] = (m12 + m21) * half;
+				rz[i] = (m13 + m31) * half;
+				rw[i] = (m23 - m32) * half;
+			}
+			else if (m22 > m33) {
+				sqrt = std::sqrt(1.0 + m22 - m11 - m33);
+				half = 0.5 / sqrt;
+				rx[i] = (m21 + m12) * half;
+				ry[i] = 0.5 * sqrt;
+				rz[i] = (m32 + m23) * half;
+				rw[i] = (m31 - m13) * half;
+			}
+			else {
+				sqrt = std::sqrt(1.0 + m33 - m11 - m22);
+				half = 0.5 / sqrt;
+				rx[i] = (m31 + m13) * half;
+				ry[i] = (m32 + m23) * half;
+				rz[i] = 0.5 * sqrt;
+				rw[i] = (m12 - m21) * half;
+			}
+		}
+
+		return failed;
+	}
+
+	// Writes Matrix::CreateScale * Matrix::CreateFromQuaternion * Matrix::CreateTranslation of transform i.
+	static inline void compose(TransformStream const& transforms, size_t i, Matrix& m) {
+		m = AffineMatrix::CreateFromTRS(transforms.Translation.Get(i), transforms.Rotation.Get(i), transforms.Scale.Get(i)).ToMatrix();
+	}
+
+	void TransformStream::Compose(TransformStream const& transforms, std::vector<Matrix>& result) {
+		const size_t count = transforms.Count();
+		result.resize(count);
+
+		for (size_t i = 0; i < count; ++i)
+			compose(transforms, i, result[i]);
+	}
+
+	size_t TransformStream::Compose(TransformStream const& transforms, std::vector<byte>& dirty, std::vector<Matrix>& result) {
+		const size_t count = transforms.Count();
+		result.resize(count);
+		dirty.resize(count, 1);
+
+		size_t composed = 0;
+
+		for (size_t i = 0; i < count; ++i) {
+			if (dirty[i] == 0)
+				continue;
+
+			compose(transforms, i, result[i]);
+			dirty[i] = 0;
+			++composed;
+		}
+
+		return composed;
+	}
+
+	void TransformStream::Quantize(TransformStream const& transforms, double translationStep, double scaleStep, std::vector<QuantizedTransform>& result) {
+		const size_t count = transforms.Count();
+		result.resize(count);
+
+		constexpr double i32Limit = std::numeric_limits<i32>::max();
+		constexpr double i16Limit = std::numeric_limits<i16>::max();
+
+		for (size_t i = 0; i < count; ++i) {
+			QuantizedTransform& q = result[i];
+
+			q.TranslationX = static_cast<i32>(quantize(transforms.Translation.X[i], translationStep, i32Limit));
+			q.TranslationY = static_cast<i32>(quantize(transforms.Translation.Y[i], translationStep, i32Limit));
+			q.TranslationZ = static_cast<i32>(quantize(transforms.Translation.Z[i], translationStep, i32Limit));
+
+			// q and -q are the same rotation, keeping W positive leaves the sign free for other uses.
+			const double sign = transforms.Rotation.W[i] < 0 ? -1.0 : 1.0;
+			const double unit = sign / RotationScale;
+
+			q.RotationX = static_cast<i16>(quantize(transforms.Rotation.X[i], unit, i16Limit));
+			q.RotationY = static_cast<i16>(quantize(transforms.Rotation.Y[i], unit, i16Limit));
+			q.RotationZ = static_cast<i16>(quantize(transforms.Rotation.Z[i], unit, i16Limit));
+			q.RotationW = static_cast<i16>(quantize(transforms.Rotation.W[i], unit, i16Limit));
+
+			q.ScaleX = static_cast<i16>(quantize(transforms.Scale.X[i], scaleStep, i16Limit));
+			q.ScaleY = static_cast<i16>(quantize(transforms.Scale.Y[i], scaleStep, i16Limit));
+			q.ScaleZ = static_cast<i16>(quantize(transforms.Scale.Z[i], scaleStep, i16Limit));
+		}
+	}
+
+	void TransformStream::Dequantize(std::vector<QuantizedTransform> const& quantized, double translationStep, double scaleStep, TransformStream& result) {
+		const size_t count = quantized.size();
+		result.Resize(count);
+
+		for (size_t i = 0; i < count; ++i) {
+			QuantizedTransform const& q = quantized[i];
+
+			result.Translation.X[i] = q.TranslationX * translationStep;
+			result.Translation.Y[i] = q.TranslationY * translationStep;
+			result.Translation.Z[i] = q.TranslationZ * translationStep;
+
+			const double x = q.RotationX / RotationScale;
+			const double y = q.RotationY / RotationScale;
+			const double z = q.RotationZ / RotationScale;
+			const double w = q.RotationW / RotationScale;
+			const double lengthSquared = (x * x) + (y * y) + (z * z) + (w * w);
+			const double factor = lengthSquared > 0 ? 1.0 / std::sqrt(lengthSquared) : 0.0;
+
+			result.Rotation.X[i] = x * factor;
+			result.Rotation.Y[i] = y * factor;
+			result.Rotation.Z[i] = z * factor;
+			result.Rotation.W[i] = lengthSquared > 0 ? w * factor : 1.0;
+
+			result.Scale.X[i] = q.ScaleX * scaleStep;
+			result.Scale.Y[i] = q.ScaleY * scaleStep;
+			result.Scale.Z[i] = q.ScaleZ * scaleStep;
+		}
+	}
+}
@@ -0,0 +1,317 @@
+#include <cmath>
+#include "TweenManager.h"
+#include "MathHelper.h"
+
+namespace Xna {
+
+	static double ease(Easing easing, double t) {
+		switch (easing) {
+		case Easing::SmoothStep:
+			return MathHelper::SmoothStep(0.0, 1.0, t);
+		case Easing::QuadraticIn:
+			return t * t;
+		case Easing::QuadraticOut:
+			return t * (2.0 - t);
+		case Easing::QuadraticInOut:
+			return t < 0.5 ? 2.0 * t * t : 1.0 - 2.0 * (1.0 - t) * (1.0 - t);
+		case Easing::CubicIn:
+			return t * t * t;
+		case Easing::CubicOut:
+			return 1.0 - (1.0 - t) * (1.0 - t) * (1.0 - t);
+		case Easing::CubicInOut:
+			return t < 0.5 ? 4.0 * t * t * t : 1.0 - 4.0 * (1.0 - t) * (1.0 - t) * (1.0 - t);
+		default:
+			return t;
+		}
+	}
+
+	static byte toChannel(double value) {
+		return static_cast<byte>(value <= 0 ? 0 : (value >= 255 ? 255 : value + 0.5));
+	}
+
+	TweenManager::TweenManager() :
+		_count(0) {
+
+		_pools[DoubleKind].Components = 1;
+		_pools[Vector2Kind].Components = 2;
+		_pools[Vector3Kind].Components = 3;
+		_pools[ColorKind].Components = 4;
+		_pools[QuaternionKind].Components = 4;
+	}
+
+	TweenHandle TweenManager::Add(double from, double to, double duration, Easing easing, Completed completed) {
+		return add(DoubleKind, &from, &to, duration, easing, std::move(completed));
+	}
+
+	TweenHandle TweenManager::Add(Vector2 const& from, Vector2 const& to, double duration, Easing easing, Completed completed) {
+		const double a[2] = { from.X, from.Y };
+		const double b[2] = { to.X, to.Y };
+		return add(Vector2Kind, a, b, duration, easing, std::move(completed));
+	}
+
+	TweenHandle TweenManager::Add(Vector3 const& from, Vector3 const& to, double duration, Easing easing, Completed completed) {
+		const double a[3] = { from.X, from.Y, from.Z };
+		const double b[3] = { to.X, to.Y, to.Z };
+		return add(Vector3Kind, a, b, duration, easing, std::move(completed));
+	}
+
+	TweenHandle TweenManager::Add(Color const& from, Color const& to, double duration, Easing easing, Completed completed) {
+		const double a[4] = { static_cast<double>(from.R()), static_cast<double>(from.G()), static_cast<double>(from.B()), static_cast<double>(from.A()) };
+		const double b[4] = { static_cast<double>(to.R()), static_cast<double>(to.G()), static_cast<double>(to.B()), static_cast<double>(to.A()) };
+		return add(ColorKind, a, b, duration, easing, std::move(completed));
+	}
+
+	TweenHandle TweenManager::Add(Quaternion const& from, Quaternion const& to, double duration, Easing easing, Completed completed) {
+		// Blend towards the closest of to and -to, as Quaternion::Lerp does.
+		const double dot = (from.X * to.X) + (from.Y * to.Y) + (from.Z * to.Z) + (from.W * to.W);
+		const double sign = dot < 0 ? -1.0 : 1.0;
+		const double a[4] = { from.X, from.Y, from.Z, from.W };
+		const double b[4] = { to.X * sign, to.Y * sign, to.Z * sign, to.W * sign };
+		return add(QuaternionKind, a, b, duration, easing, std::move(completed));
+	}
+
+	void TweenManager::Cancel(TweenHandle handle) {
+		if (find(handle, KindCount) >= 0)
+			remove(handle.Index);
+	}
+
+	bool TweenManager::IsActive(TweenHandle handle) const {
+		return find(handle, KindCount) >= 0;
+	}
+
+	void TweenManager::Clear() {
+		for (u32 slot = 0; slot < _slots.size(); ++slot) {
+			if (_slots[slot].Alive)
+				remove(slot);
+		}
+	}
+
+	size_t TweenManager::Count() const {
+		return _count;
+	}
+
+	bool TweenManager::TryGetValue(TweenHandle handle, double& value) const {
+		const i64 index = find(handle, DoubleKind);
+
+		if (index < 0)
+			return false;
+
+		value = _pools[DoubleKind].Value[0][index];
+		return true;
+	}
+
+	bool TweenManager::TryGetValue(TweenHandle handle, Vector2& value) const {
+		const i64 index = find(handle, Vector2Kind);
+
+		if (index < 0)
+			return false;
+
+		Pool const& pool = _pools[Vector2Kind];
+		value = Vector2(pool.Value[0][index], pool.Value[1][index]);
+		return true;
+	}
+
+	bool TweenManager::TryGetValue(TweenHandle handle, Vector3& value) const {
+		const i64 index = find(handle, Vector3Kind);
+
+		if (index < 0)
+			return false;
+
+		Pool const& pool = _pools[Vector3Kind];
+		value = Vector3(pool.Value[0][index], pool.Value[1][index], pool.Value[2][index]);
+		return true;
+	}
+
+	bool TweenManager::TryGetValue(TweenHandle handle, Color& value) const {
+		const i64 index = find(handle, ColorKind);
+
+		if (index < 0)
+			return false;
+
+		Pool const& pool = _pools[ColorKind];
+		value = Color(toChannel(pool.Value[0][index]), toChannel(pool.Value[1][index]), toChannel(pool.Value[2][index]), toChannel(pool.Value[3][index]));
+		return true;
+	}
+
+	bool TweenManager::TryGetValue(TweenHandle handle, Quaternion& value) const {
+		const i64 index = find(handle, QuaternionKind);
+
+		if (index < 0)
+			return false;
+
+		Pool const& pool = _pools[QuaternionKind];
+		value = Quaternion(pool.Value[0][index], pool.Value[1][index], pool.Value[2][index], pool.Value[3][index]);
+		return true;
+	}
+
+	void TweenManager::Update(GameTime const& gameTime) {
+		Update(gameTime.ElapsedGameTime.TotalSeconds());
+	}
+
+	void TweenManager::Update(double elapsedSeconds) {
+		_finished.clear();
+
+		for (u32 type = 0; type < KindCount; ++type)
+			advance(_pools[type], elapsedSeconds);
+
+		// The blended quaternions are renormalized, which completes Quaternion::Lerp.
+		Pool& rotations = _pools[QuaternionKind];
+		double* x = rotations.Value[0].data();
+		double* y = rotations.Value[1].data();
+		double* z = rotations.Value[2].data();
+		double* w = rotations.Value[3].data();
+
+		for (size_t i = 0; i < rotations.Owners.size(); ++i) {
+			const double scale = 1.0 / std::sqrt((x[i] * x[i]) + (y[i] * y[i]) + (z[i] * z[i]) + (w[i] * w[i]));
+			x[i] *= scale;
+			y[i] *= scale;
+			z[i] *= scale;
+			w[i] *= scale;
+		}
+
+		// Callbacks may add or cancel tweens, which moves the pools, so each is looked up again by handle.
+		for (size_t i = 0; i < _finished.size(); ++i) {
+			const TweenHandle handle = _finished[i];
+			const i64 index = find(handle, KindCount);
+
+			if (index < 0)
+				continue;
+
+			Completed callback = std::move(_pools[_slots[handle.Index].Type].Callbacks[index]);
+
+			if (callback)
+				callback(handle);
+		}
+
+		for (TweenHandle const& handle : _finished)
+			Cancel(handle);
+	}
+
+	// Private
+
+	TweenHandle TweenManager::add(Kind type, const double* from, const double* to, double duration, Easing easing, Completed&& completed) {
+		u32 slot;
+
+		if (!_freeSlots.empty()) {
+			slot = _freeSlots.back();
+			_freeSlots.pop_back();
+		}
+		else {
+			slot = static_cast<u32>(_slots.size());
+			_slots.push_back(Slot{ type, 0, 1, false });
+		}
+
+		Pool& pool = _pools[type];
+		const size_t index = pool.Owners.size();
+
+		for (u32 c = 0; c < pool.Components; ++c) {
+			pool.From[c].push_back(from[c]);
+			pool.To[c].push_back(to[c]);
+			pool.Value[c].push_back(from[c]);
+		}
+
+		pool.Elapsed.push_back(0);
+		pool.Duration.push_back(duration);
+		pool.Easings.push_back(easing);
+		pool.Callbacks.push_back(std::move(completed));
+		pool.Owners.push_back(slot);
+
+		_slots[slot].Type = type;
+		_slots[slot].Index = static_cast<u32>(index);
+		_slots[slot].Alive = true;
+		++_count;
+
+		return TweenHandle{ slot, _slots[slot].Generation };
+	}
+
+	void TweenManager::remove(u32 slot) {
+		Pool& pool = _pools[_slots[slot].Type];
+		const size_t index = _slots[slot].Index;
+		const size_t last = pool.Owners.size() - 1;
+
+		// Move the last tween into the hole so the arrays stay packed.
+		if (index != last) {
+			for (u32 c = 0; c < pool.Components; ++c) {
+				pool.From[c][index] = pool.From[c][last];
+				pool.To[c][index] = pool.To[c][last];
+				pool.Value[c][index] = pool.Value[c][last];
+			}
+
+			pool.Elapsed[index] = pool.Elapsed[last];
+			pool.Duration[index] = pool.Duration[last];
+			pool.Easings[index] = pool.Easings[last];
+			pool.Callbacks[index] = std::move(pool.Callbacks[last]);
+			pool.Owners[index] = pool.Owners[last];
+			_slots[pool.Owners[index]].Index = static_cast<u32>(index);
+		}
+
+		for (u32 c = 0; c < pool.Components; ++c) {
+			pool.From[c].pop_back();
+			pool.To[c].pop_back();
+			pool.Value[c].pop_back();
+		}
+
+		pool.Elapsed.pop_back();
+		pool.Duration.pop_back();
+		pool.Easings.pop_back();
+		pool.Callbacks.pop_back();
+		pool.Owners.pop_back();
+
+		_slots[slot].Alive = false;
+		_slots[slot].Generation = nextGeneration(_slots[slot].Generation);
+		_freeSlots.push_back(slot);
+		--_count;
+	}
+
+	i64 TweenManager::find(TweenHandle handle, Kind type) const {
+		if (handle.Index >= _slots.size())
+			return -1;
+
+		Slot const& slot = _slots[handle.Index];
+
+		if (!slot.Alive || slot.Generation != handle.Generation || (type != KindCount && slot.Type != type))
+			return -1;
+
+		return slot.Index;
+	}
+
+	void TweenManager::advance(Pool& pool, double elapsedSeconds) {
+		const size_t count = pool.Owners.size();
+		_amounts.resize(count);
+
+		double* elapsed = pool.Elapsed.data();
+		const double* duration = pool.Duration.data();
+		double* amounts = _amounts.data();
+
+		for (size_t i = 0; i < count; ++i) {
+			elapsed[i] += elapsedSeconds;
+			const double t = duration[i] > 0 ? elapsed[i] / duration[i] : 1.0;
+			amounts[i] = t < 0 ? 0 : (t > 1 ? 1 : t);
+		}
+
+		for (size_t i = 0; i < count; ++i) {
+			if (pool.Easings[i] != Easing::Linear)
+				amounts[i] = ease(pool.Easings[i], amounts[i]);
+		}
+
+		// One straight loop per component, which the compiler can vectorize.
+		for (u32 c = 0; c < pool.Components; ++c) {
+			const double* from = pool.From[c].data();
+			const double* to = pool.To[c].data();
+			double* value = pool.Value[c].data();
+
+			// Weighting both ends, rather than adding a share of to - from, lands exactly on to at amount 1.
+			for (size_t i = 0; i < count; ++i)
+				value[i] = from[i] * (1 - amounts[i]) + to[i] * amounts[i];
+		}
+
+		for (size_t i = 0; i < count; ++i) {
+			if (elapsed[i] >= duration[i])
+				_finished.push_back(TweenHandle{ pool.Owners[i], _slots[pool.Owners[i]].Generation });
+		}
+	}
+
+	u32 TweenManager::nextGeneration(u32 generation) {
+		return generation == 0xffffffff ? 1 : generation + 1;
+	}
+}
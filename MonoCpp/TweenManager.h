@@ -0,0 +1,133 @@
+#ifndef TWEENMANAGER_H
+#define TWEENMANAGER_H
+
+#include <functional>
+#include <vector>
+#include "CSharp.h"
+#include "Color.h"
+#include "GameTime.h"
+#include "Structs.h"
+
+namespace Xna {
+
+	// How a tween moves from its start to its end over its duration.
+	enum class Easing {
+		Linear,
+		// As MathHelper::SmoothStep.
+		SmoothStep,
+		QuadraticIn,
+		QuadraticOut,
+		QuadraticInOut,
+		CubicIn,
+		CubicOut,
+		CubicInOut
+	};
+
+	// Identifies a tween in a TweenManager.
+	// The generation tells a live tween from a finished one whose slot was reused.
+	// Generation 0 is never given out, so a default TweenHandle refers to no tween.
+	struct TweenHandle {
+		u32 Index = 0;
+		u32 Generation = 0;
+
+		friend constexpr bool operator ==(TweenHandle const& a, TweenHandle const& b) {
+			return a.Index == b.Index && a.Generation == b.Generation;
+		}
+
+		friend constexpr bool operator !=(TweenHandle const& a, TweenHandle const& b) {
+			return !(a == b);
+		}
+	};
+
+	// Runs many tweens at once, with no per-tween objects or virtual calls.
+	// Tweens are kept in one pool per value type, each an SoA of packed arrays, and Update
+	// advances a whole pool in a few straight loops: the eased amounts first, then each component.
+	// Quaternions blend as Quaternion::Lerp and colors per channel, rounded.
+	// Completion callbacks run after every pool is updated, and their tweens are removed once
+	// all callbacks have run, so a callback can still read the final value of any finished tween.
+	// Callbacks may add and cancel tweens. Operations on a finished or unknown handle do nothing.
+	struct TweenManager {
+
+		// Called with the handle of a tween that reached its end.
+		using Completed = std::function<void(TweenHandle)>;
+
+		TweenManager();
+
+		// Starts a tween from one value to another over duration seconds.
+		TweenHandle Add(double from, double to, double duration, Easing easing = Easing::Linear, Completed completed = nullptr);
+		TweenHandle Add(Vector2 const& from, Vector2 const& to, double duration, Easing easing = Easing::Linear, Completed completed = nullptr);
+		TweenHandle Add(Vector3 const& from, Vector3 const& to, double duration, Easing easing = Easing::Linear, Completed completed = nullptr);
+		TweenHandle Add(Color const& from, Color const& to, double duration, Easing easing = Easing::Linear, Completed completed = nullptr);
+		TweenHandle Add(Quaternion const& from, Quaternion const& to, double duration, Easing easing = Easing::Linear, Completed completed = nullptr);
+
+		// Stops a tween without calling its callback.
+		void Cancel(TweenHandle handle);
+		// Gets whether the handle refers to a running tween.
+		bool IsActive(TweenHandle handle) const;
+		// Stops every tween without calling callbacks.
+		void Clear();
+		// Returns the number of running tweens.
+		size_t Count() const;
+
+		// Gets the current value of a tween. Returns false if the handle is not a running tween of that type.
+		bool TryGetValue(TweenHandle handle, double& value) const;
+		bool TryGetValue(TweenHandle handle, Vector2& value) const;
+		bool TryGetValue(TweenHandle handle, Vector3& value) const;
+		bool TryGetValue(TweenHandle handle, Color& value) const;
+		bool TryGetValue(TweenHandle handle, Quaternion& value) const;
+
+		// Advances every tween by the elapsed game time, then calls the callbacks of those that finished.
+		void Update(GameTime const& gameTime);
+		// Advances every tween by elapsedSeconds, then calls the callbacks of those that finished.
+		void Update(double elapsedSeconds);
+
+	private:
+		enum Kind : u32 {
+			DoubleKind,
+			Vector2Kind,
+			Vector3Kind,
+			ColorKind,
+			QuaternionKind,
+			KindCount
+		};
+
+		// The tweens of one value type. Each component has its own arrays.
+		struct Pool {
+			u32 Components = 1;
+			std::vector<double> From[4];
+			std::vector<double> To[4];
+			std::vector<double> Value[4];
+			std::vector<double> Elapsed;
+			std::vector<double> Duration;
+			std::vector<Easing> Easings;
+			std::vector<Completed> Callbacks;
+			std::vector<u32> Owners;
+		};
+
+		// Where a handle's tween lives.
+		struct Slot {
+			Kind Type;
+			u32 Index;
+			u32 Generation;
+			bool Alive;
+		};
+
+		Pool _pools[KindCount];
+		std::vector<Slot> _slots;
+		std::vector<u32> _freeSlots;
+		size_t _count;
+		// Scratch arrays reused by Update.
+		std::vector<double> _amounts;
+		std::vector<TweenHandle> _finished;
+
+		TweenHandle add(Kind type, const double* from, const double* to, double duration, Easing easing, Completed&& completed);
+		void remove(u32 slot);
+		// Returns the pool index of a running tween of the given type, or -1.
+		i64 find(TweenHandle handle, Kind type) const;
+		void advance(Pool& pool, double elapsedSeconds);
+		// Returns the generation after this one, skipping 0 when it wraps.
+		static u32 nextGeneration(u32 generation);
+	};
+}
+
+#endif
@@ -3,110 +3,8 @@
 #include "MathHelper.h"
 
 namespace Xna {
-	Vector2::Vector2() : X(0), Y(0) {}
-	Vector2::Vector2(double x, double y) : X(x), Y(y) {}
-	Vector2::Vector2(double value) : X(value), Y(value) {}
-
-	//Operators
-
-	Vector2 Vector2::operator- () {
-		return Vector2::Negate(*this);
-	}
-
-	Vector2 operator+ (Vector2 value1, Vector2 value2) {
-		return Vector2::Add(value1, value2);
-	}
-
-	Vector2 operator- (Vector2 value1, Vector2 value2) {
-		return Vector2::Subtract(value1, value2);
-	}
-
-	Vector2 operator* (Vector2 value1, Vector2 value2) {
-		return Vector2::Multiply(value1, value2);
-	}
-
-	Vector2 operator* (Vector2 value, double scaleFactor) {
-		return Vector2::Multiply(value, scaleFactor);
-	}
-
-	Vector2 operator* (double scaleFactor, Vector2 value) {
-		return Vector2::Multiply(value, scaleFactor);
-	}
-
-	Vector2 operator/ (Vector2 value, Vector2 divider) {
-		return Vector2::Divide(value, divider);
-	}
-
-	Vector2 operator/ (Vector2 value, double divider) {
-		return Vector2::Divide(value, divider);
-	}
-
-	Vector2 operator== (Vector2 a, Vector2 b) {
-		return a.Equals(b);
-	}
-
-	Vector2 operator!= (Vector2 a, Vector2 b) {
-		return !a.Equals(b);
-	}
-
 	//Static
 
-	Vector2 Vector2::Zero() {
-		return Vector2(0);
-	}
-
-	Vector2 Vector2::One() {
-		return Vector2(1.0, 1.0);
-	}
-
-	Vector2 Vector2::UnitX() {
-		return Vector2(1.0, 0.0);
-	}
-
-	Vector2 Vector2::UnitY() {
-		return Vector2(0, 1.0);
-	}
-
-	Vector2 Vector2::Add(Vector2 const& value1, Vector2 const& value2) {
-		return Vector2(
-			value1.X + value2.X,
-			value1.Y + value2.Y);
-	}
-
-	Vector2 Vector2::Subtract(Vector2 const& value1, Vector2 const& value2)
-	{
-		return Vector2(
-			value1.X - value2.X,
-			value1.Y - value2.Y);
-	}
-
-	Vector2 Vector2::Multiply(Vector2 const& value1, Vector2 const& value2)
-	{
-		return Vector2(
-			value1.X * value2.X,
-			value1.Y * value2.Y);
-	}
-
-	Vector2 Vector2::Multiply(Vector2 const& value1, double scaleFactor)
-	{
-		return Vector2(
-			value1.X * scaleFactor,
-			value1.Y * scaleFactor);
-	}
-
-	Vector2 Vector2::Divide(Vector2 const& value1, Vector2 const& value2) {
-		return Vector2(
-			value1.X / value2.X,
-			value1.Y / value2.Y);
-	}
-
-	Vector2 Vector2::Divide(Vector2 const& value1, double divider) {
-		double factor = 1. / divider;
-		return Vector2(
-			value1.X * factor,
-			value1.Y * factor);
-	}
-
 	Vector2 Vector2::Barycentric(Vector2 const& value1, Vector2 const& value2, Vector2 const& value3, double amount1, double amount2) {
 		return Vector2(
 			MathHelper::Barycentric(value1.X, value2.X, value3.X, amount1, amount2),
@@ -125,24 +23,8 @@ namespace Xna {
 			MathHelper::Ceiling(value.Y));
 	}
 
-	Vector2 Vector2::Clamp(Vector2 const& value1, Vector2 const& min, Vector2 const& max) {
-		return Vector2(
-			MathHelper::Clamp(value1.X, min.X, max.X),
-			MathHelper::Clamp(value1.Y, min.Y, max.Y));
-	}
-
-	double Vector2::Distance(Vector2 const& value1, Vector2 const& value2) {
-		return MathHelper::Sqrt(DistanceSquared(value1, value2));
-	}
-
-	double Vector2::DistanceSquared(Vector2 const& value1, Vector2 const& value2) {
-		return
-			(value1.X - value2.X) * (value1.X - value2.X) +
-			(value1.Y - value2.Y) * (value1.Y - value2.Y);
-	}
-
-	double Vector2::Dot(Vector2 const& value1, Vector2 const& value2) {
-		return (value1.X * value2.X) + (value1.Y * value2.Y);
+	double Vector2::Distance(Vector2 const& value1, Vector2 const& value2, MathPrecision precision) {
+		return MathHelper::Sqrt(DistanceSquared(value1, value2), precision);
 	}
 
 	Vector2 Vector2::Floor(Vector2 const& value) {
@@ -157,49 +39,30 @@ namespace Xna {
 			MathHelper::Hermite(value1.Y, tangent1.Y, value2.Y, tangent2.Y, amount));
 	}
 
-	Vector2 Vector2::Lerp(Vector2 const& value1, Vector2 const& value2, double amount) {
-		return Vector2(
-			MathHelper::Lerp(value1.X, value2.X, amount),
-			MathHelper::Lerp(value1.Y, value2.Y, amount));
-	}
-
-	Vector2 Vector2::LerpPrecise(Vector2 const& value1, Vector2  const& value2, double amount)
+	Vector2 Vector2::Normalize(Vector2 const& value)
 	{
-		return Vector2(
-			MathHelper::LerpPrecise(value1.X, value2.X, amount),
-			MathHelper::LerpPrecise(value1.Y, value2.Y, amount));
-	}
+		double factor = MathHelper::Sqrt((value.X * value.X)
+			+ (value.Y * value.Y));
 
-	Vector2 Vector2::Max(Vector2 const& value1, Vector2 const& value2)
-	{
-		return Vector2(
-			MathHelper::Max(value1.X, value2.X),
-			MathHelper::Max(value1.Y, value2.Y));
-	}
+		factor = 1. / factor;
 
-	Vector2 Vector2::Min(Vector2 const& value1, Vector2 const& value2)
-	{
 		return Vector2(
-			MathHelper::Min(value1.X, value2.X),
-			MathHelper::Min(value1.Y, value2.Y));
-	}
+			value.X * factor,
+			value.Y * factor);
 
-	Vector2 Vector2::Negate(Vector2 const& value)
-	{
-		return Vector2(-value.X, -value.Y);
 	}
 
-	Vector2 Vector2::Normalize(Vector2 const& value)
+	Vector2 Vector2::Normalize(Vector2 const& value, MathPrecision precision)
 	{
-		double factor = MathHelper::Sqrt((value.X * value.X)
-			+ (value.Y * value.Y));
+		if (precision != MathPrecision::Fast)
+			return Normalize(value);
 
-		factor = 1. / factor;
+		double factor = MathHelper::FastRsqrt((value.X * value.X)
+			+ (value.Y * value.Y));
 
 		return Vector2(
 			value.X * factor,
 			value.Y * factor);
-
 	}
 
 	Vector2 Vector2::Reflect(Vector2 const& vector, Vector2 const& normal)
@@ -246,7 +109,7 @@ namespace Xna {
 		return v;
 	}
 
-	void Vector2::Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2> destinationArray, size_t destinationIndex, size_t length) {
+	void Vector2::Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
 		for (i32 x = 0; x < length; x++)
 		{
 			Vector2 position = sourceArray[static_cast<std::vector<Xna::Vector2, std::allocator<Xna::Vector2>>::size_type>(sourceIndex) + x];
@@ -257,7 +120,7 @@ namespace Xna {
 		}
 	}
 
-	void Vector2::Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Quaternion const& rotation, std::vector<Vector2> destinationArray, size_t destinationIndex, size_t length) {
+	void Vector2::Transform(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Quaternion const& rotation, std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
 		for (size_t x = 0; x < length; x++)
 		{
 			Vector2 position = sourceArray[sourceIndex + x];
@@ -272,11 +135,13 @@ namespace Xna {
 		}
 	}
 
-	void Vector2::Transform(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2> destinationArray) {
+	void Vector2::Transform(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2>& destinationArray) {
+		destinationArray.resize(sourceArray.size());
 		Vector2::Transform(sourceArray, 0, matrix, destinationArray, 0, sourceArray.size());
 	}
 
-	void Vector2::Transform(std::vector<Vector2> const& sourceArray, Quaternion const& rotation, std::vector<Vector2> destinationArray) {
+	void Vector2::Transform(std::vector<Vector2> const& sourceArray, Quaternion const& rotation, std::vector<Vector2>& destinationArray) {
+		destinationArray.resize(sourceArray.size());
 		Vector2::Transform(sourceArray, 0, rotation, destinationArray, 0, sourceArray.size());
 	}
 
@@ -285,7 +150,7 @@ namespace Xna {
 			(normal.X * matrix.M12) + (normal.Y * matrix.M22));
 	}
 
-	void Vector2::TransformNormal(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2> destinationArray, size_t destinationIndex, size_t length) {
+	void Vector2::TransformNormal(std::vector<Vector2> const& sourceArray, size_t sourceIndex, Matrix const& matrix, std::vector<Vector2>& destinationArray, size_t destinationIndex, size_t length) {
 		for (size_t i = 0; i < length; i++)
 		{
 			Vector2 normal = sourceArray[sourceIndex + i];
@@ -296,8 +161,10 @@ namespace Xna {
 		}
 	}
 
-	void Vector2::TransformNormal(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2> destinationArray) {
-		for (i32 i = 0; i < sourceArray.size(); i++)
+	void Vector2::TransformNormal(std::vector<Vector2> const& sourceArray, Matrix const& matrix, std::vector<Vector2>& destinationArray) {
+		destinationArray.resize(sourceArray.size());
+
+		for (size_t i = 0; i < sourceArray.size(); i++)
 		{
 			Vector2 normal = sourceArray[i];
 
@@ -320,12 +187,8 @@ namespace Xna {
 		Y = value.Y;
 	}
 
-	double Vector2::Length() const {
-		return MathHelper::Sqrt((X * X) + (Y * Y));
-	}
-
-	double Vector2::LengthSquared() const {
-		return (X * X) + (Y * Y);
+	double Vector2::Length(MathPrecision precision) const {
+		return MathHelper::Sqrt((X * X) + (Y * Y), precision);
 	}
 
 	void Vector2::Normalize() {
@@ -344,10 +207,6 @@ namespace Xna {
 		return Point(static_cast<long>(X), static_cast<long>(X));
 	}
 
-	bool Vector2::Equals(Vector2 const& other) const {
-		return (X == other.X) && (Y == other.Y);
-	}
-
 	void Vector2::Deconstruct(double& x, double& y) const
 	{
 		x = X;
@@ -2,114 +2,7 @@
 #include "MathHelper.h"
 
 namespace Xna {
-	Vector3::Vector3() :
-		X(0), Y(0), Z(0) {}
-
-	Vector3::Vector3(double x, double y, double z) :
-		X(x), Y(y), Z(z) {}
-
-	Vector3::Vector3(double value) :
-		X(value), Y(value), Z(value) {}
-
-	Vector3::Vector3(Vector2 value, double z) :
-		X(value.X), Y(value.Y), Z(z) {}
-
-	Vector3 Vector3::operator- () const {
-		return Vector3(-X, -Y, -Z);
-	}
-
-	//----- Operators	
-
-	Vector3 operator- (Vector3 value1, Vector3 value2) {
-		return Vector3::Subtract(value1, value2);
-	}
-
-	Vector3 operator+ (Vector3 value1, Vector3 value2) {
-		return Vector3::Add(value1, value2);
-	}
-
-	Vector3 operator* (Vector3 value1, Vector3 value2) {
-		return Vector3::Multiply(value1, value2);
-	}
-
-	Vector3 operator* (double scaleFactor, Vector3 value) {
-		return Vector3::Subtract(value, scaleFactor);
-	}
-
-	Vector3 operator* (Vector3 value, double scaleFactor) {
-		return Vector3::Subtract(value, scaleFactor);
-	}
-
-	Vector3 operator/ (Vector3 value1, Vector3 value2) {
-		return Vector3::Divide(value1, value2);
-	}
-
-	Vector3 operator/ (Vector3 value, double divider) {
-		return Vector3::Divide(value, divider);
-	}
-
-	bool operator== (Vector3 value1, Vector3 value2) {
-		return value1.Equals(value2);
-	}
-
-	bool operator!= (Vector3 value1, Vector3 value2) {
-		return !value1.Equals(value2);
-	}
-
 	//----- Static
-	Vector3 Vector3::Zero() { return Vector3(0); }
-	Vector3 Vector3::One() { return Vector3(1.); }
-	Vector3 Vector3::UnitX() { return Vector3(1., 0); }
-	Vector3 Vector3::UnitY() { return Vector3(0, 1.); }
-	Vector3 Vector3::UnitZ() { return Vector3(0, 0, 1.); }
-	Vector3 Vector3::Up() { return Vector3(0, 1., 0); }
-	Vector3 Vector3::Down() { return Vector3(0, -1., 0); }
-	Vector3 Vector3::Right() { return Vector3(1., 0, 0); }
-	Vector3 Vector3::Left() { return Vector3(-1., 0, 0); }
-	Vector3 Vector3::Forward() { return Vector3(0, 0, -1.); }
-	Vector3 Vector3::Backward() { return Vector3(0, 0, 1.); }
-
-	Vector3 Vector3::Add(Vector3 const& value1, Vector3 const& value2) {
-		return Vector3(
-			value1.X + value2.X,
-			value1.Y + value2.Y,
-			value1.Z + value2.Z);
-	}
-
-	Vector3 Vector3::Subtract(Vector3 const& value1, Vector3 const& value2) {
-		return Vector3(
-			value1.X - value2.X,
-			value1.Y - value2.Y,
-			value1.Z - value2.Z);
-	}
-
-	Vector3 Vector3::Divide(Vector3 const& value1, Vector3 const& value2) {
-		return Vector3(
-			value1.X / value2.X,
-			value1.Y / value2.Y,
-			value1.Z / value2.Z);
-	}
-	Vector3 Vector3::Divide(Vector3 const& value1, double divider) {
-		double factor = 1. / divider;
-		return Vector3(
-			value1.X * factor,
-			value1.Y * factor,
-			value1.Z * factor);
-	}
-
-	Vector3 Vector3::Multiply(Vector3 const& value1, Vector3 const& value2) {
-		return Vector3(
-			value1.X * value2.X,
-			value1.Y * value2.Y,
-			value1.Z * value2.Z);
-	}
-
-	Vector3 Vector3::Multiply(Vector3 const& value1, double scaleFactor) {
-		return Vector3(
-			value1.X * scaleFactor,
-			value1.Y * scaleFactor,
-			value1.Z * scaleFactor);
-	}
 
 	Vector3 Vector3::Barycentric(Vector3 const& value1, Vector3 const& value2, Vector3 const& value3, double amount1, double amount2) {
 		return Vector3(
@@ -132,36 +25,8 @@ namespace Xna {
 			MathHelper::Ceiling(value.Z));
 	}
 
-	Vector3 Vector3::Clamp(Vector3 const& value1, Vector3 const& min, Vector3 const& max) {
-		return Vector3(
-			MathHelper::Clamp(value1.X, min.X, max.X),
-			MathHelper::Clamp(value1.Y, min.Y, max.Y),
-			MathHelper::Clamp(value1.Z, min.Z, max.Z));
-	}
-
-	Vector3 Vector3::Cross(Vector3 const& value1, Vector3 const& value2) {
-		return Vector3(
-			value1.Y * value2.Z - value2.Y * value1.Z,
-			-(value1.X * value2.Z - value2.X * value1.Z),
-			value1.X * value2.Y - value2.X * value1.Y);
-	}
-
-	double Vector3::Dot(Vector3 const& value1, Vector3 const& value2) {
-		return
-			value1.X * value2.X +
-			value1.Y * value2.Y +
-			value1.Z * value2.Z;
-	}
-
-	double Vector3::Distance(Vector3 const& value1, Vector3 const& value2) {
-		return MathHelper::Sqrt(DistanceSquared(value1, value2));
-	}
-
-	double Vector3::DistanceSquared(Vector3 const& value1, Vector3 const& value2) {
-		return
-			(value1.X - value2.X) * (value1.X - value2.X) +
-			(value1.Y - value2.Y) * (value1.Y - value2.Y) +
-			(value1.Z - value2.Z) * (value1.Z - value2.Z);
+	double Vector3::Distance(Vector3 const& value1, Vector3 const& value2, MathPrecision precision) {
+		return MathHelper::Sqrt(DistanceSquared(value1, value2), precision);
 	}
 
 	Vector3 Vector3::Floor(Vector3 const& value) {
@@ -191,36 +56,18 @@ namespace Xna {
 			value.Z * factor);
 	}
 
-	Vector3 Vector3::Lerp(Vector3 const& value1, Vector3 const& value2, double amount) {
-		return Vector3(
-			MathHelper::Lerp(value1.X, value2.X, amount),
-			MathHelper::Lerp(value1.Y, value2.Y, amount),
-			MathHelper::Lerp(value1.Z, value2.Z, amount));
-	}
-
-	Vector3 Vector3::LerpPrecise(Vector3 const& value1, Vector3 const& value2, double amount) {
-		return Vector3(
-			MathHelper::LerpPrecise(value1.X, value2.X, amount),
-			MathHelper::LerpPrecise(value1.Y, value2.Y, amount),
-			MathHelper::LerpPrecise(value1.Z, value2.Z, amount));
-	}
+	Vector3 Vector3::Normalize(Vector3 const& value, MathPrecision precision) {
+		if (precision != MathPrecision::Fast)
+			return Normalize(value);
 
-	Vector3 Vector3::Max(Vector3 const& value1, Vector3 const& value2) {
-		return Vector3(
-			MathHelper::Max(value1.X, value2.X),
-			MathHelper::Max(value1.Y, value2.Y),
-			MathHelper::Max(value1.Z, value2.Z));
-	}
+		double factor = MathHelper::FastRsqrt((value.X * value.X)
+			+ (value.Y * value.Y)
+			+ (value.Z * value.Z));
 
-	Vector3 Vector3::Min(Vector3 const& value1, Vector3 const& value2) {
 		return Vector3(
-			MathHelper::Min(value1.X, value2.X),
-			MathHelper::Min(value1.Y, value2.Y),
-			MathHelper::Min(value1.Z, value2.Z));
-	}
-
-	Vector3 Vector3::Negate(Vector3 const& value) {
-		return Vector3(-value.X, -value.Y, -value.Z);
+			value.X * factor,
+			value.Y * factor,
+			value.Z * factor);
 	}
 
 	Vector3 Vector3::Reflect(Vector3 const& vector, Vector3 const& normal) {
@@ -377,12 +224,8 @@ namespace Xna {
 		Z = value.Z;
 	}
 
-	double Vector3::Length() const {
-		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z));
-	}
-
-	double Vector3::LengthSquared() const {
-		return (X * X) + (Y * Y) + (Z * Z);
+	double Vector3::Length(MathPrecision precision) const {
+		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z), precision);
 	}
 
 	void Vector3::Floor() {
@@ -398,9 +241,4 @@ namespace Xna {
 		z = Z;
 	}
 
-	bool Vector3::Equals(Vector3 const& other) const {
-		return X == other.X
-			&& Y == other.Y
-			&& Z == other.Z;
-	}
 }
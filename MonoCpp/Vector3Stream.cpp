@@ -0,0 +1,49 @@
+#include "Streams.h"
+
+namespace Xna {
+
+	Vector3Stream::Vector3Stream() {}
+
+	Vector3Stream::Vector3Stream(size_t count) :
+		X(count), Y(count), Z(count) {}
+
+	Vector3Stream::Vector3Stream(std::vector<Vector3> const& values) :
+		X(values.size()), Y(values.size()), Z(values.size()) {
+
+		for (size_t i = 0; i < values.size(); ++i) {
+			X[i] = values[i].X;
+			Y[i] = values[i].Y;
+			Z[i] = values[i].Z;
+		}
+	}
+
+	//----- Members
+
+	size_t Vector3Stream::Count() const {
+		return X.size();
+	}
+
+	void Vector3Stream::Resize(size_t count) {
+		X.resize(count);
+		Y.resize(count);
+		Z.resize(count);
+	}
+
+	Vector3 Vector3Stream::Get(size_t index) const {
+		return Vector3(X[index], Y[index], Z[index]);
+	}
+
+	void Vector3Stream::Set(size_t index, Vector3 const& value) {
+		X[index] = value.X;
+		Y[index] = value.Y;
+		Z[index] = value.Z;
+	}
+
+	void Vector3Stream::CopyTo(std::vector<Vector3>& destinationArray) const {
+		destinationArray.resize(Count());
+
+		for (size_t i = 0; i < destinationArray.size(); ++i) {
+			destinationArray[i] = Vector3(X[i], Y[i], Z[i]);
+		}
+	}
+}
@@ -2,115 +2,7 @@
 #include "MathHelper.h"
 
 namespace Xna {
-
-	Vector4::Vector4() :
-		X(0), Y(0), Z(0), W(0) {}
-	Vector4::Vector4(double x, double y, double z, double w) :
-		X(x), Y(y), Z(z), W(w) {}
-	Vector4::Vector4(Vector2 value, double z, double w) :
-		X(value.X), Y(value.Y), Z(z), W(w) {}
-	Vector4::Vector4(Vector3 value, double w) :
-		X(value.X), Y(value.Y), Z(value.Z), W(w) {}
-	Vector4::Vector4(double value) :
-		X(value), Y(value), Z(value), W(value) {}
-
-	//-----Operators
-	Vector4 Vector4::operator- () const {
-		return Vector4::Negate((*this));
-	}
-
-	Vector4 operator- (Vector4 value1, Vector4 value2) {
-		return Vector4::Subtract(value1, value2);
-	}
-
-	Vector4 operator+ (Vector4 value1, Vector4 value2) {
-		return Vector4::Add(value1, value2);
-	}
-
-	Vector4 operator* (Vector4 value1, Vector4 value2) {
-		return Vector4::Multiply(value1, value2);
-	}
-
-	Vector4 operator* (Vector4 value, double scaleFactor) {
-		return Vector4::Multiply(value, scaleFactor);
-	}
-
-	Vector4 operator* (double scaleFactor, Vector4 value) {
-		return Vector4::Multiply(value, scaleFactor);
-	}
-
-	Vector4 operator/ (Vector4 value1, Vector4 value2) {
-		return Vector4::Divide(value1, value2);
-	}
-
-	Vector4 operator/ (Vector4 value1, i32 divider) {
-		return Vector4::Divide(value1, divider);
-	}
-
-	bool operator== (Vector4 value1, Vector4 value2) {
-		return value1.Equals(value2);
-	}
-
-	bool operator!= (Vector4 value1, Vector4 value2) {
-		return !value1.Equals(value2);
-	}
-
 	//-----Static
-	Vector4 Vector4::Zero() { return Vector4(0); };
-	Vector4 Vector4::One() { return Vector4(1.); };
-	Vector4 Vector4::UnitX() { return Vector4(1., 0, 0, 0); };
-	Vector4 Vector4::UnitY() { return Vector4(0, 1., 0, 0); };
-	Vector4 Vector4::UnitZ() { return Vector4(0, 0, 1., 0); };
-	Vector4 Vector4::UnitW() { return Vector4(0, 0, 0, 1.); };
-
-	Vector4 Vector4::Add(Vector4 const& value1, Vector4 const& value2) {
-		return Vector4(
-			value1.X + value2.X,
-			value1.Y + value2.Y,
-			value1.Z + value2.Z,
-			value1.W + value2.W);
-	}
-
-	Vector4 Vector4::Subtract(Vector4 const& value1, Vector4 const& value2) {
-		return Vector4(
-			value1.X - value2.X,
-			value1.Y - value2.Y,
-			value1.Z - value2.Z,
-			value1.W - value2.W);
-	}
-
-	Vector4 Vector4::Multiply(Vector4 const& value1, Vector4 const& value2) {
-		return Vector4(
-			value1.X * value2.X,
-			value1.Y * value2.Y,
-			value1.Z * value2.Z,
-			value1.W * value2.W);
-	}
-
-	Vector4 Vector4::Multiply(Vector4 const& value1, double scaleFactor) {
-		return Vector4(
-			value1.X * scaleFactor,
-			value1.Y * scaleFactor,
-			value1.Z * scaleFactor,
-			value1.W * scaleFactor);
-	}
-
-	Vector4 Vector4::Divide(Vector4 const& value1, Vector4 const& value2) {
-		return Vector4(
-			value1.X / value2.X,
-			value1.Y / value2.Y,
-			value1.Z / value2.Z,
-			value1.W / value2.W);
-	}
-
-	Vector4 Vector4::Divide(Vector4 const& value1, double divider) {
-		double factor = 1. / divider;
-		return Vector4(
-			value1.X * factor,
-			value1.Y * factor,
-			value1.Z * factor,
-			value1.W * factor);
-	}
 
 	Vector4 Vector4::Barycentric(Vector4 const& value1, Vector4 const& value2, Vector4 const& value3, double amount1, double amount2) {
 		return Vector4(
@@ -136,32 +28,8 @@ namespace Xna {
 			MathHelper::Ceiling(value.W));
 	}
 
-	Vector4 Vector4::Clamp(Vector4 const& value1, Vector4 const& min, Vector4 const& max) {
-		return Vector4(
-			MathHelper::Clamp(value1.X, min.X, max.X),
-			MathHelper::Clamp(value1.Y, min.Y, max.Y),
-			MathHelper::Clamp(value1.Z, min.Z, max.Z),
-			MathHelper::Clamp(value1.W, min.W, max.W));
-	}
-
-	double Vector4::Distance(Vector4 const& value1, Vector4 const& value2) {
-		return MathHelper::Sqrt(DistanceSquared(value1, value2));
-	}
-
-	double Vector4::DistanceSquared(Vector4 const& value1, Vector4 const& value2) {
-		return
-			(value1.W - value2.W) * (value1.W - value2.W) +
-			(value1.X - value2.X) * (value1.X - value2.X) +
-			(value1.Y - value2.Y) * (value1.Y - value2.Y) +
-			(value1.Z - value2.Z) * (value1.Z - value2.Z);
-	}
-
-	double Vector4::Dot(Vector4 const& value1, Vector4 const& value2) {
-		return
-			value1.X * value2.X +
-			value1.Y * value2.Y +
-			value1.Z * value2.Z +
-			value1.W * value2.W;
+	double Vector4::Distance(Vector4 const& value1, Vector4 const& value2, MathPrecision precision) {
+		return MathHelper::Sqrt(DistanceSquared(value1, value2), precision);
 	}
 
 	Vector4 Vector4::Floor(Vector4 const& value) {
@@ -180,50 +48,30 @@ namespace Xna {
 			MathHelper::Hermite(value1.W, tangent1.W, value2.W, tangent2.W, amount));
 	}
 
-	Vector4 Vector4::Lerp(Vector4 const& value1, Vector4 const& value2, double amount) {
-		return Vector4(
-			MathHelper::Lerp(value1.X, value2.X, amount),
-			MathHelper::Lerp(value1.Y, value2.Y, amount),
-			MathHelper::Lerp(value1.Z, value2.Z, amount),
-			MathHelper::Lerp(value1.W, value2.W, amount));
-	}
-
-	Vector4 Vector4::LerpPrecise(Vector4 const& value1, Vector4 const& value2, double amount) {
-		return Vector4(
-			MathHelper::LerpPrecise(value1.X, value2.X, amount),
-			MathHelper::LerpPrecise(value1.Y, value2.Y, amount),
-			MathHelper::LerpPrecise(value1.Z, value2.Z, amount),
-			MathHelper::LerpPrecise(value1.W, value2.W, amount));
-	}
+	Vector4 Vector4::Normalize(Vector4 const& value) {
+		double factor = MathHelper::Sqrt((value.X * value.X)
+			+ (value.Y * value.Y)
+			+ (value.Z * value.Z)
+			+ (value.W * value.W));
 
-	Vector4 Vector4::Max(Vector4 const& value1, Vector4 const& value2) {
-		return Vector4(
-			MathHelper::Max(value1.X, value2.X),
-			MathHelper::Max(value1.Y, value2.Y),
-			MathHelper::Max(value1.Z, value2.Z),
-			MathHelper::Max(value1.W, value2.W));
-	}
+		factor = 1. / factor;
 
-	Vector4 Vector4::Min(Vector4 const& value1, Vector4 const& value2) {
 		return Vector4(
-			MathHelper::Min(value1.X, value2.X),
-			MathHelper::Min(value1.Y, value2.Y),
-			MathHelper::Min(value1.Z, value2.Z),
-			MathHelper::Min(value1.W, value2.W));
+			value.X * factor,
+			value.Y * factor,
+			value.Z * factor,
+			value.W * factor);
 	}
 
-	Vector4 Vector4::Negate(Vector4 const& value) {
-		return Vector4(-value.X, -value.Y, -value.Z, -value.W);
-	}
+	Vector4 Vector4::Normalize(Vector4 const& value, MathPrecision precision) {
+		if (precision != MathPrecision::Fast)
+			return Normalize(value);
 
-	Vector4 Vector4::Normalize(Vector4 const& value) {
-		double factor = MathHelper::Sqrt((value.X * value.X)
+		double factor = MathHelper::FastRsqrt((value.X * value.X)
 			+ (value.Y * value.Y)
 			+ (value.Z * value.Z)
 			+ (value.W * value.W));
 
-		factor = 1. / factor;
-
 		return Vector4(
 			value.X * factor,
 			value.Y * factor,
@@ -311,12 +159,8 @@ namespace Xna {
 		W = value.W;
 	}
 
-	double Vector4::Length() const {
-		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W));
-	}
-
-	double Vector4::LengthSquared() const {
-		return (X * X) + (Y * Y) + (Z * Z) + (W * W);
+	double Vector4::Length(MathPrecision precision) const {
+		return MathHelper::Sqrt((X * X) + (Y * Y) + (Z * Z) + (W * W), precision);
 	}
 
 	void Vector4::Normalize() {
@@ -342,10 +186,4 @@ namespace Xna {
 		w = W;
 	}
 
-	bool Vector4::Equals(Vector4 const& other) const {
-		return W == other.W
-			&& X == other.X
-			&& Y == other.Y
-			&& Z == other.Z;
-	}
 }
\ No newline at end of file